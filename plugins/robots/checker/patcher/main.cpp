@@ -17,6 +17,7 @@
 #include <QtCore/QFile>
 
 #include <qrrepo/repoApi.h>
+#include <qrrepo/saveFilePatcher.h>
 #include <qrutils/xmlUtils.h>
 
 #include <QFileInfo>
@@ -61,7 +62,17 @@ int main(int argc, char *argv[])
 	}
 
 	const auto &saveFile = positionalArgs[0];
-	qrRepo::RepoApi repo(saveFile);
+
+	// Patching only metainformation entries of the archive, the model itself is never loaded.
+	// Old-format save files can not be patched this way, so they are loaded into repository completely.
+	qrRepo::SaveFilePatcher patcher(saveFile);
+	QScopedPointer<qrRepo::RepoApi> repo(patcher.isValid() ? nullptr : new qrRepo::RepoApi(saveFile));
+	const auto metaInformation = [&patcher, &repo](const QString &key) {
+		return repo ? repo->metaInformation(key) : patcher.metaInformation(key);
+	};
+	const auto setMetaInformation = [&patcher, &repo](const QString &key, const QVariant &value) {
+		repo ? repo->setMetaInformation(key, value) : patcher.setMetaInformation(key, value);
+	};
 
 	// Check that from three booleans (-f/-w/--wp options) at least two of them are not true at the same time
 	if (parser.isSet(patchWorld) + parser.isSet(patchFieldWithoutRobot) + parser.isSet(patchField) > 1) {
@@ -85,12 +96,12 @@ int main(int argc, char *argv[])
 		QDomElement blobsRoot = blobsDoc.createElement("root");
 		blobsRoot.appendChild(blobs);
 		blobsDoc.appendChild(blobsRoot);
-		repo.setMetaInformation("blobs", blobsDoc.toString(4));
+		setMetaInformation("blobs", blobsDoc.toString(4));
 
 		newWorld.firstChildElement("root").removeChild(blobs);
 		if (!wholeWorld) {
 			QDomDocument prevWorld;
-			prevWorld.setContent(repo.metaInformation("worldModel").toString());
+			prevWorld.setContent(metaInformation("worldModel").toString());
 
 			newWorld.replaceChild(prevWorld.firstChildElement("robots"),
 						newWorld.firstChildElement("robots"));
@@ -102,7 +113,7 @@ int main(int argc, char *argv[])
 			}
 		}
 
-		repo.setMetaInformation("worldModel", newWorld.toString(4));
+		setMetaInformation("worldModel", newWorld.toString(4));
 	}
 
 	if (parser.isSet(patchScript)) {
@@ -115,9 +126,9 @@ int main(int argc, char *argv[])
 
 			/// Explicitly convert to QString
 			const QString &scriptContent = scriptFile.readAll();
-			repo.setMetaInformation("activeCode", scriptContent);
+			setMetaInformation("activeCode", scriptContent);
 
-			repo.setMetaInformation("activeCodeLanguageExtension", QFileInfo(scriptFile).suffix().toLower());
+			setMetaInformation("activeCodeLanguageExtension", QFileInfo(scriptFile).suffix().toLower());
 
 			scriptFile.close();
 		}
@@ -125,17 +136,17 @@ int main(int argc, char *argv[])
 
 	if (parser.isSet(putRobotOnStart)) {
 		QDomDocument world;
-		world.setContent(repo.metaInformation("worldModel").toString());
+		world.setContent(metaInformation("worldModel").toString());
 		auto robot = world.documentElement().firstChildElement("robots").firstChildElement("robot");
 		auto start = robot.firstChildElement("startPosition");
 		robot.setAttribute("direction", start.attribute("direction"));
 		auto x = start.attribute("x").toDouble() - 25;
 		auto y = start.attribute("y").toDouble() - 25;
 		robot.setAttribute("position", QString::number(x) + ":" + QString::number(y));
-		repo.setMetaInformation("worldModel", world.toString(4));
+		setMetaInformation("worldModel", world.toString(4));
 	}
 
-	if (!repo.saveAll()) {
+	if (!(repo ? repo->saveAll() : patcher.save())) {
 		return -1;
 	}
 
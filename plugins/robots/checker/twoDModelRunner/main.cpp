@@ -124,6 +124,9 @@ int main(int argc, char *argv[])
 								   , QObject::tr("Close the window and exit after diagram/script"\
 												 " finishes."));
 	QCommandLineOption showConsoleOption({"c", "console"}, QObject::tr("Shows robot's console."));
+	QCommandLineOption statisticsOption("stats", QObject::tr("A path to file where simulated ticks, wall time"\
+			" and peak memory usage of the session will be written (JSON).")
+			, "path-to-statistics", "statistics.json");
 	parser.addOption(backgroundOption);
 	parser.addOption(reportOption);
 	parser.addOption(trajectoryOption);
@@ -133,6 +136,7 @@ int main(int argc, char *argv[])
 	parser.addOption(closeOnFinishOption);
 	parser.addOption(closeOnSuccessOption);
 	parser.addOption(showConsoleOption);
+	parser.addOption(statisticsOption);
 
 	parser.process(*app);
 
@@ -150,7 +154,8 @@ int main(int argc, char *argv[])
 	const bool closeOnSuccessMode = parser.isSet(closeOnSuccessOption);
 	const bool closeOnFinishMode = backgroundMode || parser.isSet(closeOnFinishOption);
 	const bool showConsoleMode = parser.isSet(showConsoleOption);
-	QScopedPointer<twoDModel::Runner> runner(new twoDModel::Runner(report, trajectory, input, mode));
+	const QString statistics = parser.isSet(statisticsOption) ? parser.value(statisticsOption) : QString();
+	QScopedPointer<twoDModel::Runner> runner(new twoDModel::Runner(report, trajectory, input, mode, statistics));
 
 	auto speedFactor = parser.value(speedOption).toInt();
 	if (!runner->interpret(qrsFile, backgroundMode, speedFactor
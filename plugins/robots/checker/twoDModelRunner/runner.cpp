@@ -14,12 +14,21 @@
 
 #include "runner.h"
 
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtWidgets/QApplication>
 
+#include <qrkernel/logging.h>
+
 #include <qrutils/widgets/consoleDock.h>
 #include <kitBase/robotModel/robotParts/shell.h>
 #include <kitBase/robotModel/robotModelUtils.h>
@@ -29,6 +38,30 @@
 
 using namespace twoDModel;
 
+/// Returns peak resident memory of the current process in bytes.
+static qint64 peakMemoryUsage()
+{
+#if defined(Q_OS_WIN)
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return static_cast<qint64>(counters.PeakWorkingSetSize);
+	}
+
+	return 0;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+
+#if defined(Q_OS_MAC)
+	return static_cast<qint64>(usage.ru_maxrss);
+#else
+	return static_cast<qint64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
 Runner::Runner(const QString &report, const QString &trajectory)
 {
 	mQRealFacade.reset(new qReal::SystemFacade());
@@ -63,12 +96,14 @@ Runner::Runner(const QString &report, const QString &trajectory)
 	connect(&*mErrorReporter, &qReal::ConsoleErrorReporter::logAdded, &*mReporter, &Reporter::addLog);
 }
 
-Runner::Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode)
+Runner::Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode
+		, const QString &statistics)
 	: Runner(report, trajectory)
 
 {
 	mInputsFile = input;
 	mMode = mode;
+	mStatisticsFile = statistics;
 }
 
 Runner::~Runner()
@@ -131,6 +166,7 @@ bool Runner::interpret(const QString &saveFile, const bool background
 
 		auto &t = twoDModelWindow->model().timeline();
 		t.setImmediateMode(background);
+		connect(&t, &model::Timeline::tick, this, [this]() { ++mTicks; });
 		if (customSpeedFactor >= model::Timeline::normalSpeedFactor) {
 			t.setSpeedFactor(customSpeedFactor);
 		}
@@ -142,6 +178,7 @@ bool Runner::interpret(const QString &saveFile, const bool background
 	}
 
 	mReporter->onInterpretationStart();
+	mWallTime.start();
 	if (mMode == "script") {
 		return mPluginFacade->interpretCode(mInputsFile);
 	} else if (mMode == "diagram") {
@@ -211,8 +248,31 @@ void Runner::attachNewConsoleTo(view::TwoDModelWidget *twoDModelWindow)
 	}
 }
 
+void Runner::writeStatistics() const
+{
+	if (mStatisticsFile.isEmpty()) {
+		return;
+	}
+
+	QFile file(mStatisticsFile);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		QLOG_ERROR() << "Can not open" << mStatisticsFile << "for writing";
+		return;
+	}
+
+	const QJsonObject statistics = {
+		{ "ticks", static_cast<qint64>(mTicks) }
+		, { "modelTime", static_cast<qint64>(mTicks * model::Timeline::timeInterval) }
+		, { "wallTime", mWallTime.isValid() ? mWallTime.elapsed() : 0 }
+		, { "peakMemory", peakMemoryUsage() }
+	};
+
+	file.write(QJsonDocument(statistics).toJson());
+}
+
 void Runner::close()
 {
+	writeStatistics();
 	mMainWindow->emulateClose(mReporter->lastMessageIsError() ? 1 : 0);
 	while (!mRobotConsoles.empty()) {
 		mRobotConsoles.first()->deleteLater();
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QScopedPointer>
 
 #include <qrgui/systemFacade/systemFacade.h>
@@ -56,7 +57,10 @@ public:
 	/// @param trajectory A path to a file where robot`s trajectory will be written during the session.
 	/// @param input A path to a file where JSON with inputs for JavaScript.
 	/// @param mode Interpret mode.
-	Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode);
+	/// @param statistics A path to a file where JSON with simulated ticks, wall time and peak memory usage
+	/// of the session will be written after it ends. Nothing is written if empty.
+	Runner(const QString &report, const QString &trajectory, const QString &input, const QString &mode
+			, const QString &statistics = QString());
 
 	~Runner();
 
@@ -79,6 +83,7 @@ private:
 	void onDeviceStateChanged(const QString &robotId, const kitBase::robotModel::robotParts::Device *device
 			, const QString &property, const QVariant &value);
 	void attachNewConsoleTo(view::TwoDModelWidget *twoDModelWindow);
+	void writeStatistics() const;
 
 	QScopedPointer<qReal::SystemFacade> mQRealFacade;
 	QScopedPointer<qReal::Controller> mController;
@@ -93,6 +98,9 @@ private:
 	QList<qReal::ui::ConsoleDock *> mRobotConsoles;
 	QString mInputsFile;
 	QString mMode;
+	QString mStatisticsFile;
+	QElapsedTimer mWallTime;
+	quint64 mTicks = 0;
 };
 
 }
@@ -57,9 +57,11 @@ HEADERS += \
 	$$PWD/include/ev3Kit/blocks/ev3BlocksFactory.h \
 	$$PWD/include/ev3Kit/communication/commandConstants.h \
 	$$PWD/include/ev3Kit/communication/ev3DirectCommand.h \
+	$$PWD/include/ev3Kit/communication/ev3BatchedReadCommand.h \
 	$$PWD/include/ev3Kit/communication/ev3RobotCommunicationThread.h \
 	$$PWD/include/ev3Kit/communication/bluetoothRobotCommunicationThread.h \
 	$$PWD/include/ev3Kit/communication/usbRobotCommunicationThread.h \
+	$$PWD/include/ev3Kit/communication/ev3LoopbackCommunicationThread.h \
 	$$PWD/src/blocks/details/speakerBlock.h \
 	$$PWD/src/blocks/details/beepBlock.h \
 	$$PWD/src/blocks/details/playToneBlock.h \
@@ -98,10 +100,12 @@ SOURCES += \
 	$$PWD/src/blocks/details/ledBlock.cpp \
 	$$PWD/src/blocks/details/ev3ReadRGBBlock.cpp \
 	$$PWD/src/communication/ev3DirectCommand.cpp \
+	$$PWD/src/communication/ev3BatchedReadCommand.cpp \
 	$$PWD/src/communication/ev3RobotCommunicationThread.cpp \
 	$$PWD/src/communication/bluetoothRobotCommunicationThread.cpp \
 	$$PWD/src/communication/hidapi.c \
 	$$PWD/src/communication/usbRobotCommunicationThread.cpp \
+	$$PWD/src/communication/ev3LoopbackCommunicationThread.cpp \
 
 TRANSLATIONS = \
 	$$PWD/../../../../qrtranslations/ru/plugins/robots/ev3Kit_ru.ts \
@@ -0,0 +1,85 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+
+namespace ev3 {
+namespace communication {
+
+/// Direct command that reads several input devices at once. Each reading is an INPUT_DEVICE_READY_* opcode storing
+/// its value into its own slot of global memory, so the whole batch costs one round trip to the brick and values
+/// are decoded from one reply.
+class Ev3BatchedReadCommand
+{
+public:
+	/// Form in which the brick reports a reading.
+	enum class Format
+	{
+		/// A float in SI units.
+		si
+		/// A raw 32-bit integer.
+		, raw
+		/// A byte with percent value.
+		, percent
+	};
+
+	/// Number of bytes of global memory reserved for each reading.
+	static const int readingSize = 4;
+
+	/// Maximal number of readings in one command, limited by one-byte global memory offsets.
+	static const int maxReadings = 64;
+
+	/// Number of bytes preceding global memory in a direct command reply (size, message counter, reply type).
+	static const int replyHeaderSize = 5;
+
+	/// Adds a reading of the device on the given low-level port in the given mode.
+	/// @returns index of the reading in a reply or -1 if the command is full.
+	int add(char port, Format format, int mode);
+
+	/// Returns the number of readings in the command.
+	int size() const;
+
+	/// Returns true if no readings were added.
+	bool isEmpty() const;
+
+	/// Returns true if no more readings can be added.
+	bool isFull() const;
+
+	/// Returns the command ready to be sent to a brick.
+	QByteArray command() const;
+
+	/// Returns the size of a reply to this command.
+	int responseSize() const;
+
+	/// Returns bytes of the reading with given index from the reply or empty array if reply is too short or
+	/// brick reported an error.
+	static QByteArray reading(const QByteArray &reply, int index);
+
+private:
+	struct Request
+	{
+		char port;
+		Format format;
+		int mode;
+	};
+
+	QList<Request> mRequests;
+};
+
+}
+}
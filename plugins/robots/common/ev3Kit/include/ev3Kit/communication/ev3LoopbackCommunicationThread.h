@@ -0,0 +1,70 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QHash>
+
+#include "ev3RobotCommunicationThread.h"
+
+namespace ev3 {
+namespace communication {
+
+/// Stand-in for USB and Bluetooth communication threads that emulates EV3 brick in-process. Replies to input
+/// device reading opcodes with values set by setSensorValue(), acknowledges any other direct command and may
+/// delay each round trip to emulate link latency. Allows to test sensor polling without hardware.
+class Ev3LoopbackCommunicationThread : public Ev3RobotCommunicationThread
+{
+	Q_OBJECT
+
+public:
+	/// @param latency - time in milliseconds each round trip will take.
+	explicit Ev3LoopbackCommunicationThread(int latency = 0);
+
+	/// Sets the value that brick will report for the device on the given low-level port. It is reported as float
+	/// for SI readings, as 32-bit integer for raw readings and as a single byte for percent readings.
+	void setSensorValue(char port, int value);
+
+	/// Returns the number of messages sent to the brick since creation.
+	int messagesCount() const;
+
+	/// Returns the number of input device readings requested since creation.
+	int readingsCount() const;
+
+public slots:
+	bool send(QObject *addressee, const QByteArray &buffer, int responseSize) override;
+	bool connect() override;
+	void reconnect() override;
+	void disconnect() override;
+	void allowLongJobs(bool allow = true) override;
+
+private:
+	bool send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer) override;
+	bool send1(const QByteArray &buffer) const override;
+	QByteArray receive(int size) const override;
+
+	/// Executes the given direct command and returns brick's reply.
+	QByteArray execute(const QByteArray &command) const;
+
+	const int mLatency;
+	QHash<char, int> mSensorValues;
+	mutable QByteArray mPendingReply;
+	mutable int mMessagesCount = 0;
+	mutable int mReadingsCount = 0;
+	bool mConnected = false;
+};
+
+}
+}
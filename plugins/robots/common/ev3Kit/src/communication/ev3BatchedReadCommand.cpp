@@ -0,0 +1,93 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "ev3Kit/communication/ev3BatchedReadCommand.h"
+
+#include "ev3Kit/communication/commandConstants.h"
+#include "ev3Kit/communication/ev3DirectCommand.h"
+
+using namespace ev3::communication;
+
+/// Opcode with its subcommand, daisy chain layer, port, type, mode, number of values and global index.
+static const int readingCommandSize = 14;
+
+/// Message counter used for sensor readings, replies are matched by order anyway.
+static const int messageCounter = 2;
+
+int Ev3BatchedReadCommand::add(char port, Format format, int mode)
+{
+	if (isFull()) {
+		return -1;
+	}
+
+	mRequests << Request{port, format, mode};
+	return mRequests.size() - 1;
+}
+
+int Ev3BatchedReadCommand::size() const
+{
+	return mRequests.size();
+}
+
+bool Ev3BatchedReadCommand::isEmpty() const
+{
+	return mRequests.isEmpty();
+}
+
+bool Ev3BatchedReadCommand::isFull() const
+{
+	return mRequests.size() >= maxReadings;
+}
+
+QByteArray Ev3BatchedReadCommand::command() const
+{
+	QByteArray command = Ev3DirectCommand::formCommand(7 + readingCommandSize * mRequests.size(), messageCounter
+			, readingSize * mRequests.size(), 0, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
+	int index = 7;
+	for (int i = 0; i < mRequests.size(); ++i) {
+		const Request &request = mRequests[i];
+		const enums::opcode::OpcodeEnum opcode = request.format == Format::si
+				? enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI
+				: request.format == Format::raw
+						? enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW
+						: enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT;
+		Ev3DirectCommand::addOpcode(opcode, command, index);
+		Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
+		Ev3DirectCommand::addByteParameter(request.port, command, index);
+		Ev3DirectCommand::addByteParameter(0x00, command, index);          // type (0 = Don’t change type)
+		Ev3DirectCommand::addByteParameter(request.mode, command, index);  // mode – Device mode [0-7]
+		Ev3DirectCommand::addByteParameter(0x01, command, index);          // # values
+		Ev3DirectCommand::addGlobalIndex(readingSize * i, command, index); // index for return data
+	}
+
+	return command;
+}
+
+int Ev3BatchedReadCommand::responseSize() const
+{
+	return replyHeaderSize + readingSize * mRequests.size();
+}
+
+QByteArray Ev3BatchedReadCommand::reading(const QByteArray &reply, int index)
+{
+	const int offset = replyHeaderSize + readingSize * index;
+	if (reply.size() < offset + readingSize
+			|| reply[4] != static_cast<char>(enums::replyType::ReplyTypeEnum::DIRECT_REPLY))
+	{
+		return QByteArray();
+	}
+
+	return reply.mid(offset, readingSize);
+}
@@ -0,0 +1,156 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "ev3Kit/communication/ev3LoopbackCommunicationThread.h"
+
+#include <QtCore/QThread>
+#include <QtCore/QtEndian>
+
+#include "ev3Kit/communication/commandConstants.h"
+
+using namespace ev3::communication;
+
+static const int directCommandHeaderSize = 7;
+
+Ev3LoopbackCommunicationThread::Ev3LoopbackCommunicationThread(int latency)
+	: mLatency(latency)
+{
+}
+
+void Ev3LoopbackCommunicationThread::setSensorValue(char port, int value)
+{
+	mSensorValues[port] = value;
+}
+
+int Ev3LoopbackCommunicationThread::messagesCount() const
+{
+	return mMessagesCount;
+}
+
+int Ev3LoopbackCommunicationThread::readingsCount() const
+{
+	return mReadingsCount;
+}
+
+bool Ev3LoopbackCommunicationThread::send(QObject *addressee, const QByteArray &buffer, int responseSize)
+{
+	QByteArray reply;
+	const bool result = send(buffer, responseSize, reply);
+	emit response(addressee, reply);
+	return result;
+}
+
+bool Ev3LoopbackCommunicationThread::send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer)
+{
+	const bool result = send1(buffer);
+	outputBuffer = receive(responseSize);
+	return result;
+}
+
+bool Ev3LoopbackCommunicationThread::connect()
+{
+	mConnected = true;
+	emit connected(true, QString());
+	return true;
+}
+
+void Ev3LoopbackCommunicationThread::reconnect()
+{
+	connect();
+}
+
+void Ev3LoopbackCommunicationThread::disconnect()
+{
+	mConnected = false;
+	emit disconnected();
+}
+
+void Ev3LoopbackCommunicationThread::allowLongJobs(bool allow)
+{
+	Q_UNUSED(allow)
+}
+
+bool Ev3LoopbackCommunicationThread::send1(const QByteArray &buffer) const
+{
+	mPendingReply.clear();
+	if (!mConnected) {
+		return false;
+	}
+
+	++mMessagesCount;
+	if (mLatency > 0) {
+		QThread::msleep(mLatency);
+	}
+
+	mPendingReply = buffer.size() > 4 && buffer[4] == enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY
+			? execute(buffer)
+			: QByteArray();
+	return true;
+}
+
+QByteArray Ev3LoopbackCommunicationThread::receive(int size) const
+{
+	const QByteArray reply = mPendingReply.left(size);
+	mPendingReply.clear();
+	return reply;
+}
+
+QByteArray Ev3LoopbackCommunicationThread::execute(const QByteArray &command) const
+{
+	if (command.size() < directCommandHeaderSize) {
+		return QByteArray();
+	}
+
+	const int globalSize = static_cast<uchar>(command[5]) | ((static_cast<uchar>(command[6]) & 0x03) << 8);
+	QByteArray reply(5 + globalSize, 0);
+	reply[0] = charOf(reply.size() - 2);
+	reply[1] = charOf((reply.size() - 2) >> 8);
+	reply[2] = command[2];
+	reply[3] = command[3];
+	reply[4] = charOf(enums::replyType::ReplyTypeEnum::DIRECT_REPLY);
+
+	// Each reading is an opcode with subcommand followed by five byte parameters and a one byte global index.
+	const int readingSize = 2 + 5 * 2 + 2;
+	for (int index = directCommandHeaderSize; index + readingSize <= command.size(); index += readingSize) {
+		const int opcode = (static_cast<uchar>(command[index]) << 8) | static_cast<uchar>(command[index + 1]);
+		if (opcode != enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI
+				&& opcode != enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW
+				&& opcode != enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT)
+		{
+			break;
+		}
+
+		++mReadingsCount;
+		const char port = command[index + 5];
+		const int offset = 5 + static_cast<uchar>(command[index + 13]);
+		const int value = mSensorValues.value(port);
+		QByteArray bytes;
+		if (opcode == enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI) {
+			const float siValue = value;
+			bytes = QByteArray(reinterpret_cast<const char *>(&siValue), sizeof(siValue));
+		} else if (opcode == enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW) {
+			const qint32 rawValue = qToLittleEndian<qint32>(value);
+			bytes = QByteArray(reinterpret_cast<const char *>(&rawValue), sizeof(rawValue));
+		} else {
+			bytes = QByteArray(1, charOf(value));
+		}
+
+		if (offset + bytes.size() <= reply.size()) {
+			reply.replace(offset, bytes.size(), bytes);
+		}
+	}
+
+	return reply;
+}
@@ -52,6 +52,9 @@ protected:
 	/// Checks that current sensor reading greater, less or so on than target value and stops waiting if reading is ok.
 	void processResponce(int reading, int targetValue);
 
+	/// Forgets the comparison sign read from 'Sign' property, so the next waiting reads it anew.
+	void resetCondition();
+
 	/// Stops waiting and transfers control to a next block.
 	virtual void stop();
 
@@ -72,6 +75,19 @@ private slots:
 
 	void doneNextBlock();
 
+private:
+	enum class Comparison
+	{
+		unknown
+		, equals
+		, greater
+		, less
+		, notLess
+		, notGreater
+		, none
+	};
+
+	Comparison mComparison = Comparison::unknown;
 };
 
 }
@@ -20,7 +20,9 @@ namespace kitBase {
 namespace blocksBase {
 namespace common {
 
-/// A base for all blocks that wait for sensor.
+/// A base for all blocks that wait for sensor. Condition is checked on each reading the sensor emits, whoever
+/// requested it. Sensor variables updater reads sensors used by a program every updating interval of robot model,
+/// so the block reads the sensor itself only when no data came during the same interval.
 class ROBOTS_KIT_BASE_EXPORT WaitForSensorBlock : public WaitBlock
 {
 	Q_OBJECT
@@ -43,6 +45,10 @@ protected:
 
 	robotModel::PortInfo mPort;
 
+private slots:
+	/// Postpones block's own sensor polling and checks the condition on the given reading.
+	void onNewData(const QVariant &reading);
+
 private:
 	/// Disconnect sensor signals/events
 	void disconnectSensor();
@@ -55,6 +55,8 @@ public:
 
 	void updateSensorsValues() const override;
 
+	void updateSensorsValuesOn(const QList<PortInfo> &ports) const override;
+
 	int updateIntervalForInterpretation() const override;
 
 	bool interpretedModel() const override;
@@ -108,6 +108,10 @@ public:
 	/// Requests updates for all configured sensors.
 	virtual void updateSensorsValues() const = 0;
 
+	/// Requests updates only for sensors configured on given ports. Models that can only query all sensors at once
+	/// are allowed to update more than requested.
+	virtual void updateSensorsValuesOn(const QList<PortInfo> &ports) const = 0;
+
 	/// Returns time interval for polling sensors data.
 	virtual int updateIntervalForInterpretation() const = 0;
 
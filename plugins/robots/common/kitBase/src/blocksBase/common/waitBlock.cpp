@@ -43,23 +43,51 @@ void WaitBlock::setFailedStatus()
 
 void WaitBlock::processResponce(int reading, int targetValue)
 {
-	const QString sign = stringProperty("Sign");
-	if (sign == "equals" && reading == targetValue) {
-		stop();
-	} else if (sign == "greater" && reading > targetValue) {
-		stop();
-	} else if (sign == "less" && reading < targetValue) {
-		stop();
-	} else if (sign == "notLess" && reading >= targetValue) {
-		stop();
-	} else if (sign == "notGreater" && reading <= targetValue) {
+	if (mComparison == Comparison::unknown) {
+		const QString sign = stringProperty("Sign");
+		mComparison = sign == "equals" ? Comparison::equals
+				: sign == "greater" ? Comparison::greater
+				: sign == "less" ? Comparison::less
+				: sign == "notLess" ? Comparison::notLess
+				: sign == "notGreater" ? Comparison::notGreater
+				: Comparison::none;
+	}
+
+	bool satisfied = false;
+	switch (mComparison) {
+	case Comparison::equals:
+		satisfied = reading == targetValue;
+		break;
+	case Comparison::greater:
+		satisfied = reading > targetValue;
+		break;
+	case Comparison::less:
+		satisfied = reading < targetValue;
+		break;
+	case Comparison::notLess:
+		satisfied = reading >= targetValue;
+		break;
+	case Comparison::notGreater:
+		satisfied = reading <= targetValue;
+		break;
+	default:
+		break;
+	}
+
+	if (satisfied) {
 		stop();
 	}
 }
 
+void WaitBlock::resetCondition()
+{
+	mComparison = Comparison::unknown;
+}
+
 void WaitBlock::stop()
 {
 	mActiveWaitingTimer->stop();
+	resetCondition();
 	// Emitting done() immediately will switch current block right during SensorVariablesUpdater
 	// doing his job. This may cause bad side effects.
 	QTimer::singleShot(0, this,  SLOT(doneNextBlock()));
@@ -73,12 +101,14 @@ void WaitBlock::doneNextBlock()
 void WaitBlock::failureSlot()
 {
 	mActiveWaitingTimer->stop();
+	resetCondition();
 	emit failure();
 }
 
 void WaitBlock::stopActiveTimerInBlock()
 {
 	mActiveWaitingTimer->stop();
+	resetCondition();
 }
 
 QMap<PortInfo, DeviceInfo> WaitBlock::usedDevices()
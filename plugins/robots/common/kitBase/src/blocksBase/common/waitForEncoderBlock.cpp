@@ -14,8 +14,6 @@
 
 #include "kitBase/blocksBase/common/waitForEncoderBlock.h"
 
-#include <utils/abstractTimer.h>
-
 #include "kitBase/robotModel/robotParts/encoderSensor.h"
 #include "kitBase/robotModel/robotModelUtils.h"
 
@@ -26,7 +24,6 @@ using namespace robotModel;
 WaitForEncoderBlock::WaitForEncoderBlock(RobotModelInterface &robotModel)
 	: WaitForSensorBlock(robotModel)
 {
-	mActiveWaitingTimer->setInterval(1);
 }
 
 void WaitForEncoderBlock::responseSlot(const QVariant &reading)
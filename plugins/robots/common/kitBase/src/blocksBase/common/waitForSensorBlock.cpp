@@ -16,7 +16,7 @@
 
 #include <utils/abstractTimer.h>
 
-#include "kitBase/robotModel/robotParts/scalarSensor.h"
+#include "kitBase/robotModel/robotParts/abstractSensor.h"
 #include "kitBase/robotModel/robotModelUtils.h"
 
 using namespace kitBase;
@@ -26,6 +26,7 @@ using namespace robotModel;
 WaitForSensorBlock::WaitForSensorBlock(RobotModelInterface &robotModel)
 	: WaitBlock(robotModel)
 {
+	mActiveWaitingTimer->setInterval(robotModel.updateIntervalForInterpretation());
 }
 
 void WaitForSensorBlock::run()
@@ -35,8 +36,9 @@ void WaitForSensorBlock::run()
 	mPort = RobotModelUtils::findPort(mRobotModel, port, input);
 	auto const sensor = RobotModelUtils::findDevice<robotParts::AbstractSensor>(mRobotModel, mPort);
 	if (sensor) {
+		resetCondition();
 		mConnections << connect(sensor, &robotParts::AbstractSensor::newData
-								, this, &WaitForSensorBlock::responseSlot, Qt::UniqueConnection);
+								, this, &WaitForSensorBlock::onNewData, Qt::UniqueConnection);
 		mConnections << connect(sensor, &robotParts::AbstractSensor::failure
 								, this, &WaitForSensorBlock::failureSlot, Qt::UniqueConnection);
 		mActiveWaitingTimer->start();
@@ -49,14 +51,19 @@ void WaitForSensorBlock::run()
 
 void WaitForSensorBlock::timerTimeout()
 {
-	/// @todo True horror.
-	robotParts::Device * const device = mRobotModel.configuration().device(mPort);
-	robotParts::ScalarSensor * const sensor = dynamic_cast<robotParts::ScalarSensor *>(device);
+	auto const sensor = RobotModelUtils::findDevice<robotParts::AbstractSensor>(mRobotModel, mPort);
 	if (sensor) {
 		sensor->read();
 	}
 }
 
+void WaitForSensorBlock::onNewData(const QVariant &reading)
+{
+	// Restarting the timer before the check, since a satisfied condition stops it.
+	mActiveWaitingTimer->start();
+	responseSlot(reading);
+}
+
 void WaitForSensorBlock::disconnectSensor()
 {
 	for (auto &&c: mConnections) {
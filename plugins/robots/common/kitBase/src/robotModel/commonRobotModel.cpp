@@ -101,6 +101,19 @@ void CommonRobotModel::updateSensorsValues() const
 	}
 }
 
+void CommonRobotModel::updateSensorsValuesOn(const QList<PortInfo> &ports) const
+{
+	for (const PortInfo &port : ports) {
+		robotParts::AbstractSensor * const sensor = dynamic_cast<robotParts::AbstractSensor *>(
+				mConfiguration.device(port));
+		if (!sensor || !sensor->ready() || sensor->isLocked()) {
+			continue;
+		}
+
+		sensor->read();
+	}
+}
+
 int CommonRobotModel::updateIntervalForInterpretation() const
 {
 	return updateInterval;
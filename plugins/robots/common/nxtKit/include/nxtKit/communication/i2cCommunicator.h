@@ -15,6 +15,10 @@
 #pragma once
 
 #include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QMap>
+#include <QtCore/QQueue>
+#include <QtCore/QTimer>
 
 #include <kitBase/robotModel/portInfo.h>
 #include <utils/robotCommunication/robotCommunicator.h>
@@ -22,24 +26,54 @@
 namespace nxt {
 namespace communication {
 
-class I2CCommunicator
+/// Performs I2C transactions with low-speed sensors without blocking: LSWRITE is sent immediately, then the sensor
+/// status is polled by timer, so regular direct commands may be sent to the brick in between. Transactions on one
+/// port are executed in order, transactions on different ports overlap.
+class I2CCommunicator : public QObject
 {
+	Q_OBJECT
+
 public:
 	explicit I2CCommunicator(utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
+	/// Starts I2C transaction and returns immediately. Response is delivered to \a addressee through
+	/// RobotCommunicator::response() as soon as sensor provides requested bytes, empty response means failure.
 	void sendI2C(QObject *addressee, const QByteArray &buffer
 			, const int responseSize
 			, const kitBase::robotModel::PortInfo &port);
 
+	/// Returns the number of transactions that are started or queued and not finished yet.
+	int pendingTransactions() const;
+
+private slots:
+	/// Checks the status of running transaction on each port, reads responses that are ready and starts
+	/// queued transactions.
+	void poll();
+
 private:
+	struct Transaction
+	{
+		QObject *addressee;
+		QByteArray buffer;
+		int responseSize;
+		QElapsedTimer timer;
+	};
+
 	static const int i2cTimeout = 5000;
+	static const int pollInterval = 10;
 
-	bool waitForI2CBytes(int bytes, const kitBase::robotModel::PortInfo &port);
-	int i2cBytesReady(const kitBase::robotModel::PortInfo &port);
+	/// Sends LSWRITE command that starts given transaction on a given port.
+	void write(char port, Transaction &transaction);
+	int i2cBytesReady(char port);
+	QByteArray read(char port);
 
 	char toNxtInputPort(const kitBase::robotModel::PortInfo &port);
 
 	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
+
+	/// Transactions queued for each port, the head of each queue is running.
+	QMap<char, QQueue<Transaction>> mTransactions;
+	QTimer mPollTimer;
 };
 
 }
@@ -0,0 +1,74 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+
+#include <utils/robotCommunication/robotCommunicationThreadInterface.h>
+
+namespace nxt {
+namespace communication {
+
+/// Stand-in for USB and Bluetooth communication threads that emulates NXT brick in-process. Low-speed (I2C) sensors
+/// answer after a configurable delay: LSGETSTATUS reports no bytes until the delay since the last LSWRITE passes,
+/// then LSREAD returns the data set by setI2CResponse(). Any other direct command is acknowledged with success.
+/// Each round trip may take extra time to emulate link latency.
+class NxtLoopbackCommunicationThread : public utils::robotCommunication::RobotCommunicationThreadInterface
+{
+	Q_OBJECT
+
+public:
+	/// @param latency - time in milliseconds each round trip will take.
+	explicit NxtLoopbackCommunicationThread(int latency = 0);
+
+	/// Sets the data I2C sensor on the given low-level port will answer with and the time in milliseconds it needs
+	/// to prepare the answer after a request.
+	void setI2CResponse(char port, const QByteArray &data, int delay);
+
+	/// Returns codes of direct commands received by the brick since creation, in order.
+	QList<int> receivedCommands() const;
+
+public slots:
+	bool send(QObject *addressee, const QByteArray &buffer, int responseSize) override;
+	bool send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer) override;
+	bool connect() override;
+	void reconnect() override;
+	void disconnect() override;
+	void allowLongJobs(bool allow = true) override;
+
+private:
+	struct I2CSensor
+	{
+		QByteArray data;
+		int delay = 0;
+		QElapsedTimer requestTime;
+	};
+
+	/// Forms a reply with the given command code, status and payload.
+	static QByteArray reply(char commandCode, char status, const QByteArray &payload = QByteArray());
+
+	const int mLatency;
+	QHash<char, I2CSensor> mI2CSensors;
+	QList<int> mReceivedCommands;
+
+	/// Senders and test code may work in different threads.
+	mutable QMutex mMutex;
+};
+
+}
+}
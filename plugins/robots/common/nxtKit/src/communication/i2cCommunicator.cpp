@@ -14,84 +14,104 @@
 
 #include "nxtKit/communication/i2cCommunicator.h"
 
-#include <ctime>
-
 #include "nxtKit/communication/nxtCommandConstants.h"
 
 using namespace nxt::communication;
 
 const unsigned lsGetStatusResponseSize = 6;
+const unsigned lsReadResponseSize = 22;
 
 I2CCommunicator::I2CCommunicator(utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: mRobotCommunicator(robotCommunicator)
 {
+	mPollTimer.setInterval(pollInterval);
+	connect(&mPollTimer, &QTimer::timeout, this, &I2CCommunicator::poll);
 }
 
 void I2CCommunicator::sendI2C(QObject *addressee
 		, const QByteArray &buffer, const int responseSize
 		, const kitBase::robotModel::PortInfo &port)
 {
-	QByteArray command(buffer.length() + 7, 0);
-	command[0] = buffer.length() + 5;
-	command[1] = 0x00;
-	command[2] = enums::telegramType::directCommandNoResponse;
-	command[3] = enums::commandCode::LSWRITE;
-	command[4] = toNxtInputPort(port);
-	command[5] = buffer.length();
-	command[6] = responseSize;
-	for (int i = 0; i < buffer.length(); ++i) {
-		command[i + 7] = buffer[i];
+	const char nxtPort = toNxtInputPort(port);
+	QQueue<Transaction> &queue = mTransactions[nxtPort];
+	queue.enqueue({addressee, buffer, responseSize, QElapsedTimer()});
+	if (queue.size() == 1) {
+		write(nxtPort, queue.head());
 	}
 
-	QByteArray dumpOutput;
-	mRobotCommunicator.send(command, 0, dumpOutput);
+	if (!mPollTimer.isActive()) {
+		mPollTimer.start();
+	}
+}
 
-	if (!waitForI2CBytes(responseSize, port)) {
-		/// @todo: Violates incapsuation
-		emit mRobotCommunicator.response(addressee, QByteArray());
-		return;
+int I2CCommunicator::pendingTransactions() const
+{
+	int result = 0;
+	for (const QQueue<Transaction> &queue : mTransactions) {
+		result += queue.size();
 	}
 
-	if (responseSize > 0) {
-		command.clear();
-		command.resize(5);
+	return result;
+}
+
+void I2CCommunicator::poll()
+{
+	QList<QPair<QObject *, QByteArray>> responses;
+	for (const char port : mTransactions.keys()) {
+		QQueue<Transaction> &queue = mTransactions[port];
+		if (queue.isEmpty()) {
+			continue;
+		}
 
-		command[0] = 0x03;
-		command[1] = 0x00;
-		command[2] = enums::telegramType::directCommandResponseRequired;
-		command[3] = enums::commandCode::LSREAD;
-		command[4] = toNxtInputPort(port);
+		const Transaction &transaction = queue.head();
+		if (i2cBytesReady(port) >= transaction.responseSize) {
+			/// @todo Correctly process empty required response
+			const QByteArray response = transaction.responseSize > 0 ? read(port) : QByteArray(1, 0);
+			responses << qMakePair(transaction.addressee, response);
+		} else if (transaction.timer.hasExpired(i2cTimeout)) {
+			responses << qMakePair(transaction.addressee, QByteArray());
+		} else {
+			continue;
+		}
 
-		QByteArray result;
-		mRobotCommunicator.send(command, 22, result);
+		queue.dequeue();
+		if (!queue.isEmpty()) {
+			write(port, queue.head());
+		}
+	}
 
-		QByteArray decodedResult = result.right(result.length() - 5);
-		/// @todo: Violates incapsuation
-		emit mRobotCommunicator.response(addressee, decodedResult);
-	} else {
-		/// @todo Correctly process empty required response
-		QByteArray result(1, 0);
+	if (pendingTransactions() == 0) {
+		mPollTimer.stop();
+	}
+
+	// Responses are emitted after all ports are processed since receivers may start new transactions right away.
+	for (const QPair<QObject *, QByteArray> &response : responses) {
 		/// @todo: Violates incapsuation
-		emit mRobotCommunicator.response(addressee, result);
+		emit mRobotCommunicator.response(response.first, response.second);
 	}
 }
 
-bool I2CCommunicator::waitForI2CBytes(int bytes, const kitBase::robotModel::PortInfo &port)
+void I2CCommunicator::write(char port, Transaction &transaction)
 {
-	time_t const startTime = clock();
-	do {
-		const int bytesReady = i2cBytesReady(port);
-		QThread::msleep(10);
-		if (clock() - startTime > i2cTimeout) {
-			return false;
-		}
-		if (bytesReady >= bytes) {
-			return true;
-		}
-	} while (true);
+	const QByteArray &buffer = transaction.buffer;
+	QByteArray command(buffer.length() + 7, 0);
+	command[0] = buffer.length() + 5;
+	command[1] = 0x00;
+	command[2] = enums::telegramType::directCommandNoResponse;
+	command[3] = enums::commandCode::LSWRITE;
+	command[4] = port;
+	command[5] = buffer.length();
+	command[6] = transaction.responseSize;
+	for (int i = 0; i < buffer.length(); ++i) {
+		command[i + 7] = buffer[i];
+	}
+
+	QByteArray dumpOutput;
+	mRobotCommunicator.send(command, 0, dumpOutput);
+	transaction.timer.start();
 }
 
-int I2CCommunicator::i2cBytesReady(const kitBase::robotModel::PortInfo &port)
+int I2CCommunicator::i2cBytesReady(char port)
 {
 	QByteArray command(5, 0);
 	command[0] = 0x03;
@@ -99,19 +119,35 @@ int I2CCommunicator::i2cBytesReady(const kitBase::robotModel::PortInfo &port)
 
 	command[2] = enums::telegramType::directCommandResponseRequired;
 	command[3] = enums::commandCode::LSGETSTATUS;
-	command[4] = toNxtInputPort(port);
+	command[4] = port;
 
 	QByteArray result;
 	mRobotCommunicator.send(command, lsGetStatusResponseSize, result);
 
 	// static_cats<int> prevents a warning about operator != ambiguity
-	if (result.isEmpty() || static_cast<int>(result[4]) != enums::errorCode::success) {
+	if (result.size() < static_cast<int>(lsGetStatusResponseSize)
+			|| static_cast<int>(result[4]) != enums::errorCode::success)
+	{
 		return 0;
 	} else {
 		return result[5];
 	}
 }
 
+QByteArray I2CCommunicator::read(char port)
+{
+	QByteArray command(5, 0);
+	command[0] = 0x03;
+	command[1] = 0x00;
+	command[2] = enums::telegramType::directCommandResponseRequired;
+	command[3] = enums::commandCode::LSREAD;
+	command[4] = port;
+
+	QByteArray result;
+	mRobotCommunicator.send(command, lsReadResponseSize, result);
+	return result.right(result.length() - 5);
+}
+
 char I2CCommunicator::toNxtInputPort(const kitBase::robotModel::PortInfo &port)
 {
 	return static_cast<char>(port.name().toInt() - 1);
@@ -0,0 +1,138 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "nxtKit/communication/nxtLoopbackCommunicationThread.h"
+
+#include <QtCore/QThread>
+
+#include "nxtKit/communication/nxtCommandConstants.h"
+
+using namespace nxt::communication;
+
+/// Size of data block in LSREAD reply.
+static const int lsReadDataSize = 16;
+
+NxtLoopbackCommunicationThread::NxtLoopbackCommunicationThread(int latency)
+	: mLatency(latency)
+{
+}
+
+void NxtLoopbackCommunicationThread::setI2CResponse(char port, const QByteArray &data, int delay)
+{
+	QMutexLocker lock(&mMutex);
+	I2CSensor &sensor = mI2CSensors[port];
+	sensor.data = data;
+	sensor.delay = delay;
+}
+
+QList<int> NxtLoopbackCommunicationThread::receivedCommands() const
+{
+	QMutexLocker lock(&mMutex);
+	return mReceivedCommands;
+}
+
+bool NxtLoopbackCommunicationThread::send(QObject *addressee, const QByteArray &buffer, int responseSize)
+{
+	QByteArray outputBuffer;
+	const bool result = send(buffer, responseSize, outputBuffer);
+	emit response(addressee, outputBuffer);
+	return result;
+}
+
+bool NxtLoopbackCommunicationThread::send(const QByteArray &buffer, int responseSize, QByteArray &outputBuffer)
+{
+	if (mLatency > 0) {
+		QThread::msleep(mLatency);
+	}
+
+	if (buffer.size() < 4) {
+		return false;
+	}
+
+	QMutexLocker lock(&mMutex);
+	const char telegramType = buffer[2];
+	const char commandCode = buffer[3];
+	mReceivedCommands << commandCode;
+	const char port = buffer.size() > 4 ? buffer[4] : 0;
+
+	QByteArray result;
+	switch (commandCode) {
+	case enums::commandCode::LSWRITE: {
+		I2CSensor &sensor = mI2CSensors[port];
+		sensor.requestTime.start();
+		result = reply(commandCode, enums::errorCode::success);
+		break;
+	}
+	case enums::commandCode::LSGETSTATUS: {
+		const I2CSensor sensor = mI2CSensors.value(port);
+		const bool ready = sensor.requestTime.isValid() && sensor.requestTime.elapsed() >= sensor.delay;
+		const char status = ready
+				? enums::errorCode::success
+				: enums::errorCode::pendingCommunicationTransactionInProgress;
+		result = reply(commandCode, status, QByteArray(1, ready ? sensor.data.size() : 0));
+		break;
+	}
+	case enums::commandCode::LSREAD: {
+		I2CSensor &sensor = mI2CSensors[port];
+		sensor.requestTime.invalidate();
+		QByteArray data = sensor.data.left(lsReadDataSize);
+		data.prepend(static_cast<char>(data.size()));
+		data.append(QByteArray(lsReadDataSize + 1 - data.size(), 0));
+		result = reply(commandCode, enums::errorCode::success, data);
+		break;
+	}
+	default:
+		result = reply(commandCode, enums::errorCode::success);
+		break;
+	}
+
+	if (telegramType == static_cast<char>(enums::telegramType::directCommandResponseRequired)) {
+		outputBuffer = result.left(responseSize);
+	}
+
+	return true;
+}
+
+bool NxtLoopbackCommunicationThread::connect()
+{
+	emit connected(true, QString());
+	return true;
+}
+
+void NxtLoopbackCommunicationThread::reconnect()
+{
+	connect();
+}
+
+void NxtLoopbackCommunicationThread::disconnect()
+{
+	emit disconnected();
+}
+
+void NxtLoopbackCommunicationThread::allowLongJobs(bool allow)
+{
+	Q_UNUSED(allow)
+}
+
+QByteArray NxtLoopbackCommunicationThread::reply(char commandCode, char status, const QByteArray &payload)
+{
+	QByteArray result(5, 0);
+	result[0] = static_cast<char>(3 + payload.size());
+	result[1] = 0x00;
+	result[2] = enums::telegramType::reply;
+	result[3] = commandCode;
+	result[4] = status;
+	return result + payload;
+}
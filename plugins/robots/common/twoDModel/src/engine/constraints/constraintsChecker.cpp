@@ -120,33 +120,30 @@ void ConstraintsChecker::prepareEvents()
 		connect(&*event, &details::Event::settedUp, this, &ConstraintsChecker::setUpEvent, Qt::UniqueConnection);
 		connect(&*event, &details::Event::dropped, this, &ConstraintsChecker::dropEvent, Qt::UniqueConnection);
 		if (event->isAliveInitially()) {
-			mActiveEvents << &*event;
 			event->setUp();
 		} else {
 			event->drop();
 		}
 	}
-
-	std::sort(mActiveEvents.begin(), mActiveEvents.end()
-			, [](const details::Event *e1, const details::Event *e2) { return e1->id() > e2->id(); });
 }
 
 void ConstraintsChecker::setUpEvent()
 {
+	// Active events are kept sorted by id in descending order, so inserting new one into its place
+	// instead of resorting the whole list each time some event is setted up.
 	if (details::Event * const event = dynamic_cast<details::Event *>(sender())) {
-		if (!mActiveEvents.contains(event)) {
-			mActiveEvents << event;
+		const auto position = std::lower_bound(mActiveEvents.begin(), mActiveEvents.end(), event
+				, [](const details::Event *e1, const details::Event *e2) { return e1->id() > e2->id(); });
+		if (position == mActiveEvents.end() || *position != event) {
+			mActiveEvents.insert(position, event);
 		}
 	}
-
-	std::sort(mActiveEvents.begin(), mActiveEvents.end()
-			, [](const details::Event *e1, const details::Event *e2) { return e1->id() > e2->id(); });
 }
 
 void ConstraintsChecker::dropEvent()
 {
 	if (details::Event * const event = dynamic_cast<details::Event *>(sender())) {
-		mActiveEvents.removeAll(event);
+		mActiveEvents.removeOne(event);
 	}
 }
 
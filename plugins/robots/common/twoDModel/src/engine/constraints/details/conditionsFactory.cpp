@@ -97,19 +97,26 @@ Condition ConditionsFactory::notLess(const Value &leftValue, const Value &rightV
 
 Condition ConditionsFactory::inside(const QString &objectId, const QString &regionId, const QString &objectPoint) const
 {
-	return [this, objectId, regionId, objectPoint]() {
-		if (!mObjects.contains(objectId)) {
+	// Everything that depends only on the program text is resolved once here, not on every check.
+	enum class Mode { center, all, any };
+	const Mode mode = objectPoint == "all" ? Mode::all : objectPoint == "any" ? Mode::any : Mode::center;
+	const QString robotId = objectId.section('.', 0, 0);
+
+	return [this, objectId, regionId, robotId, mode]() {
+		const auto objectIt = mObjects.constFind(objectId);
+		if (objectIt == mObjects.constEnd()) {
 			reportError(QObject::tr("No such object: %1").arg(objectId));
 			return false;
 		}
 
-		if (!mObjects.contains(regionId)) {
+		const auto regionIt = mObjects.constFind(regionId);
+		if (regionIt == mObjects.constEnd()) {
 			reportError(QObject::tr("No such region: %1").arg(regionId));
 			return false;
 		}
 
-		QObject * const object = mObjects[objectId];
-		items::RegionItem * const region = dynamic_cast<items::RegionItem *>(mObjects[regionId]);
+		QObject * const object = objectIt.value();
+		items::RegionItem * const region = dynamic_cast<items::RegionItem *>(regionIt.value());
 
 		if (!region) {
 			reportError(QObject::tr("%1 is not a region").arg(regionId));
@@ -117,21 +124,19 @@ Condition ConditionsFactory::inside(const QString &objectId, const QString &regi
 		}
 
 		if (QGraphicsObject * const graphicsObject = dynamic_cast<QGraphicsObject *>(object)) {
-			if (objectPoint == "all") {
-				return region->mapToScene(region->shape()).contains(
-						graphicsObject->mapToScene(graphicsObject->shape()));
-			} else if (objectPoint == "any") {
-				return region->mapToScene(region->shape()).intersects(
-						graphicsObject->mapToScene(graphicsObject->shape()));
+			if (mode == Mode::all) {
+				return region->sceneShape().contains(graphicsObject->mapToScene(graphicsObject->shape()));
+			} else if (mode == Mode::any) {
+				return region->sceneShape().intersects(graphicsObject->mapToScene(graphicsObject->shape()));
 			}
 			return region->containsItem(graphicsObject);
 		}
 
 		if (model::RobotModel * const robotModel = dynamic_cast<model::RobotModel *>(object)) {
-			if (objectPoint == "all") {
-				return region->mapToScene(region->shape()).contains(robotModel->robotBoundingPath(false));
-			} else if (objectPoint == "any") {
-				return region->mapToScene(region->shape()).intersects(robotModel->robotBoundingPath(false));
+			if (mode == Mode::all) {
+				return region->sceneShape().contains(robotModel->robotBoundingPath(false));
+			} else if (mode == Mode::any) {
+				return region->sceneShape().intersects(robotModel->robotBoundingPath(false));
 			}
 			return region->containsPoint(robotModel->robotCenter());
 		}
@@ -139,24 +144,23 @@ Condition ConditionsFactory::inside(const QString &objectId, const QString &regi
 		if (kitBase::robotModel::robotParts::Device * const device
 				= dynamic_cast<kitBase::robotModel::robotParts::Device *>(object))
 		{
-			const QStringList parts = objectId.split('.');
 			if (objectId.isEmpty()) {
 				return false;
 			}
 
-			const QString robotId = parts[0];
-			if (!mObjects.contains(robotId)) {
+			const auto robotIt = mObjects.constFind(robotId);
+			if (robotIt == mObjects.constEnd()) {
 				return false;
 			}
 
-			if (model::RobotModel * const robotModel = dynamic_cast<model::RobotModel *>(mObjects[robotId])) {
+			if (model::RobotModel * const robotModel = dynamic_cast<model::RobotModel *>(robotIt.value())) {
 				auto deviceShape = robotModel->robotsTransform().map(
 						robotModel->sensorBoundingPath(device->port()));
-				if (objectPoint == "all") {
-					return region->mapToScene(region->shape()).contains(
+				if (mode == Mode::all) {
+					return region->sceneShape().contains(
 							deviceShape.isEmpty() ? robotModel->robotBoundingPath(false) : deviceShape);
-				} else if (objectPoint == "any") {
-					return region->mapToScene(region->shape()).intersects(
+				} else if (mode == Mode::any) {
+					return region->sceneShape().intersects(
 							deviceShape.isEmpty() ? robotModel->robotBoundingPath(false) : deviceShape);
 				}
 				return region->containsPoint(
@@ -15,6 +15,7 @@
 #include "valuesFactory.h"
 
 #include <QtCore/QRect>
+#include <QtCore/QMetaProperty>
 
 #include <qrutils/mathUtils/geometry.h>
 #include <utils/objectsSet.h>
@@ -58,21 +59,19 @@ Value ValuesFactory::stringValue(const QString &value) const
 
 Value ValuesFactory::variableValue(const QString &name) const
 {
-	return [this, name]() {
-		const QStringList parts = name.split('.');
-		if (parts.isEmpty()) {
-			reportError(QObject::tr("Requesting variable value with empty name"));
-			return QVariant();
-		}
-
-		if (!mVariables.contains(parts.first())) {
+	const QStringList parts = name.split('.');
+	const QString variable = parts.first();
+	const QStringList properties = parts.mid(1);
+	return [this, variable, properties]() {
+		const auto it = mVariables.constFind(variable);
+		if (it == mVariables.constEnd()) {
 			// We do not mind the situation when trying to read non-declared varible
 			// because really can`t manage the order in which Qt will call event checking,
 			// so some variables (for example counters) can be checked before setted.
 			return QVariant();
 		}
 
-		return propertyChain(mVariables[parts.first()], parts.mid(1), parts.first());
+		return propertyChain(it.value(), properties, variable);
 	};
 }
 
@@ -90,26 +89,31 @@ Value ValuesFactory::typeOf(const QString &objectId) const
 
 Value ValuesFactory::objectState(const QString &path) const
 {
-	return [this, path]() {
-		const QStringList parts = path.split('.', QString::SkipEmptyParts);
-		if (parts.isEmpty()) {
+	const QStringList parts = path.split('.', QString::SkipEmptyParts);
+	if (parts.isEmpty()) {
+		return [this]() {
 			reportError(QObject::tr("Object path is empty!"));
 			return QVariant();
-		}
+		};
+	}
 
-		QString objectId = parts.first();
-		if (!mObjects.contains(objectId)) {
-			reportError(QObject::tr("No such object: %1").arg(objectId));
-			return QVariant();
-		}
+	// All the object ids that path may start with: "robot1", "robot1.display", "robot1.display.pixels"...
+	QStringList prefixes;
+	for (const QString &part : parts) {
+		prefixes << (prefixes.isEmpty() ? part : prefixes.last() + "." + part);
+	}
 
-		int lastObjectPart = 1;
-		while (lastObjectPart < parts.count() && mObjects.contains(objectId + "." + parts[lastObjectPart])) {
-			objectId += "." + parts[lastObjectPart];
-			++lastObjectPart;
+	QSharedPointer<ObjectBinding> binding(new ObjectBinding);
+	return [this, parts, prefixes, binding]() {
+		if (!isActual(*binding, prefixes)) {
+			bind(*binding, parts, prefixes);
+			if (!binding->isBound) {
+				reportError(QObject::tr("No such object: %1").arg(parts.first()));
+				return QVariant();
+			}
 		}
 
-		return propertyChain(QVariant::fromValue<QObject *>(mObjects[objectId]), parts.mid(lastObjectPart), objectId);
+		return propertyChain(QVariant::fromValue<QObject *>(binding->object), binding->properties);
 	};
 }
 
@@ -190,6 +194,80 @@ Value ValuesFactory::boundingRect(const Value &items) const
 	};
 }
 
+bool ValuesFactory::isActual(const ValuesFactory::ObjectBinding &binding, const QStringList &prefixes) const
+{
+	// Binding stays valid while the same object is registered under the same id
+	// and no object with longer id matching the path appeared.
+	return binding.isBound
+			&& mObjects.value(prefixes[binding.objectParts - 1]) == binding.object
+			&& (binding.objectParts == prefixes.count() || !mObjects.contains(prefixes[binding.objectParts]));
+}
+
+void ValuesFactory::bind(ValuesFactory::ObjectBinding &binding
+		, const QStringList &parts, const QStringList &prefixes) const
+{
+	binding.isBound = false;
+	binding.properties.clear();
+	if (!mObjects.contains(prefixes.first())) {
+		return;
+	}
+
+	int objectParts = 1;
+	while (objectParts < prefixes.count() && mObjects.contains(prefixes[objectParts])) {
+		++objectParts;
+	}
+
+	binding.isBound = true;
+	binding.objectParts = objectParts;
+	binding.object = mObjects[prefixes[objectParts - 1]];
+	for (int i = objectParts; i < parts.count(); ++i) {
+		PropertyAccessor property;
+		property.name = parts[i];
+		property.latin1Name = parts[i].toLatin1();
+		property.objectAlias = prefixes[i - 1];
+		binding.properties << property;
+	}
+}
+
+QVariant ValuesFactory::propertyChain(const QVariant &value
+		, QVector<ValuesFactory::PropertyAccessor> &properties) const
+{
+	QVariant currentValue = value;
+	for (PropertyAccessor &property : properties) {
+		currentValue = propertyOf(currentValue, property);
+		if (!currentValue.isValid()) {
+			return QVariant();
+		}
+	}
+
+	return currentValue;
+}
+
+QVariant ValuesFactory::propertyOf(const QVariant &value, ValuesFactory::PropertyAccessor &property) const
+{
+	if (!value.canConvert<QObject *>()) {
+		return propertyOf(value, property.name, property.objectAlias);
+	}
+
+	const QObject * const object = value.value<QObject *>();
+	if (!object) {
+		return QVariant();
+	}
+
+	const QMetaObject * const metaObject = object->metaObject();
+	if (metaObject != property.metaObject) {
+		property.metaObject = metaObject;
+		property.index = metaObject->indexOfProperty(property.latin1Name.constData());
+	}
+
+	if (property.index < 0) {
+		reportError(QObject::tr("Object \"%1\" has no property \"%2\"").arg(property.objectAlias, property.name));
+		return QVariant();
+	}
+
+	return metaObject->property(property.index).read(object);
+}
+
 QVariant ValuesFactory::propertyChain(const QVariant &value
 		, const QStringList &propertyChain, const QString &objectAlias) const
 {
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <QtCore/QVector>
+
 #include "defines.h"
 
 namespace utils {
@@ -57,6 +59,10 @@ public:
 	/// via Qt reflection.
 	/// If no object found in global map or on some stage object does not contain desired property
 	/// checker error will be emitted.
+	/// The path is splitted once when the functor is produced. The functor remembers the object it was bound to
+	/// and the Qt meta-properties it has read, so subsequent calls do not split the path or search properties by name
+	/// again. Each call still checks the binding with one or two lookups of path prefixes in the objects map, and
+	/// rebinds if the map has changed.
 	Value objectState(const QString &path) const;
 
 	/// Produces functor that returns a number of milliseconds passed from some point (no matter what point).
@@ -98,6 +104,29 @@ public:
 	Value boundingRect(const Value &items) const;
 
 private:
+	/// Property of some object in a chain with cached meta-property index.
+	struct PropertyAccessor
+	{
+		QString name;
+		QByteArray latin1Name;
+		QString objectAlias;
+		const QMetaObject *metaObject {};
+		int index {-1};
+	};
+
+	/// Resolved object path, bound to the object from global objects map.
+	struct ObjectBinding
+	{
+		bool isBound {};
+		int objectParts {};
+		QObject *object {};
+		QVector<PropertyAccessor> properties;
+	};
+
+	bool isActual(const ObjectBinding &binding, const QStringList &prefixes) const;
+	void bind(ObjectBinding &binding, const QStringList &parts, const QStringList &prefixes) const;
+	QVariant propertyChain(const QVariant &value, QVector<PropertyAccessor> &properties) const;
+	QVariant propertyOf(const QVariant &value, PropertyAccessor &property) const;
 	QVariant propertyChain(const QVariant &value, const QStringList &properties, const QString &objectAlias) const;
 	QVariant propertyOf(const QVariant &value, const QString &property, const QString &objectAlias) const;
 	QVariant propertyOf(const QVariant &value, const QString &property
@@ -66,6 +66,11 @@ QRectF BoundRegion::boundingRect() const
 	return mBoundItem.boundingRect().adjusted(-mStroke, -mStroke, mStroke, mStroke);
 }
 
+QPainterPath BoundRegion::sceneShape() const
+{
+	return mapToScene(shape());
+}
+
 QPainterPath BoundRegion::shape() const
 {
 	const QPainterPath originalShape = mBoundItem.shape();
@@ -36,6 +36,10 @@ public:
 
 	QRectF boundingRect() const override;
 
+	/// Bound item may change its shape without changing the geometry of the region itself,
+	/// so the scene shape of bound region is never cached.
+	QPainterPath sceneShape() const override;
+
 private:
 	QPainterPath shape() const override;
 	QString regionType() const override;
@@ -91,6 +91,7 @@ void RegionItem::setColor(const QColor &color)
 void RegionItem::setSize(const QSizeF &size)
 {
 	mSize = size;
+	mSceneShapeValid = false;
 }
 
 bool RegionItem::containsPoint(const QPointF &point) const
@@ -103,6 +104,20 @@ bool RegionItem::containsItem(QGraphicsItem *item) const
 	return containsPoint(item->boundingRect().center() + item->scenePos());
 }
 
+QPainterPath RegionItem::sceneShape() const
+{
+	const QTransform transform = sceneTransform();
+	const QRectF rect = boundingRect();
+	if (!mSceneShapeValid || transform != mSceneShapeTransform || rect != mSceneShapeRect) {
+		mSceneShape = transform.map(shape());
+		mSceneShapeTransform = transform;
+		mSceneShapeRect = rect;
+		mSceneShapeValid = true;
+	}
+
+	return mSceneShape;
+}
+
 QRectF RegionItem::boundingRect() const
 {
 	return QRectF(QPointF(), mSize);
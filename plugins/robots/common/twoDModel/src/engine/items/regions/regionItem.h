@@ -66,6 +66,10 @@ public:
 	/// Returns true if the center of the bounding rect of the given item is contained by this region.
 	bool containsItem(QGraphicsItem *item) const;
 
+	/// Returns the shape of this region in scene coordinates. The result is cached and recalculated only
+	/// when the region is moved or resized, so it is cheap to call it on every timeline tick.
+	virtual QPainterPath sceneShape() const;
+
 	QRectF boundingRect() const override;
 
 	virtual void serialize(QDomElement &element) const;
@@ -86,6 +90,11 @@ private:
 	bool mFilled;
 	QColor mColor;
 	QSizeF mSize;
+
+	mutable QPainterPath mSceneShape;
+	mutable QTransform mSceneShapeTransform;
+	mutable QRectF mSceneShapeRect;
+	mutable bool mSceneShapeValid {};
 };
 
 }
@@ -14,6 +14,8 @@
 #include "box2DPhysicsEngine.h"
 
 #include <box2d/box2d.h>
+#include <qrkernel/settingsManager.h>
+#include <qrkernel/settingsListener.h>
 #include <qrutils/graphicsUtils/abstractItem.h>
 
 #include "twoDModel/engine/model/robotModel.h"
@@ -42,9 +44,12 @@ Box2DPhysicsEngine::Box2DPhysicsEngine (const WorldModel &worldModel
 	: PhysicsEngineBase(worldModel, robots)
 	, mPixelsInCm(worldModel.pixelsInCm() * scaleCoeff)
 	, mWorld(new b2World(b2Vec2(0, 0)))
-	, mPrevPosition(b2Vec2(0, 0))
-	, mPrevAngle(0)
 {
+	reloadStepSettings();
+	qReal::SettingsListener::listen("box2DSubsteps", this, &Box2DPhysicsEngine::reloadStepSettings);
+	qReal::SettingsListener::listen("box2DVelocityIterations", this, &Box2DPhysicsEngine::reloadStepSettings);
+	qReal::SettingsListener::listen("box2DPositionIterations", this, &Box2DPhysicsEngine::reloadStepSettings);
+
 	connect(&worldModel, &model::WorldModel::wallAdded,
 			this, [this](const QSharedPointer<QGraphicsItem> &i) {itemAdded(i.data());});
 	connect(&worldModel, &model::WorldModel::skittleAdded,
@@ -66,7 +71,7 @@ QVector2D Box2DPhysicsEngine::positionShift(model::RobotModel &robot) const
 		return QVector2D();
 	}
 
-	return QVector2D(positionToScene(mBox2DRobots[&robot]->getBody()->GetPosition() - mPrevPosition));
+	return QVector2D(positionToScene(mBox2DRobots[&robot]->getBody()->GetPosition() - mPrevPositions[&robot]));
 }
 
 qreal Box2DPhysicsEngine::rotation(model::RobotModel &robot) const
@@ -75,7 +80,7 @@ qreal Box2DPhysicsEngine::rotation(model::RobotModel &robot) const
 		return 0;
 	}
 
-	return angleToScene(mBox2DRobots[&robot]->getBody()->GetAngle() - mPrevAngle);
+	return angleToScene(mBox2DRobots[&robot]->getBody()->GetAngle() - mPrevAngles[&robot]);
 }
 
 void Box2DPhysicsEngine::onPressedReleasedSelectedItems(bool active)
@@ -98,8 +103,8 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 	PhysicsEngineBase::addRobot(robot);
 	addRobot(robot, robot->robotCenter(), robot->rotation());
 
-	mPrevPosition = mBox2DRobots[robot]->getBody()->GetPosition();
-	mPrevAngle = mBox2DRobots[robot]->getBody()->GetAngle();
+	mPrevPositions[robot] = mBox2DRobots[robot]->getBody()->GetPosition();
+	mPrevAngles[robot] = mBox2DRobots[robot]->getBody()->GetAngle();
 
 	connect(robot, &model::RobotModel::positionChanged, this, [&] (const QPointF &newPos) {
 		onRobotStartPositionChanged(newPos, dynamic_cast<model::RobotModel *>(sender()));
@@ -115,7 +120,7 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 		connect(mScene->robot(*robot), &view::RobotItem::mouseInteractionStopped, this, [=]() {
 			view::RobotItem *rItem = mScene->robot(*robot);
 			if (rItem != nullptr) {
-				onMouseReleased(rItem->pos(), rItem->rotation());
+				onMouseReleased(rItem->pos(), rItem->rotation(), robot);
 			}
 		});
 
@@ -123,7 +128,7 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 				, this, &Box2DPhysicsEngine::onMousePressed);
 
 		connect(mScene->robot(*robot), &view::RobotItem::recoverRobotPosition
-				, this, &Box2DPhysicsEngine::onRecoverRobotPosition);
+				, this, [this, robot](const QPointF &pos) { onRecoverRobotPosition(pos, robot); });
 
 		connect(mScene->robot(*robot), &view::RobotItem::sensorAdded, this, [&](twoDModel::view::SensorItem *sensor) {
 			auto rItem = dynamic_cast<view::RobotItem *>(sender());
@@ -144,7 +149,9 @@ void Box2DPhysicsEngine::addRobot(model::RobotModel * const robot)
 			mBox2DRobots[model]->reinitSensor(sensor);
 		});
 
-		connect(robot, &model::RobotModel::deserialized, this, &Box2DPhysicsEngine::onMouseReleased);
+		connect(robot, &model::RobotModel::deserialized, this, [this, robot](const QPointF &newPos, qreal newAngle) {
+			onMouseReleased(newPos, newAngle, robot);
+		});
 	});
 }
 
@@ -178,13 +185,15 @@ void Box2DPhysicsEngine::onRobotStartAngleChanged(const qreal newAngle, model::R
 	mBox2DRobots[robot]->setRotation(angleToBox2D(newAngle));
 }
 
-void Box2DPhysicsEngine::onMouseReleased(const QPointF &newPos, qreal newAngle)
+void Box2DPhysicsEngine::onMouseReleased(const QPointF &newPos, qreal newAngle, model::RobotModel *robot)
 {
-	Box2DRobot *robot = mBox2DRobots.first();
+	if (!mBox2DRobots.contains(robot)) {
+		return;
+	}
 
-	robot->finishStopping();
-	onRobotStartPositionChanged(newPos, robot->getRobotModel());
-	onRobotStartAngleChanged(newAngle, robot->getRobotModel());
+	mBox2DRobots[robot]->finishStopping();
+	onRobotStartPositionChanged(newPos, robot);
+	onRobotStartAngleChanged(newAngle, robot);
 
 	onPressedReleasedSelectedItems(true);
 }
@@ -198,8 +207,12 @@ void Box2DPhysicsEngine::onMousePressed()
 	onPressedReleasedSelectedItems(false);
 }
 
-void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos)
+void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos, model::RobotModel *robot)
 {
+	if (!mBox2DRobots.contains(robot)) {
+		return;
+	}
+
 	clearForcesAndStop();
 
 	auto stop = [=](b2Body *body){
@@ -207,11 +220,11 @@ void Box2DPhysicsEngine::onRecoverRobotPosition(const QPointF &pos)
 		body->SetLinearVelocity({0, 0});
 	};
 
-	stop(mBox2DRobots.first()->getBody());
-	stop(mBox2DRobots.first()->getWheelAt(0)->getBody());
-	stop(mBox2DRobots.first()->getWheelAt(1)->getBody());
+	stop(mBox2DRobots[robot]->getBody());
+	stop(mBox2DRobots[robot]->getWheelAt(0)->getBody());
+	stop(mBox2DRobots[robot]->getWheelAt(1)->getBody());
 
-	onMouseReleased(pos, mBox2DRobots.keys().first()->startPositionMarker()->rotation());
+	onMouseReleased(pos, robot->startPositionMarker()->rotation(), robot);
 }
 
 void Box2DPhysicsEngine::removeRobot(model::RobotModel * const robot)
@@ -221,23 +234,15 @@ void Box2DPhysicsEngine::removeRobot(model::RobotModel * const robot)
 	mBox2DRobots.remove(robot);
 	mLeftWheels.remove(robot);
 	mRightWheels.remove(robot);
+	mPrevPositions.remove(robot);
+	mPrevAngles.remove(robot);
 }
 
-void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
+void Box2DPhysicsEngine::applyRobotSpeeds(model::RobotModel * const robot, float secondsInterval)
 {
-	const int velocityIterations = 10;
-	const int positionIterations = 6;
-
-	model::RobotModel * const robot = mRobots.first();
-	if (!mBox2DRobots[robot]) {
-		return;
-	}
-
-	b2Body *rBody = mBox2DRobots[robot]->getBody();
-	float secondsInterval = timeInterval / 1000.0f;
-
-	if (mBox2DRobots[robot]->isStopping()){
-		mBox2DRobots[robot]->stop();
+	Box2DRobot * const box2DRobot = mBox2DRobots[robot];
+	if (box2DRobot->isStopping()){
+		box2DRobot->stop();
 	} else {
 		// sAdpt is the speed adaptation coefficient for physics engines
 		const int sAdpt = 10;
@@ -245,7 +250,7 @@ void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 		const qreal speed2 = pxToM(wheelLinearSpeed(*robot, robot->rightWheel())) / secondsInterval * sAdpt;
 
 		if (qAbs(speed1) + qAbs(speed2) < b2_epsilon) {
-			mBox2DRobots[robot]->stop();
+			box2DRobot->stop();
 			mLeftWheels[robot]->stop();
 			mRightWheels[robot]->stop();
 		}
@@ -255,16 +260,45 @@ void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
 		}
 	}
 
-	mPrevPosition = rBody->GetPosition();
-	mPrevAngle = rBody->GetAngle();
+	b2Body * const rBody = box2DRobot->getBody();
+	mPrevPositions[robot] = rBody->GetPosition();
+	mPrevAngles[robot] = rBody->GetAngle();
+}
+
+void Box2DPhysicsEngine::reloadStepSettings()
+{
+	mSubsteps = qMax(1, qReal::SettingsManager::value("box2DSubsteps", 1).toInt());
+	mVelocityIterations = qMax(1, qReal::SettingsManager::value("box2DVelocityIterations", 10).toInt());
+	mPositionIterations = qMax(1, qReal::SettingsManager::value("box2DPositionIterations", 6).toInt());
+}
+
+void Box2DPhysicsEngine::recalculateParameters(qreal timeInterval)
+{
+	if (mBox2DRobots.isEmpty()) {
+		return;
+	}
 
-	mWorld->Step(secondsInterval, velocityIterations, positionIterations);
+	const float secondsInterval = timeInterval / 1000.0f;
+	for (model::RobotModel * const robot : mRobots) {
+		if (mBox2DRobots.value(robot)) {
+			applyRobotSpeeds(robot, secondsInterval);
+		}
+	}
+
+	// All robots share one world, so it is stepped once per tick for all of them.
+	// Wheel impulses are applied once per tick, before the first substep. Later substeps only integrate
+	// the resulting velocities, so they make contacts more stable but do not correct wheel speeds.
+	const float substepInterval = secondsInterval / mSubsteps;
+	for (int i = 0; i < mSubsteps; ++i) {
+		mWorld->Step(substepInterval, mVelocityIterations, mPositionIterations);
+	}
 
 	static volatile auto sThisFlagHelpsToAvoidClangError = true;
 	if ("If you want debug BOX2D, fix this expression to be false" && sThisFlagHelpsToAvoidClangError) {
 		return;
 	}
 
+	model::RobotModel * const robot = mBox2DRobots.firstKey();
 	QPainterPath path;
 
 	for(QGraphicsItem *item : mBox2DDynamicItems.keys()) {
@@ -347,11 +381,14 @@ void Box2DPhysicsEngine::wakeUp()
 
 void Box2DPhysicsEngine::nextFrame()
 {
-	for(QGraphicsItem *item : mBox2DDynamicItems.keys()) {
-		if (mBox2DDynamicItems[item]->getBody()->IsEnabled() && mBox2DDynamicItems[item]->angleOrPositionChanged()) {
-			QPointF scenePos = positionToScene(mBox2DDynamicItems[item]->getPosition());
+	for (auto it = mBox2DDynamicItems.constBegin(); it != mBox2DDynamicItems.constEnd(); ++it) {
+		Box2DItem * const box2DItem = it.value();
+		const b2Body * const body = box2DItem->getBody();
+		if (body->IsEnabled() && box2DItem->angleOrPositionChanged()) {
+			QGraphicsItem * const item = it.key();
+			const QPointF scenePos = positionToScene(box2DItem->getPosition());
 			item->setPos(scenePos - item->boundingRect().center());
-			item->setRotation(angleToScene(mBox2DDynamicItems[item]->getRotation()));
+			item->setRotation(angleToScene(box2DItem->getRotation()));
 		}
 	}
 }
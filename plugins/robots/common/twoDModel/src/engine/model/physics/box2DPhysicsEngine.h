@@ -80,9 +80,9 @@ public slots:
 	void onItemDragged(graphicsUtils::AbstractItem *item);
 	void onRobotStartPositionChanged(const QPointF &newPos, twoDModel::model::RobotModel *robot);
 	void onRobotStartAngleChanged(const qreal newAngle, twoDModel::model::RobotModel *robot);
-	void onMouseReleased(const QPointF &newPos, qreal newAngle);
+	void onMouseReleased(const QPointF &newPos, qreal newAngle, twoDModel::model::RobotModel *robot);
 	void onMousePressed();
-	void onRecoverRobotPosition(const QPointF &pos);
+	void onRecoverRobotPosition(const QPointF &pos, twoDModel::model::RobotModel *robot);
 
 protected:
 	void onPixelsInCmChanged(qreal value) override;
@@ -92,6 +92,12 @@ protected:
 private:
 	void onPressedReleasedSelectedItems(bool active);
 
+	/// Applies wheel speeds of the given robot to its Box2D body before the world step.
+	void applyRobotSpeeds(RobotModel * const robot, float secondsInterval);
+
+	/// Reads fixed substep count and solver iterations from settings.
+	void reloadStepSettings();
+
 	bool itemTracked(QGraphicsItem * const item);
 
 	twoDModel::view::TwoDModelScene *mScene {}; // Doesn't take ownership
@@ -105,8 +111,12 @@ private:
 	QMap<QGraphicsItem *, parts::Box2DItem *> mBox2DDynamicItems;  // Doesn't take ownership
 	QMap<RobotModel *, QSet<twoDModel::view::SensorItem *>> mRobotSensors; // Doesn't take ownership
 
-	b2Vec2 mPrevPosition;
-	float mPrevAngle;
+	QMap<RobotModel *, b2Vec2> mPrevPositions;
+	QMap<RobotModel *, float> mPrevAngles;
+
+	int mSubsteps {1};
+	int mVelocityIterations {10};
+	int mPositionIterations {6};
 };
 
 }
@@ -26,7 +26,7 @@
 			setFriendlyName(QObject::tr("AbstractNode"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr(""));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/AbstractNodeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/AbstractNodeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -61,7 +61,7 @@
 			setFriendlyName(QObject::tr("Clear Screen"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Clears everything drawn on the robot`s screen."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/ClearScreenClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/ClearScreenClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -104,7 +104,7 @@
 			label_1->setHard(true);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/CommentBlockClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/CommentBlockClass.sdf");
 			setSize(QSizeF(200, 100));
 			initProperties();
 			setMouseGesture("");
@@ -274,7 +274,7 @@
 			setFriendlyName(QObject::tr("End if"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Unites control flow from different condition branches."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/FiBlockClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/FiBlockClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -309,7 +309,7 @@
 			setFriendlyName(QObject::tr("Final Node"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("The final node of the program. If the program consists of some parallel execution lines the reachment of this block terminates the corresponding execution line. This block can`t have outgoing links."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/FinalNodeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/FinalNodeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("13, 200 : 198, 15 :  | 12, 12 : 198, 198 : ");
@@ -344,7 +344,7 @@
 			setFriendlyName(QObject::tr("Fork"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Separates program execution into a number of threads that will be executed concurrently from the programmers`s point of view. For example in such way signal from sensor and some time interval can be waited synchroniously. This block must have at least two outgoing links. 'Guard' property of every link must contain unique thread identifiers, and one of those identifiers must be the same as the identifier of a thread where fork is placed (it must be 'main' if it is the first fork in a program."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/ForkClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/ForkClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("13, 86 : 231, 86 :  | 12, 12 : 231, 12 : ");
@@ -387,7 +387,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Expression:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/FunctionClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/FunctionClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("58, 12 : 58, 172 :  | 58, 12 : 148, 12 :  | 12, 96 : 108, 96 "
@@ -440,7 +440,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Wait:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GetButtonCodeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/GetButtonCodeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -485,7 +485,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Condition:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/IfBlockClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/IfBlockClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("96, 182 : 180, 94 :  | 98, 12 : 180, 94 :  | 12, 98 : 96, 182"
@@ -522,7 +522,7 @@
 			setFriendlyName(QObject::tr("Initial Node"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("The entry point of the program execution. Each diagram should have only one such block, it must not have incomming links and it must have only one outgoing link. The interpretation process starts from exactly this block."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/InitialNodeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/InitialNodeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("210, 111 : 209, 120 : 208, 130 : 205, 139 : 202, 148 : 198, 1"
@@ -589,7 +589,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Text:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/InputClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/InputClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -627,7 +627,7 @@
 			setFriendlyName(QObject::tr("Join"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Joins a number of threads into one. 'Guard' property of the single outgoing link must contain an identifier of one of threads being joined. The specified thread would wait until the rest of them finish execution, and then proceed in a normal way."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/JoinClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/JoinClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -670,7 +670,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Thread:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/KillThreadClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/KillThreadClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -714,7 +714,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Iterations:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/LoopClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/LoopClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("154, 251 : 205, 302 :  | 154, 251 : 209, 196 :  | 100, 12 : 1"
@@ -760,7 +760,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Color:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/MarkerDownClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/MarkerDownClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -796,7 +796,7 @@
 			setFriendlyName(QObject::tr("Marker Up"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Lifts the marker of the 2D model robot up: the robot stops drawing its trace on the floor after that."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/MarkerUpClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/MarkerUpClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -839,7 +839,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Condition:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PreconditionalLoopClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PreconditionalLoopClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("0, 0 : 50, 300 : 100, 150 : 150, 300 : 200, 0");
@@ -899,7 +899,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Text:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PrintTextClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PrintTextClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -963,7 +963,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("To:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/RandomizerClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/RandomizerClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1017,7 +1017,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Synchronized:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/ReceiveMessageThreadsClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/ReceiveMessageThreadsClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1076,7 +1076,7 @@
 			label_1->setHard(false);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/RobotsDiagramNodeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/RobotsDiagramNodeClass.sdf");
 			setSize(QSizeF(204, 204));
 			initProperties();
 			setMouseGesture("");
@@ -1128,7 +1128,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Message:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/SendMessageThreadsClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/SendMessageThreadsClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1172,7 +1172,7 @@
 			label_1->setHard(true);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/SubprogramClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/SubprogramClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1214,7 +1214,7 @@
 			label_1->setHard(false);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/SubprogramDiagramClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/SubprogramDiagramClass.sdf");
 			setSize(QSizeF(204, 204));
 			initProperties();
 			setMouseGesture("");
@@ -1272,7 +1272,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Expression:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/SwitchBlockClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/SwitchBlockClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1317,7 +1317,7 @@
 			label_1->setPrefix(QObject::tr("Delay:"));
 			label_1->setSuffix(QObject::tr("ms"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TimerClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TimerClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 117 : 117, 118 :  | 117, 12 : 117, 118 :  | 222, 117 : 22"
@@ -1378,7 +1378,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Value:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/VariableInitClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/VariableInitClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -42,67 +42,99 @@ void RobotsMetamodelPlugin::initPlugin()
 
 void RobotsMetamodelPlugin::initMultigraph()
 {
-	mMetamodel->addNode(new AbstractNode(*mMetamodel));
-	mMetamodel->addNode(new ClearScreen(*mMetamodel));
-	mMetamodel->addNode(new CommentBlock(*mMetamodel));
-	mMetamodel->addNode(new ControlFlow(*mMetamodel));
-	mMetamodel->addNode(new EngineCommand(*mMetamodel));
-	mMetamodel->addNode(new EngineMovementCommand(*mMetamodel));
-	mMetamodel->addNode(new FiBlock(*mMetamodel));
-	mMetamodel->addNode(new FinalNode(*mMetamodel));
-	mMetamodel->addNode(new Fork(*mMetamodel));
-	mMetamodel->addNode(new Function(*mMetamodel));
-	mMetamodel->addNode(new GetButtonCode(*mMetamodel));
-	mMetamodel->addNode(new IfBlock(*mMetamodel));
-	mMetamodel->addNode(new InitialNode(*mMetamodel));
-	mMetamodel->addNode(new Input(*mMetamodel));
-	mMetamodel->addNode(new Join(*mMetamodel));
-	mMetamodel->addNode(new KillThread(*mMetamodel));
-	mMetamodel->addNode(new Loop(*mMetamodel));
-	mMetamodel->addNode(new MarkerDown(*mMetamodel));
-	mMetamodel->addNode(new MarkerUp(*mMetamodel));
-	mMetamodel->addNode(new PreconditionalLoop(*mMetamodel));
-	mMetamodel->addNode(new PrintText(*mMetamodel));
-	mMetamodel->addNode(new Randomizer(*mMetamodel));
-	mMetamodel->addNode(new ReceiveMessageThreads(*mMetamodel));
-	mMetamodel->addNode(new RobotsDiagramGroup(*mMetamodel));
-	mMetamodel->addNode(new RobotsDiagramNode(*mMetamodel));
-	mMetamodel->addNode(new SendMessageThreads(*mMetamodel));
-	mMetamodel->addNode(new Subprogram(*mMetamodel));
-	mMetamodel->addNode(new SubprogramDiagram(*mMetamodel));
-	mMetamodel->addNode(new SubprogramDiagramGroup(*mMetamodel));
-	mMetamodel->addNode(new SwitchBlock(*mMetamodel));
-	mMetamodel->addNode(new Timer(*mMetamodel));
-	mMetamodel->addNode(new VariableInit(*mMetamodel));
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "ClearScreen"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "CommentBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "EngineCommand"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "EngineMovementCommand"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "FiBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "FinalNode"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Fork"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Function"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "GetButtonCode"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "IfBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "InitialNode"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Input"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Join"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "KillThread"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Loop"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "MarkerDown"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "MarkerUp"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PreconditionalLoop"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PrintText"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Randomizer"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "ReceiveMessageThreads"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "RobotsDiagramNode"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::containmentLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "SendMessageThreads"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Subprogram"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->addExplosion(mMetamodel->elementType("RobotsDiagram", "Subprogram"), mMetamodel->elementType("RobotsDiagram", "SubprogramDiagramGroup"), true, true);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "SubprogramDiagram"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::containmentLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "SwitchBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Timer"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "VariableInit"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	qReal::ElementType * const typeAbstractNode = new AbstractNode(*mMetamodel);
+	mMetamodel->addNode(typeAbstractNode);
+	qReal::ElementType * const typeClearScreen = new ClearScreen(*mMetamodel);
+	mMetamodel->addNode(typeClearScreen);
+	qReal::ElementType * const typeCommentBlock = new CommentBlock(*mMetamodel);
+	mMetamodel->addNode(typeCommentBlock);
+	qReal::ElementType * const typeControlFlow = new ControlFlow(*mMetamodel);
+	mMetamodel->addNode(typeControlFlow);
+	qReal::ElementType * const typeEngineCommand = new EngineCommand(*mMetamodel);
+	mMetamodel->addNode(typeEngineCommand);
+	qReal::ElementType * const typeEngineMovementCommand = new EngineMovementCommand(*mMetamodel);
+	mMetamodel->addNode(typeEngineMovementCommand);
+	qReal::ElementType * const typeFiBlock = new FiBlock(*mMetamodel);
+	mMetamodel->addNode(typeFiBlock);
+	qReal::ElementType * const typeFinalNode = new FinalNode(*mMetamodel);
+	mMetamodel->addNode(typeFinalNode);
+	qReal::ElementType * const typeFork = new Fork(*mMetamodel);
+	mMetamodel->addNode(typeFork);
+	qReal::ElementType * const typeFunction = new Function(*mMetamodel);
+	mMetamodel->addNode(typeFunction);
+	qReal::ElementType * const typeGetButtonCode = new GetButtonCode(*mMetamodel);
+	mMetamodel->addNode(typeGetButtonCode);
+	qReal::ElementType * const typeIfBlock = new IfBlock(*mMetamodel);
+	mMetamodel->addNode(typeIfBlock);
+	qReal::ElementType * const typeInitialNode = new InitialNode(*mMetamodel);
+	mMetamodel->addNode(typeInitialNode);
+	qReal::ElementType * const typeInput = new Input(*mMetamodel);
+	mMetamodel->addNode(typeInput);
+	qReal::ElementType * const typeJoin = new Join(*mMetamodel);
+	mMetamodel->addNode(typeJoin);
+	qReal::ElementType * const typeKillThread = new KillThread(*mMetamodel);
+	mMetamodel->addNode(typeKillThread);
+	qReal::ElementType * const typeLoop = new Loop(*mMetamodel);
+	mMetamodel->addNode(typeLoop);
+	qReal::ElementType * const typeMarkerDown = new MarkerDown(*mMetamodel);
+	mMetamodel->addNode(typeMarkerDown);
+	qReal::ElementType * const typeMarkerUp = new MarkerUp(*mMetamodel);
+	mMetamodel->addNode(typeMarkerUp);
+	qReal::ElementType * const typePreconditionalLoop = new PreconditionalLoop(*mMetamodel);
+	mMetamodel->addNode(typePreconditionalLoop);
+	qReal::ElementType * const typePrintText = new PrintText(*mMetamodel);
+	mMetamodel->addNode(typePrintText);
+	qReal::ElementType * const typeRandomizer = new Randomizer(*mMetamodel);
+	mMetamodel->addNode(typeRandomizer);
+	qReal::ElementType * const typeReceiveMessageThreads = new ReceiveMessageThreads(*mMetamodel);
+	mMetamodel->addNode(typeReceiveMessageThreads);
+	qReal::ElementType * const typeRobotsDiagramGroup = new RobotsDiagramGroup(*mMetamodel);
+	mMetamodel->addNode(typeRobotsDiagramGroup);
+	qReal::ElementType * const typeRobotsDiagramNode = new RobotsDiagramNode(*mMetamodel);
+	mMetamodel->addNode(typeRobotsDiagramNode);
+	qReal::ElementType * const typeSendMessageThreads = new SendMessageThreads(*mMetamodel);
+	mMetamodel->addNode(typeSendMessageThreads);
+	qReal::ElementType * const typeSubprogram = new Subprogram(*mMetamodel);
+	mMetamodel->addNode(typeSubprogram);
+	qReal::ElementType * const typeSubprogramDiagram = new SubprogramDiagram(*mMetamodel);
+	mMetamodel->addNode(typeSubprogramDiagram);
+	qReal::ElementType * const typeSubprogramDiagramGroup = new SubprogramDiagramGroup(*mMetamodel);
+	mMetamodel->addNode(typeSubprogramDiagramGroup);
+	qReal::ElementType * const typeSwitchBlock = new SwitchBlock(*mMetamodel);
+	mMetamodel->addNode(typeSwitchBlock);
+	qReal::ElementType * const typeTimer = new Timer(*mMetamodel);
+	mMetamodel->addNode(typeTimer);
+	qReal::ElementType * const typeVariableInit = new VariableInit(*mMetamodel);
+	mMetamodel->addNode(typeVariableInit);
+	mMetamodel->produceEdge(*typeClearScreen, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeCommentBlock, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEngineCommand, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEngineMovementCommand, *typeEngineCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeFiBlock, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeFinalNode, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeFork, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeFunction, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeGetButtonCode, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeIfBlock, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeInitialNode, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeInput, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeJoin, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeKillThread, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeLoop, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeMarkerDown, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeMarkerUp, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePreconditionalLoop, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePrintText, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeRandomizer, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeReceiveMessageThreads, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeRobotsDiagramNode, *typeAbstractNode, qReal::ElementType::containmentLinkType);
+	mMetamodel->produceEdge(*typeSendMessageThreads, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeSubprogram, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->addExplosion(*typeSubprogram, *typeSubprogramDiagramGroup, true, true);
+	mMetamodel->produceEdge(*typeSubprogramDiagram, *typeAbstractNode, qReal::ElementType::containmentLinkType);
+	mMetamodel->produceEdge(*typeSwitchBlock, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTimer, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeVariableInit, *typeAbstractNode, qReal::ElementType::generalizationLinkType);
 }
 
 void RobotsMetamodelPlugin::initNameMap()
@@ -42,7 +42,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Wait for Completion:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3BeepClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3BeepClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("152, 12 : 281, 12 :  | 152, 183 : 152, 12 :  | 155, 170 : 154"
@@ -96,7 +96,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3CalibrateBlackLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3CalibrateBlackLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -140,7 +140,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3CalibrateGyroscopeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3CalibrateGyroscopeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -240,7 +240,7 @@
 			label_8->setPlainTextMode(false);
 			label_8->setPrefix(QObject::tr("D factor:"));
 			addLabel(label_8);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3CalibratePIDLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3CalibratePIDLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -291,7 +291,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3CalibrateWhiteLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3CalibrateWhiteLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -335,7 +335,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3ClearEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3ClearEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("112, 176 : 78, 142 :  | 112, 176 : 148, 140 :  | 112, 33 : 11"
@@ -404,7 +404,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Filled:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3DrawCircleClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3DrawCircleClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -476,7 +476,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Y2:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3DrawLineClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3DrawLineClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -532,7 +532,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Y:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3DrawPixelClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3DrawPixelClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -610,7 +610,7 @@
 			label_5->setPlainTextMode(false);
 			label_5->setPrefix(QObject::tr("Filled:"));
 			addLabel(label_5);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3DrawRectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3DrawRectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -703,7 +703,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Power:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3EnginesBackwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3EnginesBackwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("111, 224 : 0, 113 :  | 113, 0 : 0, 113 :  | 0, 113 : 287, 113"
@@ -757,7 +757,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Power:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3EnginesForwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3EnginesForwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("185, 207 : 287, 105 :  | 287, 105 : 182, 0 :  | 0, 105 : 287,"
@@ -803,7 +803,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3EnginesStopClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3EnginesStopClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("49, 117 : 185, 117 :  | 223, 118 : 222, 128 : 221, 138 : 218,"
@@ -856,7 +856,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Color:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3LedClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3LedClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("70, 79 : 70, 121 :  | 25, 78 : 25, 122 :  | 12, 12 : 86, 12 :"
@@ -928,7 +928,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Wait for Completion:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3PlayToneClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3PlayToneClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("130, 62 : 130, 146 :  | 106, 0 : 106, 212 :  | 0, 106 : 106, "
@@ -984,7 +984,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Array:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3ReadAllLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3ReadAllLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1037,7 +1037,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3ReadAvrLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3ReadAvrLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1106,7 +1106,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("B Variable:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3ReadRGBClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3ReadRGBClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1161,7 +1161,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3ReadSteeringLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3ReadSteeringLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1230,7 +1230,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Mailbox name:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3SendMailClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3SendMailClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1312,7 +1312,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3SleepLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3SleepLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1356,7 +1356,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3StartCompassCalibrationClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3StartCompassCalibrationClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1408,7 +1408,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3StopCompassCalibrationClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3StopCompassCalibrationClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1453,7 +1453,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Button:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForButtonClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForButtonClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1505,7 +1505,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Color:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForColorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForColorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("196, 12 : 196, 154 :  | 12, 12 : 380, 12 : 380, 154 : 12, 154"
@@ -1567,7 +1567,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForColorIntensityClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForColorIntensityClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("201, 137 : 200, 143 : 199, 149 : 198, 154 : 196, 160 : 193, 1"
@@ -1646,7 +1646,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("203, 211 : 168, 176 :  | 203, 211 : 240, 174 :  | 12, 48 : 50"
@@ -1709,7 +1709,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForGyroscopeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForGyroscopeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("101, 106 : 212, 106 :  | 156, 183 : 156, 107 :  | 12, 183 : 1"
@@ -1772,7 +1772,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForLightClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForLightClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("249, 220 : 349, 220 :  | 130, 12 : 130, 102 :  | 249, 221 : 2"
@@ -1851,7 +1851,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Synchronized:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForReceivingMailClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForReceivingMailClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1915,7 +1915,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForSonarDistanceClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForSonarDistanceClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("190, 162 : 219, 122 :  | 219, 122 : 190, 86 :  | 120, 122 : 2"
@@ -1979,7 +1979,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForSoundClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForSoundClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 178 : 117, 178 :  | 117, 96 : 117, 178 :  | 13, 96 : 117,"
@@ -2026,7 +2026,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WaitForTouchSensorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WaitForTouchSensorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 123 : 174, 123 :  | 174, 12 : 358, 12 : 358, 234 : 174, 2"
@@ -2071,7 +2071,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/Ev3WakeUpLLClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/Ev3WakeUpLLClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
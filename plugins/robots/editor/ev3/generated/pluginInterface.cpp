@@ -42,78 +42,114 @@ void Ev3MetamodelPlugin::initPlugin()
 
 void Ev3MetamodelPlugin::initMultigraph()
 {
-	mMetamodel->addNode(new Ev3Beep(*mMetamodel));
-	mMetamodel->addNode(new Ev3CalibrateBlackLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3CalibrateGyroscope(*mMetamodel));
-	mMetamodel->addNode(new Ev3CalibratePIDLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3CalibrateWhiteLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3ClearEncoder(*mMetamodel));
-	mMetamodel->addNode(new Ev3DrawCircle(*mMetamodel));
-	mMetamodel->addNode(new Ev3DrawLine(*mMetamodel));
-	mMetamodel->addNode(new Ev3DrawPixel(*mMetamodel));
-	mMetamodel->addNode(new Ev3DrawRect(*mMetamodel));
-	mMetamodel->addNode(new Ev3EngineMovementCommand(*mMetamodel));
-	mMetamodel->addNode(new Ev3EnginesBackward(*mMetamodel));
-	mMetamodel->addNode(new Ev3EnginesForward(*mMetamodel));
-	mMetamodel->addNode(new Ev3EnginesStop(*mMetamodel));
-	mMetamodel->addNode(new Ev3Led(*mMetamodel));
-	mMetamodel->addNode(new Ev3PlayTone(*mMetamodel));
-	mMetamodel->addNode(new Ev3ReadAllLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3ReadAvrLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3ReadRGB(*mMetamodel));
-	mMetamodel->addNode(new Ev3ReadSteeringLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3SendMail(*mMetamodel));
-	mMetamodel->addNode(new Ev3SensorBlock(*mMetamodel));
-	mMetamodel->addNode(new Ev3SleepLL(*mMetamodel));
-	mMetamodel->addNode(new Ev3StartCompassCalibration(*mMetamodel));
-	mMetamodel->addNode(new Ev3StopCompassCalibration(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForButton(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForColor(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForColorIntensity(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForEncoder(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForGyroscope(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForLight(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForReceivingMail(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForSonarDistance(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForSound(*mMetamodel));
-	mMetamodel->addNode(new Ev3WaitForTouchSensor(*mMetamodel));
-	mMetamodel->addNode(new Ev3WakeUpLL(*mMetamodel));
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3Beep"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3CalibrateBlackLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3CalibrateGyroscope"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3CalibratePIDLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3CalibrateWhiteLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3ClearEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3DrawCircle"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3DrawLine"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3DrawPixel"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3DrawRect"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3EngineMovementCommand"), mMetamodel->elementType("RobotsDiagram", "EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3EnginesBackward"), mMetamodel->elementType("RobotsDiagram", "Ev3EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3EnginesForward"), mMetamodel->elementType("RobotsDiagram", "Ev3EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3EnginesStop"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3Led"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3PlayTone"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3ReadAllLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3ReadAvrLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3ReadRGB"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3ReadSteeringLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3SendMail"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3SleepLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3StartCompassCalibration"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3StopCompassCalibration"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForButton"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForColor"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForColorIntensity"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForGyroscope"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForLight"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForReceivingMail"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForSonarDistance"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForSound"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WaitForTouchSensor"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "Ev3WakeUpLL"), mMetamodel->elementType("RobotsDiagram", "Ev3SensorBlock"), qReal::ElementType::generalizationLinkType);
+	qReal::ElementType * const typeEv3Beep = new Ev3Beep(*mMetamodel);
+	mMetamodel->addNode(typeEv3Beep);
+	qReal::ElementType * const typeEv3CalibrateBlackLL = new Ev3CalibrateBlackLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3CalibrateBlackLL);
+	qReal::ElementType * const typeEv3CalibrateGyroscope = new Ev3CalibrateGyroscope(*mMetamodel);
+	mMetamodel->addNode(typeEv3CalibrateGyroscope);
+	qReal::ElementType * const typeEv3CalibratePIDLL = new Ev3CalibratePIDLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3CalibratePIDLL);
+	qReal::ElementType * const typeEv3CalibrateWhiteLL = new Ev3CalibrateWhiteLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3CalibrateWhiteLL);
+	qReal::ElementType * const typeEv3ClearEncoder = new Ev3ClearEncoder(*mMetamodel);
+	mMetamodel->addNode(typeEv3ClearEncoder);
+	qReal::ElementType * const typeEv3DrawCircle = new Ev3DrawCircle(*mMetamodel);
+	mMetamodel->addNode(typeEv3DrawCircle);
+	qReal::ElementType * const typeEv3DrawLine = new Ev3DrawLine(*mMetamodel);
+	mMetamodel->addNode(typeEv3DrawLine);
+	qReal::ElementType * const typeEv3DrawPixel = new Ev3DrawPixel(*mMetamodel);
+	mMetamodel->addNode(typeEv3DrawPixel);
+	qReal::ElementType * const typeEv3DrawRect = new Ev3DrawRect(*mMetamodel);
+	mMetamodel->addNode(typeEv3DrawRect);
+	qReal::ElementType * const typeEv3EngineMovementCommand = new Ev3EngineMovementCommand(*mMetamodel);
+	mMetamodel->addNode(typeEv3EngineMovementCommand);
+	qReal::ElementType * const typeEv3EnginesBackward = new Ev3EnginesBackward(*mMetamodel);
+	mMetamodel->addNode(typeEv3EnginesBackward);
+	qReal::ElementType * const typeEv3EnginesForward = new Ev3EnginesForward(*mMetamodel);
+	mMetamodel->addNode(typeEv3EnginesForward);
+	qReal::ElementType * const typeEv3EnginesStop = new Ev3EnginesStop(*mMetamodel);
+	mMetamodel->addNode(typeEv3EnginesStop);
+	qReal::ElementType * const typeEv3Led = new Ev3Led(*mMetamodel);
+	mMetamodel->addNode(typeEv3Led);
+	qReal::ElementType * const typeEv3PlayTone = new Ev3PlayTone(*mMetamodel);
+	mMetamodel->addNode(typeEv3PlayTone);
+	qReal::ElementType * const typeEv3ReadAllLL = new Ev3ReadAllLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3ReadAllLL);
+	qReal::ElementType * const typeEv3ReadAvrLL = new Ev3ReadAvrLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3ReadAvrLL);
+	qReal::ElementType * const typeEv3ReadRGB = new Ev3ReadRGB(*mMetamodel);
+	mMetamodel->addNode(typeEv3ReadRGB);
+	qReal::ElementType * const typeEv3ReadSteeringLL = new Ev3ReadSteeringLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3ReadSteeringLL);
+	qReal::ElementType * const typeEv3SendMail = new Ev3SendMail(*mMetamodel);
+	mMetamodel->addNode(typeEv3SendMail);
+	qReal::ElementType * const typeEv3SensorBlock = new Ev3SensorBlock(*mMetamodel);
+	mMetamodel->addNode(typeEv3SensorBlock);
+	qReal::ElementType * const typeEv3SleepLL = new Ev3SleepLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3SleepLL);
+	qReal::ElementType * const typeEv3StartCompassCalibration = new Ev3StartCompassCalibration(*mMetamodel);
+	mMetamodel->addNode(typeEv3StartCompassCalibration);
+	qReal::ElementType * const typeEv3StopCompassCalibration = new Ev3StopCompassCalibration(*mMetamodel);
+	mMetamodel->addNode(typeEv3StopCompassCalibration);
+	qReal::ElementType * const typeEv3WaitForButton = new Ev3WaitForButton(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForButton);
+	qReal::ElementType * const typeEv3WaitForColor = new Ev3WaitForColor(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForColor);
+	qReal::ElementType * const typeEv3WaitForColorIntensity = new Ev3WaitForColorIntensity(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForColorIntensity);
+	qReal::ElementType * const typeEv3WaitForEncoder = new Ev3WaitForEncoder(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForEncoder);
+	qReal::ElementType * const typeEv3WaitForGyroscope = new Ev3WaitForGyroscope(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForGyroscope);
+	qReal::ElementType * const typeEv3WaitForLight = new Ev3WaitForLight(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForLight);
+	qReal::ElementType * const typeEv3WaitForReceivingMail = new Ev3WaitForReceivingMail(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForReceivingMail);
+	qReal::ElementType * const typeEv3WaitForSonarDistance = new Ev3WaitForSonarDistance(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForSonarDistance);
+	qReal::ElementType * const typeEv3WaitForSound = new Ev3WaitForSound(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForSound);
+	qReal::ElementType * const typeEv3WaitForTouchSensor = new Ev3WaitForTouchSensor(*mMetamodel);
+	mMetamodel->addNode(typeEv3WaitForTouchSensor);
+	qReal::ElementType * const typeEv3WakeUpLL = new Ev3WakeUpLL(*mMetamodel);
+	mMetamodel->addNode(typeEv3WakeUpLL);
+	mMetamodel->produceEdge(*typeEv3Beep, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3CalibrateBlackLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3CalibrateGyroscope, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3CalibratePIDLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3CalibrateWhiteLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3ClearEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3DrawCircle, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3DrawLine, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3DrawPixel, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3DrawRect, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3EngineMovementCommand, mMetamodel->elementType("RobotsDiagram", "EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3EnginesBackward, *typeEv3EngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3EnginesForward, *typeEv3EngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3EnginesStop, mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3Led, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3PlayTone, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3ReadAllLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3ReadAvrLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3ReadRGB, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3ReadSteeringLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3SendMail, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3SensorBlock, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3SleepLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3StartCompassCalibration, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3StopCompassCalibration, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForButton, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForColor, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForColorIntensity, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForGyroscope, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForLight, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForReceivingMail, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForSonarDistance, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForSound, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WaitForTouchSensor, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeEv3WakeUpLL, *typeEv3SensorBlock, qReal::ElementType::generalizationLinkType);
 }
 
 void Ev3MetamodelPlugin::initNameMap()
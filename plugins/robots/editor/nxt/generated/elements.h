@@ -42,7 +42,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Wait for Completion:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtBeepClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtBeepClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("152, 12 : 281, 12 :  | 152, 183 : 152, 12 :  | 155, 170 : 154"
@@ -96,7 +96,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtClearEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtClearEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("112, 176 : 78, 142 :  | 112, 176 : 148, 140 :  | 112, 33 : 11"
@@ -157,7 +157,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Radius:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtDrawCircleClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtDrawCircleClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -228,7 +228,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Y2:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtDrawLineClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtDrawLineClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -284,7 +284,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Y:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtDrawPixelClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtDrawPixelClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -354,7 +354,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Height:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtDrawRectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtDrawRectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -448,7 +448,7 @@
 			label_2->setPrefix(QObject::tr("Power:"));
 			label_2->setSuffix(QObject::tr("%"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtEnginesBackwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtEnginesBackwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("111, 224 : 0, 113 :  | 113, 0 : 0, 113 :  | 0, 113 : 287, 113"
@@ -504,7 +504,7 @@
 			label_2->setPrefix(QObject::tr("Power:"));
 			label_2->setSuffix(QObject::tr("%"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtEnginesForwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtEnginesForwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("185, 207 : 287, 105 :  | 287, 105 : 182, 0 :  | 0, 105 : 287,"
@@ -551,7 +551,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtEnginesStopClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtEnginesStopClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("49, 117 : 185, 117 :  | 223, 118 : 222, 128 : 221, 138 : 218,"
@@ -630,7 +630,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Wait for Completion:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtPlayToneClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtPlayToneClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("130, 62 : 130, 146 :  | 106, 0 : 106, 212 :  | 0, 106 : 106, "
@@ -713,7 +713,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Button:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForButtonClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForButtonClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -765,7 +765,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Color:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForColorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForColorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("196, 12 : 196, 154 :  | 12, 12 : 380, 12 : 380, 154 : 12, 154"
@@ -827,7 +827,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForColorIntensityClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForColorIntensityClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("201, 137 : 200, 143 : 199, 149 : 198, 154 : 196, 160 : 193, 1"
@@ -906,7 +906,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("203, 211 : 168, 176 :  | 203, 211 : 240, 174 :  | 12, 48 : 50"
@@ -969,7 +969,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForLightClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForLightClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("249, 220 : 349, 220 :  | 130, 12 : 130, 102 :  | 249, 221 : 2"
@@ -1041,7 +1041,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForSonarDistanceClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForSonarDistanceClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("190, 162 : 219, 122 :  | 219, 122 : 190, 86 :  | 120, 122 : 2"
@@ -1105,7 +1105,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForSoundClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForSoundClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 178 : 117, 178 :  | 117, 96 : 117, 178 :  | 13, 96 : 117,"
@@ -1152,7 +1152,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/NxtWaitForTouchSensorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/NxtWaitForTouchSensorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 123 : 174, 123 :  | 174, 12 : 358, 12 : 358, 234 : 174, 2"
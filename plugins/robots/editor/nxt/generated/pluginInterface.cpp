@@ -42,35 +42,55 @@ void NxtMetamodelPlugin::initPlugin()
 
 void NxtMetamodelPlugin::initMultigraph()
 {
-	mMetamodel->addNode(new NxtBeep(*mMetamodel));
-	mMetamodel->addNode(new NxtClearEncoder(*mMetamodel));
-	mMetamodel->addNode(new NxtDrawCircle(*mMetamodel));
-	mMetamodel->addNode(new NxtDrawLine(*mMetamodel));
-	mMetamodel->addNode(new NxtDrawPixel(*mMetamodel));
-	mMetamodel->addNode(new NxtDrawRect(*mMetamodel));
-	mMetamodel->addNode(new NxtEngineMovementCommand(*mMetamodel));
-	mMetamodel->addNode(new NxtEnginesBackward(*mMetamodel));
-	mMetamodel->addNode(new NxtEnginesForward(*mMetamodel));
-	mMetamodel->addNode(new NxtEnginesStop(*mMetamodel));
-	mMetamodel->addNode(new NxtPlayTone(*mMetamodel));
-	mMetamodel->addNode(new NxtSensorBlock(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForButton(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForColor(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForColorIntensity(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForEncoder(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForLight(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForSonarDistance(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForSound(*mMetamodel));
-	mMetamodel->addNode(new NxtWaitForTouchSensor(*mMetamodel));
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtEnginesBackward"), mMetamodel->elementType("RobotsDiagram", "NxtEngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtEnginesForward"), mMetamodel->elementType("RobotsDiagram", "NxtEngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtEnginesStop"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForColor"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForColorIntensity"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForLight"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForSonarDistance"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForSound"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "NxtWaitForTouchSensor"), mMetamodel->elementType("RobotsDiagram", "NxtSensorBlock"), qReal::ElementType::generalizationLinkType);
+	qReal::ElementType * const typeNxtBeep = new NxtBeep(*mMetamodel);
+	mMetamodel->addNode(typeNxtBeep);
+	qReal::ElementType * const typeNxtClearEncoder = new NxtClearEncoder(*mMetamodel);
+	mMetamodel->addNode(typeNxtClearEncoder);
+	qReal::ElementType * const typeNxtDrawCircle = new NxtDrawCircle(*mMetamodel);
+	mMetamodel->addNode(typeNxtDrawCircle);
+	qReal::ElementType * const typeNxtDrawLine = new NxtDrawLine(*mMetamodel);
+	mMetamodel->addNode(typeNxtDrawLine);
+	qReal::ElementType * const typeNxtDrawPixel = new NxtDrawPixel(*mMetamodel);
+	mMetamodel->addNode(typeNxtDrawPixel);
+	qReal::ElementType * const typeNxtDrawRect = new NxtDrawRect(*mMetamodel);
+	mMetamodel->addNode(typeNxtDrawRect);
+	qReal::ElementType * const typeNxtEngineMovementCommand = new NxtEngineMovementCommand(*mMetamodel);
+	mMetamodel->addNode(typeNxtEngineMovementCommand);
+	qReal::ElementType * const typeNxtEnginesBackward = new NxtEnginesBackward(*mMetamodel);
+	mMetamodel->addNode(typeNxtEnginesBackward);
+	qReal::ElementType * const typeNxtEnginesForward = new NxtEnginesForward(*mMetamodel);
+	mMetamodel->addNode(typeNxtEnginesForward);
+	qReal::ElementType * const typeNxtEnginesStop = new NxtEnginesStop(*mMetamodel);
+	mMetamodel->addNode(typeNxtEnginesStop);
+	qReal::ElementType * const typeNxtPlayTone = new NxtPlayTone(*mMetamodel);
+	mMetamodel->addNode(typeNxtPlayTone);
+	qReal::ElementType * const typeNxtSensorBlock = new NxtSensorBlock(*mMetamodel);
+	mMetamodel->addNode(typeNxtSensorBlock);
+	qReal::ElementType * const typeNxtWaitForButton = new NxtWaitForButton(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForButton);
+	qReal::ElementType * const typeNxtWaitForColor = new NxtWaitForColor(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForColor);
+	qReal::ElementType * const typeNxtWaitForColorIntensity = new NxtWaitForColorIntensity(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForColorIntensity);
+	qReal::ElementType * const typeNxtWaitForEncoder = new NxtWaitForEncoder(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForEncoder);
+	qReal::ElementType * const typeNxtWaitForLight = new NxtWaitForLight(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForLight);
+	qReal::ElementType * const typeNxtWaitForSonarDistance = new NxtWaitForSonarDistance(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForSonarDistance);
+	qReal::ElementType * const typeNxtWaitForSound = new NxtWaitForSound(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForSound);
+	qReal::ElementType * const typeNxtWaitForTouchSensor = new NxtWaitForTouchSensor(*mMetamodel);
+	mMetamodel->addNode(typeNxtWaitForTouchSensor);
+	mMetamodel->produceEdge(*typeNxtEnginesBackward, *typeNxtEngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtEnginesForward, *typeNxtEngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtEnginesStop, mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForColor, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForColorIntensity, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForLight, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForSonarDistance, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForSound, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeNxtWaitForTouchSensor, *typeNxtSensorBlock, qReal::ElementType::generalizationLinkType);
 }
 
 void NxtMetamodelPlugin::initNameMap()
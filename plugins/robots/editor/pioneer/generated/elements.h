@@ -26,7 +26,7 @@
 			setFriendlyName(QObject::tr("Landing"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to land."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GeoLandingClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/GeoLandingClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -61,7 +61,7 @@
 			setFriendlyName(QObject::tr("Takeoff"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Orders quadcopter to takeoff."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GeoTakeoffClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/GeoTakeoffClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -120,7 +120,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Altitude:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GoToGPSPointClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/GoToGPSPointClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -190,7 +190,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Time:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/GoToPointClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/GoToPointClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("185, 207 : 287, 105 :  | 287, 105 : 182, 0 :  | 0, 105 : 287,"
@@ -262,7 +262,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Mode:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGPIOInitClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGPIOInitClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -325,7 +325,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Z:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetAccelClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetAccelClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -387,7 +387,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Z:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetGyroClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetGyroClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -449,7 +449,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Z:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetLPSPositionClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetLPSPositionClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -511,7 +511,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Z:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetLPSVelocityClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetLPSVelocityClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -557,7 +557,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Yaw:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetLPSYawClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetLPSYawClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -617,7 +617,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Azimuth:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerGetOrientationClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerGetOrientationClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -687,7 +687,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Blue:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerLedClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerLedClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("70, 79 : 70, 121 :  | 25, 78 : 25, 122 :  | 12, 12 : 86, 12 :"
@@ -727,7 +727,7 @@
 			setFriendlyName(QObject::tr("Magnet"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Controls magnet on a quadcopter."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerMagnetClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerMagnetClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -771,7 +771,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Text:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerPrintClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerPrintClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -824,7 +824,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerReadGPIOClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerReadGPIOClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -869,7 +869,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerReadRangeSensorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerReadRangeSensorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("190, 162 : 219, 122 :  | 219, 122 : 190, 86 :  | 120, 122 : 2"
@@ -915,7 +915,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Pin name:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerSetGPIOClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerSetGPIOClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -960,7 +960,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Command:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerSystemClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerSystemClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1005,7 +1005,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Angle:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/PioneerYawClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/PioneerYawClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -42,44 +42,63 @@ void PioneerMetamodelPlugin::initPlugin()
 
 void PioneerMetamodelPlugin::initMultigraph()
 {
-	mMetamodel->addNode(new GeoLanding(*mMetamodel));
-	mMetamodel->addNode(new GeoTakeoff(*mMetamodel));
-	mMetamodel->addNode(new GoToGPSPoint(*mMetamodel));
-	mMetamodel->addNode(new GoToPoint(*mMetamodel));
-	mMetamodel->addNode(new PioneerGPIOInit(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetAccel(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetGyro(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetLPSPosition(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetLPSVelocity(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetLPSYaw(*mMetamodel));
-	mMetamodel->addNode(new PioneerGetOrientation(*mMetamodel));
-	mMetamodel->addNode(new PioneerLed(*mMetamodel));
-	mMetamodel->addNode(new PioneerMagnet(*mMetamodel));
-	mMetamodel->addNode(new PioneerPrint(*mMetamodel));
-	mMetamodel->addNode(new PioneerReadGPIO(*mMetamodel));
-	mMetamodel->addNode(new PioneerReadRangeSensor(*mMetamodel));
-	mMetamodel->addNode(new PioneerSetGPIO(*mMetamodel));
-	mMetamodel->addNode(new PioneerSystem(*mMetamodel));
-	mMetamodel->addNode(new PioneerYaw(*mMetamodel));
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "GeoLanding"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "GeoTakeoff"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "GoToGPSPoint"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "GoToPoint"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGPIOInit"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetAccel"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetGyro"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetLPSPosition"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetLPSVelocity"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetLPSYaw"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerGetOrientation"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerLed"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerMagnet"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerPrint"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerReadGPIO"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerReadRangeSensor"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerSetGPIO"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerSystem"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "PioneerYaw"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	qReal::ElementType * const typeGeoLanding = new GeoLanding(*mMetamodel);
+	mMetamodel->addNode(typeGeoLanding);
+	qReal::ElementType * const typeGeoTakeoff = new GeoTakeoff(*mMetamodel);
+	mMetamodel->addNode(typeGeoTakeoff);
+	qReal::ElementType * const typeGoToGPSPoint = new GoToGPSPoint(*mMetamodel);
+	mMetamodel->addNode(typeGoToGPSPoint);
+	qReal::ElementType * const typeGoToPoint = new GoToPoint(*mMetamodel);
+	mMetamodel->addNode(typeGoToPoint);
+	qReal::ElementType * const typePioneerGPIOInit = new PioneerGPIOInit(*mMetamodel);
+	mMetamodel->addNode(typePioneerGPIOInit);
+	qReal::ElementType * const typePioneerGetAccel = new PioneerGetAccel(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetAccel);
+	qReal::ElementType * const typePioneerGetGyro = new PioneerGetGyro(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetGyro);
+	qReal::ElementType * const typePioneerGetLPSPosition = new PioneerGetLPSPosition(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetLPSPosition);
+	qReal::ElementType * const typePioneerGetLPSVelocity = new PioneerGetLPSVelocity(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetLPSVelocity);
+	qReal::ElementType * const typePioneerGetLPSYaw = new PioneerGetLPSYaw(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetLPSYaw);
+	qReal::ElementType * const typePioneerGetOrientation = new PioneerGetOrientation(*mMetamodel);
+	mMetamodel->addNode(typePioneerGetOrientation);
+	qReal::ElementType * const typePioneerLed = new PioneerLed(*mMetamodel);
+	mMetamodel->addNode(typePioneerLed);
+	qReal::ElementType * const typePioneerMagnet = new PioneerMagnet(*mMetamodel);
+	mMetamodel->addNode(typePioneerMagnet);
+	qReal::ElementType * const typePioneerPrint = new PioneerPrint(*mMetamodel);
+	mMetamodel->addNode(typePioneerPrint);
+	qReal::ElementType * const typePioneerReadGPIO = new PioneerReadGPIO(*mMetamodel);
+	mMetamodel->addNode(typePioneerReadGPIO);
+	qReal::ElementType * const typePioneerReadRangeSensor = new PioneerReadRangeSensor(*mMetamodel);
+	mMetamodel->addNode(typePioneerReadRangeSensor);
+	qReal::ElementType * const typePioneerSetGPIO = new PioneerSetGPIO(*mMetamodel);
+	mMetamodel->addNode(typePioneerSetGPIO);
+	qReal::ElementType * const typePioneerSystem = new PioneerSystem(*mMetamodel);
+	mMetamodel->addNode(typePioneerSystem);
+	qReal::ElementType * const typePioneerYaw = new PioneerYaw(*mMetamodel);
+	mMetamodel->addNode(typePioneerYaw);
+	mMetamodel->produceEdge(*typeGeoLanding, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeGeoTakeoff, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeGoToGPSPoint, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeGoToPoint, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGPIOInit, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetAccel, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetGyro, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetLPSPosition, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetLPSVelocity, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetLPSYaw, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerGetOrientation, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerLed, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerMagnet, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerPrint, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerReadGPIO, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerReadRangeSensor, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerSetGPIO, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerSystem, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typePioneerYaw, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
 }
 
 void PioneerMetamodelPlugin::initNameMap()
@@ -78,7 +78,7 @@
 			label_2->setPrefix(QObject::tr("Angle:"));
 			label_2->setSuffix(QObject::tr("°"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikAngularServoClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikAngularServoClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -115,7 +115,7 @@
 			setFriendlyName(QObject::tr("Calibrate gyroscope"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Sets gyroscope's angle to zero in current position."));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikCalibrateGyroscopeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikCalibrateGyroscopeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -165,7 +165,7 @@
 			label_2->setHard(false);
 			label_2->setPlainTextMode(false);
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDetectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDetectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -216,7 +216,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDetectorToVariableClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDetectorToVariableClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -335,7 +335,7 @@
 			label_6->setPlainTextMode(false);
 			label_6->setPrefix(QObject::tr("Span Angle:"));
 			addLabel(label_6);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDrawArcClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDrawArcClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -409,7 +409,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Height:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDrawEllipseClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDrawEllipseClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -482,7 +482,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Y2:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDrawLineClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDrawLineClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -538,7 +538,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Y:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDrawPixelClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDrawPixelClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -608,7 +608,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Height:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikDrawRectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikDrawRectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -664,7 +664,7 @@
 			label_2->setHard(false);
 			label_2->setPlainTextMode(false);
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikInitCameraClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikInitCameraClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -708,7 +708,7 @@
 			label_1->setHard(false);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikInitVideoStreamingClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikInitVideoStreamingClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -753,7 +753,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Color:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikLedClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikLedClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("70, 79 : 70, 121 :  | 25, 78 : 25, 122 :  | 12, 12 : 86, 12 :"
@@ -798,7 +798,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("File name:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikPlayToneClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikPlayToneClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("130, 62 : 130, 146 :  | 106, 0 : 106, 212 :  | 0, 106 : 106, "
@@ -853,7 +853,7 @@
 			label_2->setPrefix(QObject::tr("Duration:"));
 			label_2->setSuffix(QObject::tr("ms"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikPlayToneHzClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikPlayToneHzClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -922,7 +922,7 @@
 			label_4->setPlainTextMode(false);
 			label_4->setPrefix(QObject::tr("Font size:"));
 			addLabel(label_4);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikPrintTextClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikPrintTextClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -971,7 +971,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Variable:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikReadLidarClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikReadLidarClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1015,7 +1015,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("File:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikRemoveFileClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikRemoveFileClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1051,7 +1051,7 @@
 			setFriendlyName(QObject::tr("Sad Smile"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a sad smile on the robot`s screen :("));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSadSmileClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSadSmileClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("156, 91 : 173, 110 :  | 115, 73 : 156, 91 :  | 78, 73 : 114, "
@@ -1096,7 +1096,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Text:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSayClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSayClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1149,7 +1149,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Hull number:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSendMessageClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSendMessageClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1228,7 +1228,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Color:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSetBackgroundClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSetBackgroundClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1273,7 +1273,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Color:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSetPainterColorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSetPainterColorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1317,7 +1317,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Width:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSetPainterWidthClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSetPainterWidthClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1353,7 +1353,7 @@
 			setFriendlyName(QObject::tr("Smile"));
 			setDiagram("RobotsDiagram");
 			setDescription(QObject::tr("Draws a smile on the robot`s screen :)"));
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSmileClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSmileClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("161, 71 : 166, 57 :  | 149, 82 : 161, 70 :  | 113, 91 : 149, "
@@ -1405,7 +1405,7 @@
 			label_2->setHard(false);
 			label_2->setPlainTextMode(false);
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikStopCameraClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikStopCameraClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1448,7 +1448,7 @@
 			label_1->setHard(false);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikStopVideoStreamingClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikStopVideoStreamingClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1491,7 +1491,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Command:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikSystemClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikSystemClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1546,7 +1546,7 @@
 			label_2->setPrefix(QObject::tr("Angle:"));
 			label_2->setSuffix(QObject::tr("°"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV62AngularServoClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV62AngularServoClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -1591,7 +1591,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV62ClearEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV62ClearEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("112, 176 : 78, 142 :  | 112, 176 : 148, 140 :  | 112, 33 : 11"
@@ -1652,7 +1652,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV62WaitForEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV62WaitForEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("203, 211 : 168, 176 :  | 203, 211 : 240, 174 :  | 12, 48 : 50"
@@ -1699,7 +1699,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV6ClearEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV6ClearEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("112, 176 : 78, 142 :  | 112, 176 : 148, 140 :  | 112, 33 : 11"
@@ -1789,7 +1789,7 @@
 			label_2->setPrefix(QObject::tr("Power:"));
 			label_2->setSuffix(QObject::tr("%"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV6EnginesBackwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV6EnginesBackwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("111, 224 : 0, 113 :  | 113, 0 : 0, 113 :  | 0, 113 : 287, 113"
@@ -1844,7 +1844,7 @@
 			label_2->setPrefix(QObject::tr("Power:"));
 			label_2->setSuffix(QObject::tr("%"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV6EnginesForwardClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV6EnginesForwardClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("185, 207 : 287, 105 :  | 287, 105 : 182, 0 :  | 0, 105 : 287,"
@@ -1890,7 +1890,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Ports:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikV6EnginesStopClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikV6EnginesStopClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("49, 117 : 185, 117 :  | 223, 118 : 222, 128 : 221, 138 : 218,"
@@ -1959,7 +1959,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Axis:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForAccelerometerClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForAccelerometerClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2005,7 +2005,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Button:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForButtonClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForButtonClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2065,7 +2065,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForEncoderClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForEncoderClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("203, 211 : 168, 176 :  | 203, 211 : 240, 174 :  | 12, 48 : 50"
@@ -2120,7 +2120,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForGyroscopeClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForGyroscopeClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("101, 106 : 212, 106 :  | 156, 183 : 156, 107 :  | 12, 183 : 1"
@@ -2182,7 +2182,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForIRDistanceClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForIRDistanceClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("190, 162 : 219, 122 :  | 219, 122 : 190, 86 :  | 120, 122 : 2"
@@ -2246,7 +2246,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForLightClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForLightClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("249, 220 : 349, 220 :  | 130, 12 : 130, 102 :  | 249, 221 : 2"
@@ -2309,7 +2309,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Synchronized:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForMessageClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForMessageClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2354,7 +2354,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForMotionClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForMotionClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2413,7 +2413,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForSonarDistanceClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForSonarDistanceClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2459,7 +2459,7 @@
 			label_1->setPlainTextMode(false);
 			label_1->setPrefix(QObject::tr("Port:"));
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitForTouchSensorClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitForTouchSensorClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("12, 123 : 174, 123 :  | 174, 12 : 358, 12 : 358, 234 : 174, 2"
@@ -2511,7 +2511,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Button:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitGamepadButtonClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitGamepadButtonClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2554,7 +2554,7 @@
 			label_1->setHard(true);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitGamepadConnectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitGamepadConnectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2596,7 +2596,7 @@
 			label_1->setHard(true);
 			label_1->setPlainTextMode(false);
 			addLabel(label_1);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitGamepadDisconnectClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitGamepadDisconnectClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2654,7 +2654,7 @@
 			label_3->setPlainTextMode(false);
 			label_3->setPrefix(QObject::tr("Sign:"));
 			addLabel(label_3);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitGamepadWheelClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitGamepadWheelClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2706,7 +2706,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Pad:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWaitPadPressClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWaitPadPressClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
@@ -2758,7 +2758,7 @@
 			label_2->setPlainTextMode(false);
 			label_2->setPrefix(QObject::tr("Text:"));
 			addLabel(label_2);
-			loadSdf(utils::xmlUtils::loadDocument(":/generated/shapes/TrikWriteToFileClass.sdf").documentElement());
+			setSdfPath(":/generated/shapes/TrikWriteToFileClass.sdf");
 			setSize(QSizeF(50, 50));
 			initProperties();
 			setMouseGesture("");
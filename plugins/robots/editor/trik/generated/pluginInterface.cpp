@@ -42,114 +42,168 @@ void TrikMetamodelPlugin::initPlugin()
 
 void TrikMetamodelPlugin::initMultigraph()
 {
-	mMetamodel->addNode(new TrikAnalogSensorBlock(*mMetamodel));
-	mMetamodel->addNode(new TrikAngularServo(*mMetamodel));
-	mMetamodel->addNode(new TrikCalibrateGyroscope(*mMetamodel));
-	mMetamodel->addNode(new TrikDetect(*mMetamodel));
-	mMetamodel->addNode(new TrikDetectorToVariable(*mMetamodel));
-	mMetamodel->addNode(new TrikDigitalSensorBlock(*mMetamodel));
-	mMetamodel->addNode(new TrikDrawArc(*mMetamodel));
-	mMetamodel->addNode(new TrikDrawEllipse(*mMetamodel));
-	mMetamodel->addNode(new TrikDrawLine(*mMetamodel));
-	mMetamodel->addNode(new TrikDrawPixel(*mMetamodel));
-	mMetamodel->addNode(new TrikDrawRect(*mMetamodel));
-	mMetamodel->addNode(new TrikInitCamera(*mMetamodel));
-	mMetamodel->addNode(new TrikInitVideoStreaming(*mMetamodel));
-	mMetamodel->addNode(new TrikLed(*mMetamodel));
-	mMetamodel->addNode(new TrikPlayTone(*mMetamodel));
-	mMetamodel->addNode(new TrikPlayToneHz(*mMetamodel));
-	mMetamodel->addNode(new TrikPrintText(*mMetamodel));
-	mMetamodel->addNode(new TrikReadLidar(*mMetamodel));
-	mMetamodel->addNode(new TrikRemoveFile(*mMetamodel));
-	mMetamodel->addNode(new TrikSadSmile(*mMetamodel));
-	mMetamodel->addNode(new TrikSay(*mMetamodel));
-	mMetamodel->addNode(new TrikSendMessage(*mMetamodel));
-	mMetamodel->addNode(new TrikSensorBlock(*mMetamodel));
-	mMetamodel->addNode(new TrikSetBackground(*mMetamodel));
-	mMetamodel->addNode(new TrikSetPainterColor(*mMetamodel));
-	mMetamodel->addNode(new TrikSetPainterWidth(*mMetamodel));
-	mMetamodel->addNode(new TrikSmile(*mMetamodel));
-	mMetamodel->addNode(new TrikStopCamera(*mMetamodel));
-	mMetamodel->addNode(new TrikStopVideoStreaming(*mMetamodel));
-	mMetamodel->addNode(new TrikSystem(*mMetamodel));
-	mMetamodel->addNode(new TrikV62AngularServo(*mMetamodel));
-	mMetamodel->addNode(new TrikV62ClearEncoder(*mMetamodel));
-	mMetamodel->addNode(new TrikV62WaitForEncoder(*mMetamodel));
-	mMetamodel->addNode(new TrikV6ClearEncoder(*mMetamodel));
-	mMetamodel->addNode(new TrikV6EngineMovementCommand(*mMetamodel));
-	mMetamodel->addNode(new TrikV6EnginesBackward(*mMetamodel));
-	mMetamodel->addNode(new TrikV6EnginesForward(*mMetamodel));
-	mMetamodel->addNode(new TrikV6EnginesStop(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForAccelerometer(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForButton(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForEncoder(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForGyroscope(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForIRDistance(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForLight(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForMessage(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForMotion(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForSonarDistance(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitForTouchSensor(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitGamepadButton(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitGamepadConnect(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitGamepadDisconnect(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitGamepadWheel(*mMetamodel));
-	mMetamodel->addNode(new TrikWaitPadPress(*mMetamodel));
-	mMetamodel->addNode(new TrikWriteToFile(*mMetamodel));
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikAnalogSensorBlock"), mMetamodel->elementType("RobotsDiagram", "TrikSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikAngularServo"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikCalibrateGyroscope"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDetect"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDetectorToVariable"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDigitalSensorBlock"), mMetamodel->elementType("RobotsDiagram", "TrikSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDrawArc"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDrawEllipse"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDrawLine"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDrawPixel"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikDrawRect"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikInitCamera"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikInitVideoStreaming"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikLed"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikPlayTone"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikPlayToneHz"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikPrintText"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikReadLidar"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikRemoveFile"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSadSmile"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSay"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSendMessage"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSensorBlock"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSetBackground"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSetPainterColor"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSetPainterWidth"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSmile"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikStopCamera"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikStopVideoStreaming"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikSystem"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV62AngularServo"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV62ClearEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV62WaitForEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV6ClearEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV6EngineMovementCommand"), mMetamodel->elementType("RobotsDiagram", "EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV6EnginesBackward"), mMetamodel->elementType("RobotsDiagram", "TrikV6EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV6EnginesForward"), mMetamodel->elementType("RobotsDiagram", "TrikV6EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikV6EnginesStop"), mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForAccelerometer"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForButton"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForEncoder"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForGyroscope"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForIRDistance"), mMetamodel->elementType("RobotsDiagram", "TrikAnalogSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForLight"), mMetamodel->elementType("RobotsDiagram", "TrikAnalogSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForMessage"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForMotion"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForSonarDistance"), mMetamodel->elementType("RobotsDiagram", "TrikDigitalSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitForTouchSensor"), mMetamodel->elementType("RobotsDiagram", "TrikAnalogSensorBlock"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitGamepadButton"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitGamepadConnect"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitGamepadDisconnect"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitGamepadWheel"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWaitPadPress"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
-	mMetamodel->produceEdge(mMetamodel->elementType("RobotsDiagram", "TrikWriteToFile"), mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	qReal::ElementType * const typeTrikAnalogSensorBlock = new TrikAnalogSensorBlock(*mMetamodel);
+	mMetamodel->addNode(typeTrikAnalogSensorBlock);
+	qReal::ElementType * const typeTrikAngularServo = new TrikAngularServo(*mMetamodel);
+	mMetamodel->addNode(typeTrikAngularServo);
+	qReal::ElementType * const typeTrikCalibrateGyroscope = new TrikCalibrateGyroscope(*mMetamodel);
+	mMetamodel->addNode(typeTrikCalibrateGyroscope);
+	qReal::ElementType * const typeTrikDetect = new TrikDetect(*mMetamodel);
+	mMetamodel->addNode(typeTrikDetect);
+	qReal::ElementType * const typeTrikDetectorToVariable = new TrikDetectorToVariable(*mMetamodel);
+	mMetamodel->addNode(typeTrikDetectorToVariable);
+	qReal::ElementType * const typeTrikDigitalSensorBlock = new TrikDigitalSensorBlock(*mMetamodel);
+	mMetamodel->addNode(typeTrikDigitalSensorBlock);
+	qReal::ElementType * const typeTrikDrawArc = new TrikDrawArc(*mMetamodel);
+	mMetamodel->addNode(typeTrikDrawArc);
+	qReal::ElementType * const typeTrikDrawEllipse = new TrikDrawEllipse(*mMetamodel);
+	mMetamodel->addNode(typeTrikDrawEllipse);
+	qReal::ElementType * const typeTrikDrawLine = new TrikDrawLine(*mMetamodel);
+	mMetamodel->addNode(typeTrikDrawLine);
+	qReal::ElementType * const typeTrikDrawPixel = new TrikDrawPixel(*mMetamodel);
+	mMetamodel->addNode(typeTrikDrawPixel);
+	qReal::ElementType * const typeTrikDrawRect = new TrikDrawRect(*mMetamodel);
+	mMetamodel->addNode(typeTrikDrawRect);
+	qReal::ElementType * const typeTrikInitCamera = new TrikInitCamera(*mMetamodel);
+	mMetamodel->addNode(typeTrikInitCamera);
+	qReal::ElementType * const typeTrikInitVideoStreaming = new TrikInitVideoStreaming(*mMetamodel);
+	mMetamodel->addNode(typeTrikInitVideoStreaming);
+	qReal::ElementType * const typeTrikLed = new TrikLed(*mMetamodel);
+	mMetamodel->addNode(typeTrikLed);
+	qReal::ElementType * const typeTrikPlayTone = new TrikPlayTone(*mMetamodel);
+	mMetamodel->addNode(typeTrikPlayTone);
+	qReal::ElementType * const typeTrikPlayToneHz = new TrikPlayToneHz(*mMetamodel);
+	mMetamodel->addNode(typeTrikPlayToneHz);
+	qReal::ElementType * const typeTrikPrintText = new TrikPrintText(*mMetamodel);
+	mMetamodel->addNode(typeTrikPrintText);
+	qReal::ElementType * const typeTrikReadLidar = new TrikReadLidar(*mMetamodel);
+	mMetamodel->addNode(typeTrikReadLidar);
+	qReal::ElementType * const typeTrikRemoveFile = new TrikRemoveFile(*mMetamodel);
+	mMetamodel->addNode(typeTrikRemoveFile);
+	qReal::ElementType * const typeTrikSadSmile = new TrikSadSmile(*mMetamodel);
+	mMetamodel->addNode(typeTrikSadSmile);
+	qReal::ElementType * const typeTrikSay = new TrikSay(*mMetamodel);
+	mMetamodel->addNode(typeTrikSay);
+	qReal::ElementType * const typeTrikSendMessage = new TrikSendMessage(*mMetamodel);
+	mMetamodel->addNode(typeTrikSendMessage);
+	qReal::ElementType * const typeTrikSensorBlock = new TrikSensorBlock(*mMetamodel);
+	mMetamodel->addNode(typeTrikSensorBlock);
+	qReal::ElementType * const typeTrikSetBackground = new TrikSetBackground(*mMetamodel);
+	mMetamodel->addNode(typeTrikSetBackground);
+	qReal::ElementType * const typeTrikSetPainterColor = new TrikSetPainterColor(*mMetamodel);
+	mMetamodel->addNode(typeTrikSetPainterColor);
+	qReal::ElementType * const typeTrikSetPainterWidth = new TrikSetPainterWidth(*mMetamodel);
+	mMetamodel->addNode(typeTrikSetPainterWidth);
+	qReal::ElementType * const typeTrikSmile = new TrikSmile(*mMetamodel);
+	mMetamodel->addNode(typeTrikSmile);
+	qReal::ElementType * const typeTrikStopCamera = new TrikStopCamera(*mMetamodel);
+	mMetamodel->addNode(typeTrikStopCamera);
+	qReal::ElementType * const typeTrikStopVideoStreaming = new TrikStopVideoStreaming(*mMetamodel);
+	mMetamodel->addNode(typeTrikStopVideoStreaming);
+	qReal::ElementType * const typeTrikSystem = new TrikSystem(*mMetamodel);
+	mMetamodel->addNode(typeTrikSystem);
+	qReal::ElementType * const typeTrikV62AngularServo = new TrikV62AngularServo(*mMetamodel);
+	mMetamodel->addNode(typeTrikV62AngularServo);
+	qReal::ElementType * const typeTrikV62ClearEncoder = new TrikV62ClearEncoder(*mMetamodel);
+	mMetamodel->addNode(typeTrikV62ClearEncoder);
+	qReal::ElementType * const typeTrikV62WaitForEncoder = new TrikV62WaitForEncoder(*mMetamodel);
+	mMetamodel->addNode(typeTrikV62WaitForEncoder);
+	qReal::ElementType * const typeTrikV6ClearEncoder = new TrikV6ClearEncoder(*mMetamodel);
+	mMetamodel->addNode(typeTrikV6ClearEncoder);
+	qReal::ElementType * const typeTrikV6EngineMovementCommand = new TrikV6EngineMovementCommand(*mMetamodel);
+	mMetamodel->addNode(typeTrikV6EngineMovementCommand);
+	qReal::ElementType * const typeTrikV6EnginesBackward = new TrikV6EnginesBackward(*mMetamodel);
+	mMetamodel->addNode(typeTrikV6EnginesBackward);
+	qReal::ElementType * const typeTrikV6EnginesForward = new TrikV6EnginesForward(*mMetamodel);
+	mMetamodel->addNode(typeTrikV6EnginesForward);
+	qReal::ElementType * const typeTrikV6EnginesStop = new TrikV6EnginesStop(*mMetamodel);
+	mMetamodel->addNode(typeTrikV6EnginesStop);
+	qReal::ElementType * const typeTrikWaitForAccelerometer = new TrikWaitForAccelerometer(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForAccelerometer);
+	qReal::ElementType * const typeTrikWaitForButton = new TrikWaitForButton(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForButton);
+	qReal::ElementType * const typeTrikWaitForEncoder = new TrikWaitForEncoder(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForEncoder);
+	qReal::ElementType * const typeTrikWaitForGyroscope = new TrikWaitForGyroscope(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForGyroscope);
+	qReal::ElementType * const typeTrikWaitForIRDistance = new TrikWaitForIRDistance(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForIRDistance);
+	qReal::ElementType * const typeTrikWaitForLight = new TrikWaitForLight(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForLight);
+	qReal::ElementType * const typeTrikWaitForMessage = new TrikWaitForMessage(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForMessage);
+	qReal::ElementType * const typeTrikWaitForMotion = new TrikWaitForMotion(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForMotion);
+	qReal::ElementType * const typeTrikWaitForSonarDistance = new TrikWaitForSonarDistance(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForSonarDistance);
+	qReal::ElementType * const typeTrikWaitForTouchSensor = new TrikWaitForTouchSensor(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitForTouchSensor);
+	qReal::ElementType * const typeTrikWaitGamepadButton = new TrikWaitGamepadButton(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitGamepadButton);
+	qReal::ElementType * const typeTrikWaitGamepadConnect = new TrikWaitGamepadConnect(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitGamepadConnect);
+	qReal::ElementType * const typeTrikWaitGamepadDisconnect = new TrikWaitGamepadDisconnect(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitGamepadDisconnect);
+	qReal::ElementType * const typeTrikWaitGamepadWheel = new TrikWaitGamepadWheel(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitGamepadWheel);
+	qReal::ElementType * const typeTrikWaitPadPress = new TrikWaitPadPress(*mMetamodel);
+	mMetamodel->addNode(typeTrikWaitPadPress);
+	qReal::ElementType * const typeTrikWriteToFile = new TrikWriteToFile(*mMetamodel);
+	mMetamodel->addNode(typeTrikWriteToFile);
+	mMetamodel->produceEdge(*typeTrikAnalogSensorBlock, *typeTrikSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikAngularServo, mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikCalibrateGyroscope, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDetect, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDetectorToVariable, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDigitalSensorBlock, *typeTrikSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDrawArc, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDrawEllipse, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDrawLine, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDrawPixel, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikDrawRect, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikInitCamera, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikInitVideoStreaming, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikLed, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikPlayTone, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikPlayToneHz, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikPrintText, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikReadLidar, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikRemoveFile, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSadSmile, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSay, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSendMessage, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSensorBlock, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSetBackground, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSetPainterColor, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSetPainterWidth, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSmile, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikStopCamera, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikStopVideoStreaming, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikSystem, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV62AngularServo, mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV62ClearEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV62WaitForEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV6ClearEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV6EngineMovementCommand, mMetamodel->elementType("RobotsDiagram", "EngineMovementCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV6EnginesBackward, *typeTrikV6EngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV6EnginesForward, *typeTrikV6EngineMovementCommand, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikV6EnginesStop, mMetamodel->elementType("RobotsDiagram", "EngineCommand"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForAccelerometer, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForButton, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForEncoder, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForGyroscope, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForIRDistance, *typeTrikAnalogSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForLight, *typeTrikAnalogSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForMessage, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForMotion, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForSonarDistance, *typeTrikDigitalSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitForTouchSensor, *typeTrikAnalogSensorBlock, qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitGamepadButton, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitGamepadConnect, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitGamepadDisconnect, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitGamepadWheel, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWaitPadPress, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
+	mMetamodel->produceEdge(*typeTrikWriteToFile, mMetamodel->elementType("RobotsDiagram", "AbstractNode"), qReal::ElementType::generalizationLinkType);
 }
 
 void TrikMetamodelPlugin::initNameMap()
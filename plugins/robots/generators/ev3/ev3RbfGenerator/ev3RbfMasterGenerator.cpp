@@ -20,6 +20,7 @@
 #include <qrutils/stringUtils.h>
 #include <generatorBase/parts/initTerminateCodeGenerator.h>
 #include <generatorBase/gotoControlFlowGenerator.h>
+#include <generatorBase/outputBuilder.h>
 #include <generatorBase/parts/subprograms.h>
 #include <generatorBase/parts/threads.h>
 #include <generatorBase/parts/variables.h>
@@ -89,21 +90,22 @@ QString Ev3RbfMasterGenerator::generate(const QString &indentString)
 		return QString();
 	}
 
-	QString resultCode = readTemplate("main.t");
-	resultCode.replace("@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations());
-	resultCode.replace("@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations());
-	resultCode.replace("@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations());
-	resultCode.replace("@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString));
-	resultCode.replace("@@MAIN_CODE@@", mainCode);
-	resultCode.replace("@@CONSTANTS_INITIALIZATION@@", utils::StringUtils::addIndent(
+	const QString mainTemplate = readTemplate("main.t");
+	OutputBuilder builder;
+	builder.setPlaceholder("@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations());
+	builder.setPlaceholder("@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations());
+	builder.setPlaceholder("@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations());
+	builder.setPlaceholder("@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString));
+	builder.setPlaceholder("@@MAIN_CODE@@", mainCode);
+	builder.setPlaceholder("@@CONSTANTS_INITIALIZATION@@", utils::StringUtils::addIndent(
 			mLuaProcessorInstance->constantsValuation(), 1, indentString));
-	resultCode.replace("@@ARRAYS_INITIALIZATION@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@ARRAYS_INITIALIZATION@@", utils::StringUtils::addIndent(
 			mLuaProcessorInstance->arraysInitialization(), 1, indentString));
-	resultCode.replace("@@INITHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@INITHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->initCode(), 1, indentString));
-	resultCode.replace("@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->terminateCode(), 1, indentString));
-	resultCode.replace("@@USERISRHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@USERISRHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->isrHooksCode(), 1, indentString));
 
 	const QString constantsString = utils::StringUtils::addIndent(
@@ -111,22 +113,18 @@ QString Ev3RbfMasterGenerator::generate(const QString &indentString)
 	QStringList variablesList = mCustomizer->factory()->variables()->generateVariableString().split('\n');
 	std::sort(variablesList.begin(), variablesList.end());
 	const QString variablesString = utils::StringUtils::addIndent(variablesList.join('\n'), 1, "\t");
-	if (resultCode.contains("@@CONSTANTS@@")) {
-		resultCode.replace("@@CONSTANTS@@", constantsString);
-		resultCode.replace("@@VARIABLES@@", variablesString);
+	if (mainTemplate.contains("@@CONSTANTS@@")) {
+		builder.setPlaceholder("@@CONSTANTS@@", constantsString);
+		builder.setPlaceholder("@@VARIABLES@@", variablesString);
 	} else {
-		resultCode.replace("@@VARIABLES@@", constantsString + "\n" + variablesString);
+		builder.setPlaceholder("@@VARIABLES@@", constantsString + "\n" + variablesString);
 	}
 
-	// This will remove too many empty lines
-	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
-
+	QString resultCode = builder.expand(mainTemplate);
 	processGeneratedCode(resultCode);
 
-	generateLinkingInfo(resultCode);
-
 	const QString pathToOutput = targetPath();
-	outputCode(pathToOutput, resultCode);
+	outputProgram(pathToOutput, resultCode);
 
 	afterGeneration();
 
@@ -33,6 +33,7 @@ HEADERS += \
 	$$PWD/include/generatorBase/robotsGeneratorDeclSpec.h \
 	$$PWD/include/generatorBase/robotsGeneratorPluginBase.h \
 	$$PWD/include/generatorBase/masterGeneratorBase.h \
+	$$PWD/include/generatorBase/outputBuilder.h \
 	$$PWD/include/generatorBase/generatorCustomizer.h \
 	$$PWD/include/generatorBase/controlFlowGeneratorBase.h \
 	$$PWD/include/generatorBase/generatorFactoryBase.h \
@@ -68,6 +69,7 @@ HEADERS += \
 	$$PWD/src/converters/dynamicPropertiesConverter.h \
 	$$PWD/src/structuralControlFlowGenerator.h \
 	$$PWD/src/structurizator.h \
+	$$PWD/src/templatesStore.h \
 
 HEADERS += \
 	$$PWD/src/structurizatorNodes/intermediateStructurizatorNode.h \
@@ -84,6 +86,7 @@ HEADERS += \
 SOURCES += \
 	$$PWD/src/robotsGeneratorPluginBase.cpp \
 	$$PWD/src/masterGeneratorBase.cpp \
+	$$PWD/src/outputBuilder.cpp \
 	$$PWD/src/generatorCustomizer.cpp \
 	$$PWD/src/controlFlowGeneratorBase.cpp \
 	$$PWD/src/robotsDiagramVisitor.cpp \
@@ -115,6 +118,7 @@ SOURCES += \
 	$$PWD/src/converters/dynamicPropertiesConverter.cpp \
 	$$PWD/src/structuralControlFlowGenerator.cpp \
 	$$PWD/src/structurizator.cpp \
+	$$PWD/src/templatesStore.cpp \
 
 # Simple element generators & converters
 
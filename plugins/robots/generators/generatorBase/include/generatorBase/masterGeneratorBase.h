@@ -72,8 +72,6 @@ public:
 	virtual QString generate(const QString &indentString);
 
 protected:
-	void generateLinkingInfo(QString &resultCode);
-	void cleanUpLinkingInfo(QString &code);
 	virtual GeneratorCustomizer *createCustomizer() = 0;
 
 	/// Default implementation takes ownership via QObject parentship system.
@@ -99,7 +97,9 @@ protected:
 
 	void outputCode(const QString &path, const QString &code);
 
-	void replaceWithAutoIndent(QString &where, const QString &what, const QString &withWhat);
+	/// Finishes generated program \a resultCode with OutputBuilder::finish() and writes it into \a path,
+	/// linking info goes to "<path>.dbg".
+	void outputProgram(const QString &path, const QString &resultCode);
 
 	const qrRepo::RepoApi &mRepo;
 	qReal::ErrorReporterInterface &mErrorReporter;
@@ -0,0 +1,48 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+#include "robotsGeneratorDeclSpec.h"
+
+namespace generatorBase {
+
+/// Assembles the text of a generated program in time linear in its size. Placeholders of a template are
+/// expanded in one pass over it, then finish() makes one more pass over the program that removes extra
+/// empty lines and linking markers and collects code-to-block mapping.
+class ROBOTS_GENERATOR_EXPORT OutputBuilder
+{
+public:
+	/// Sets the text to be put instead of a template line consisting of \a placeholder (like "@@MAIN_CODE@@")
+	/// and indentation. The text gets the indentation of the placeholder line, its empty lines are dropped then.
+	void setPlaceholder(const QString &placeholder, const QString &text);
+
+	/// Returns \a templateText with all placeholder lines replaced by their texts.
+	/// Inserted texts are not searched for placeholders.
+	QString expand(const QString &templateText) const;
+
+	/// Returns \a code where runs of empty lines are shortened to one line (two at the beginning and at the end)
+	/// and linking markers are removed. Code-to-block mapping is written to \a linkingInfo, one
+	/// "<element id>@<first line>@<last line>" entry per line, ordered by the first line.
+	static QString finish(const QString &code, QString &linkingInfo);
+
+private:
+	QHash<QString, QString> mPlaceholders;
+};
+
+}
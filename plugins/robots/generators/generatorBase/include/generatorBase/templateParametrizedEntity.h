@@ -38,6 +38,7 @@ public:
 
 protected:
 	/// Reads the given file contents. A path to file must be relative to templates folder root.
+	/// Templates are read from disk only once per process, see TemplatesStore.
 	/// @param pathFromRoot A path to a concrete template relatively to specified in constructor folder.
 	QString readTemplate(const QString &pathFromRoot) const;
 
@@ -15,9 +15,6 @@
 #include "generatorBase/masterGeneratorBase.h"
 
 #include <QtCore/QDir>
-#include <QtCore/QPair>
-#include <QtCore/QStack>
-#include <QtCore/QRegularExpression>
 
 #include <qrutils/outFile.h>
 #include <qrutils/fileSystemUtils.h>
@@ -26,6 +23,7 @@
 
 #include "structuralControlFlowGenerator.h"
 #include "generatorBase/gotoControlFlowGenerator.h"
+#include "generatorBase/outputBuilder.h"
 #include "generatorBase/lua/luaProcessor.h"
 #include "generatorBase/parts/variables.h"
 #include "generatorBase/parts/subprograms.h"
@@ -138,97 +136,39 @@ QString MasterGeneratorBase::generate(const QString &indentString)
 		return QString();
 	}
 
-	QString resultCode = readTemplate("main.t");
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS_FORWARDING@@"
-			, mCustomizer->factory()->subprograms()->forwardDeclarations());
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS@@"
-			, mCustomizer->factory()->subprograms()->implementations());
-	replaceWithAutoIndent(resultCode, "@@THREADS_FORWARDING@@"
-			, mCustomizer->factory()->threads().generateDeclarations());
-	replaceWithAutoIndent(resultCode, "@@THREADS@@"
-			, mCustomizer->factory()->threads().generateImplementations(indentString));
-	replaceWithAutoIndent(resultCode, "@@MAIN_CODE@@", mainCode);
-	replaceWithAutoIndent(resultCode, "@@INITHOOKS@@", utils::StringUtils::addIndent(
+	const QString mainTemplate = readTemplate("main.t");
+	OutputBuilder builder;
+	builder.setPlaceholder("@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations());
+	builder.setPlaceholder("@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations());
+	builder.setPlaceholder("@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations());
+	builder.setPlaceholder("@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString));
+	builder.setPlaceholder("@@MAIN_CODE@@", mainCode);
+	builder.setPlaceholder("@@INITHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->initCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->terminateCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@USERISRHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@USERISRHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->isrHooksCode(), 1, indentString));
 	const QString constantsString = mCustomizer->factory()->variables()->generateConstantsString();
 	const QString variablesString = mCustomizer->factory()->variables()->generateVariableString();
-	if (resultCode.contains("@@CONSTANTS@@")) {
-		replaceWithAutoIndent(resultCode, "@@CONSTANTS@@", constantsString);
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", variablesString);
+	if (mainTemplate.contains("@@CONSTANTS@@")) {
+		builder.setPlaceholder("@@CONSTANTS@@", constantsString);
+		builder.setPlaceholder("@@VARIABLES@@", variablesString);
 	} else {
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", constantsString + "\n" + variablesString);
+		builder.setPlaceholder("@@VARIABLES@@", constantsString + "\n" + variablesString);
 	}
 
-	// This will remove too many empty lines
-	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
-
+	QString resultCode = builder.expand(mainTemplate);
 	processGeneratedCode(resultCode);
 
-	generateLinkingInfo(resultCode);
-
 	const QString pathToOutput = targetPath();
-	outputCode(pathToOutput, resultCode);
+	outputProgram(pathToOutput, resultCode);
 
 	afterGeneration();
 
 	return pathToOutput;
 }
 
-void MasterGeneratorBase::generateLinkingInfo(QString &resultCode)
-{
-	const QString open = "@~(qrm:(/\\w+)+/\\{(\\w+-)+\\w+\\})~@";
-	const QString close = "@#%1#@";
-	QRegExp re;
-	QStack<QPair<QString, int>> stack;
-	QList<QPair<QString, QPair<int, int>>> results;
-	int lineNumber = 1;
-
-	for (const QString &line : resultCode.split("\n")){
-		re.setPattern(open);
-		const int pos = re.indexIn(line);
-		if (pos > -1) {
-			const QString id = re.cap(1);
-			stack.push(QPair<QString, int>(id, lineNumber));
-		}
-
-		if (!stack.isEmpty()) {
-			const QString id = stack.top().first;
-			if (line.contains(close.arg(id))) {
-				results.append(qMakePair(id, qMakePair(stack.top().second, lineNumber)));
-				stack.pop();
-			}
-		}
-
-		lineNumber++;
-	}
-
-	QString out;
-
-	std::sort(results.begin(), results.end()
-			, [](const QPair<QString, QPair<int, int>> &r1, const QPair<QString, QPair<int, int>> &r2) -> bool {
-				return r1.second.first < r2.second.first;
-			});
-
-	for (const auto &res : results) {
-		out += QString("%1@%2@%3\n").arg(res.first
-				, QString::number(res.second.first)
-				, QString::number(res.second.second));
-	}
-
-	outputCode(targetPath() + ".dbg", out);
-
-	cleanUpLinkingInfo(resultCode);
-}
-
-void MasterGeneratorBase::cleanUpLinkingInfo(QString &code)
-{
-	code.remove(QRegExp("@(~|#)qrm:(((/\\w+)+/\\{(\\w+-)+\\w+\\})|(/))(~|#)@"));
-}
-
 lua::LuaProcessor *MasterGeneratorBase::createLuaProcessor()
 {
 	return new lua::LuaProcessor(mErrorReporter, mTextLanguage, mParserErrorReporter, this);
@@ -269,14 +209,10 @@ void MasterGeneratorBase::outputCode(const QString &path, const QString &code)
 	out() << code;
 }
 
-void MasterGeneratorBase::replaceWithAutoIndent(QString &where, const QString &what, const QString &withWhat)
+void MasterGeneratorBase::outputProgram(const QString &path, const QString &resultCode)
 {
-	const QRegularExpression regexp(QString("^(([ \\t]*)%1)$").arg(what), QRegularExpression::MultilineOption);
-	const QRegularExpressionMatch match = regexp.match(where, 0
-			, QRegularExpression::NormalMatch, QRegularExpression::NoMatchOption);
-	if (match.hasMatch()) {
-		const QString wholeString = match.captured(1);
-		const QString indentString = match.captured(2);
-		where.replace(wholeString, utils::StringUtils::addIndent(withWhat, 1, indentString));
-	}
+	QString linkingInfo;
+	const QString code = OutputBuilder::finish(resultCode, linkingInfo);
+	outputCode(path + ".dbg", linkingInfo);
+	outputCode(path, code);
 }
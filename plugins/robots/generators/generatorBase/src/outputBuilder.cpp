@@ -0,0 +1,165 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "generatorBase/outputBuilder.h"
+
+#include <QtCore/QPair>
+#include <QtCore/QRegExp>
+#include <QtCore/QStack>
+
+using namespace generatorBase;
+
+void OutputBuilder::setPlaceholder(const QString &placeholder, const QString &text)
+{
+	mPlaceholders[placeholder] = text;
+}
+
+QString OutputBuilder::expand(const QString &templateText) const
+{
+	int resultSize = templateText.size();
+	for (const QString &text : mPlaceholders) {
+		resultSize += text.size();
+	}
+
+	QString result;
+	result.reserve(resultSize);
+
+	for (int lineStart = 0; lineStart <= templateText.size();) {
+		int lineEnd = templateText.indexOf('\n', lineStart);
+		if (lineEnd < 0) {
+			lineEnd = templateText.size();
+		}
+
+		const QStringRef line = templateText.midRef(lineStart, lineEnd - lineStart);
+		if (lineStart > 0) {
+			result.append('\n');
+		}
+
+		lineStart = lineEnd + 1;
+
+		int indentLength = 0;
+		while (indentLength < line.size() && (line.at(indentLength) == ' ' || line.at(indentLength) == '\t')) {
+			++indentLength;
+		}
+
+		const QStringRef placeholder = line.mid(indentLength);
+		const auto text = placeholder.startsWith("@@") && placeholder.endsWith("@@")
+				? mPlaceholders.constFind(placeholder.toString())
+				: mPlaceholders.constEnd();
+		if (text == mPlaceholders.constEnd()) {
+			result.append(line);
+			continue;
+		}
+
+		if (indentLength == 0) {
+			result.append(*text);
+			continue;
+		}
+
+		const QStringRef indent = line.left(indentLength);
+		bool firstLine = true;
+		for (const QStringRef &textLine : text->splitRef('\n', QString::SkipEmptyParts)) {
+			if (!firstLine) {
+				result.append('\n');
+			}
+
+			firstLine = false;
+			result.append(indent);
+			result.append(textLine);
+		}
+	}
+
+	return result;
+}
+
+QString OutputBuilder::finish(const QString &code, QString &linkingInfo)
+{
+	QRegExp openMarker("@~(qrm:(/\\w+)+/\\{(\\w+-)+\\w+\\})~@");
+	const QString closeMarker = "@#%1#@";
+	const QRegExp marker("@(~|#)qrm:(((/\\w+)+/\\{(\\w+-)+\\w+\\})|(/))(~|#)@");
+	QStack<QPair<QString, int>> stack;
+	QList<QPair<QString, QPair<int, int>>> results;
+
+	QString result;
+	result.reserve(code.size());
+	int lineNumber = 0;
+
+	const auto appendLine = [&](const QStringRef &line) {
+		if (lineNumber > 0) {
+			result.append('\n');
+		}
+
+		++lineNumber;
+		if (!line.contains("qrm:")) {
+			result.append(line);
+			return;
+		}
+
+		QString text = line.toString();
+		if (openMarker.indexIn(text) > -1) {
+			stack.push(qMakePair(openMarker.cap(1), lineNumber));
+		}
+
+		if (!stack.isEmpty() && text.contains(closeMarker.arg(stack.top().first))) {
+			results.append(qMakePair(stack.top().first, qMakePair(stack.top().second, lineNumber)));
+			stack.pop();
+		}
+
+		text.remove(marker);
+		result.append(text);
+	};
+
+	int pendingEmptyLines = 0;
+	bool atStart = true;
+	for (int lineStart = 0; lineStart <= code.size();) {
+		int lineEnd = code.indexOf('\n', lineStart);
+		if (lineEnd < 0) {
+			lineEnd = code.size();
+		}
+
+		const QStringRef line = code.midRef(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+		if (line.isEmpty()) {
+			++pendingEmptyLines;
+			continue;
+		}
+
+		for (int i = qMin(pendingEmptyLines, atStart ? 2 : 1); i > 0; --i) {
+			appendLine(QStringRef());
+		}
+
+		pendingEmptyLines = 0;
+		atStart = false;
+		appendLine(line);
+	}
+
+	for (int i = qMin(pendingEmptyLines, 2); i > 0; --i) {
+		appendLine(QStringRef());
+	}
+
+	std::sort(results.begin(), results.end()
+			, [](const QPair<QString, QPair<int, int>> &r1, const QPair<QString, QPair<int, int>> &r2) -> bool {
+				return r1.second.first < r2.second.first;
+			});
+
+	linkingInfo.clear();
+	for (const auto &res : results) {
+		linkingInfo += QString("%1@%2@%3\n").arg(res.first
+				, QString::number(res.second.first)
+				, QString::number(res.second.second));
+	}
+
+	return result;
+}
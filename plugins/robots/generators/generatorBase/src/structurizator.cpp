@@ -42,10 +42,14 @@ IntermediateStructurizatorNode *Structurizator::performStructurization(const QSe
 		, const QMap<qReal::Id, int> &vertexNumber
 		, int verticesNumber)
 {
+	reserveVertex(verticesNumber);
 	for (const qReal::Id &id : verticesIds) {
+		const int v = vertexNumber[id];
+		reserveVertex(v);
 		mInitialIds.insert(id);
-		mMapIdToInt[id] = vertexNumber[id];
-		mVertices.insert(vertexNumber[id]);
+		mMapIdToInt[id] = v;
+		mVertices.insert(v);
+		mVerticesMask.setBit(v);
 	}
 
 	mVerticesNumber = verticesNumber;
@@ -68,7 +72,7 @@ IntermediateStructurizatorNode *Structurizator::performStructurization(const QSe
 
 		int t = 0;
 		while (t <= mMaxPostOrderTime && (mVertices.size() > 1 || !mFollowers[mStartVertex].isEmpty())) {
-			int v = mPostOrder.key(t);
+			int v = mVertexByTime[t];
 
 			QSet<int> reachUnder;
 			QSet<QPair<int, int>> edgesToRemove = {};
@@ -149,7 +153,7 @@ bool Structurizator::isBlock(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<Q
 	}
 
 	int u = mFollowers[v].first();
-	if (outgoingEdgesNumber(u) <= 1 && incomingEdgesNumber(u) == 1 && u != v && mDominators[u].contains(v)) {
+	if (outgoingEdgesNumber(u) <= 1 && incomingEdgesNumber(u) == 1 && u != v && mDominators[u].testBit(v)) {
 		verticesRoles["block1"] = v;
 		verticesRoles["block2"] = u;
 
@@ -168,8 +172,8 @@ bool Structurizator::isIfThenElse(int v, QSet<QPair<int, int>> &edgesToRemove, Q
 
 	int u1 = mFollowers[v].first();
 	int u2 = mFollowers[v].last();
-	if (incomingEdgesNumber(u1) != 1 || incomingEdgesNumber(u2) != 1 || mDominators[v].contains(u1)
-			|| mDominators[v].contains(u2)) {
+	if (incomingEdgesNumber(u1) != 1 || incomingEdgesNumber(u2) != 1 || mDominators[v].testBit(u1)
+			|| mDominators[v].testBit(u2)) {
 		return false;
 	}
 
@@ -211,7 +215,7 @@ bool Structurizator::isIfThen(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<
 		elseNumber = u1;
 	}
 
-	if (thenNumber == -1 || elseNumber == v || mDominators[v].contains(thenNumber)) {
+	if (thenNumber == -1 || elseNumber == v || mDominators[v].testBit(thenNumber)) {
 		return false;
 	}
 
@@ -255,7 +259,7 @@ bool Structurizator::isSwitch(int v, QSet<QPair<int, int>> &edgesToRemove, QMap<
 			vertices.insert(u);
 		}
 
-		if (u != exit && mDominators[v].contains(u)) {
+		if (u != exit && mDominators[v].testBit(u)) {
 			return false;
 		}
 
@@ -315,7 +319,7 @@ bool Structurizator::isWhileLoop(int v, QSet<QPair<int, int>> &edgesToRemove, QM
 		return false;
 	}
 
-	if (mDominators[v].contains(bodyNumber)) {
+	if (mDominators[v].testBit(bodyNumber)) {
 		return false;
 	}
 
@@ -366,7 +370,7 @@ bool Structurizator::isHeadOfCycle(int v, QSet<int> &reachUnder)
 	QQueue<int> queueForReachUnder;
 
 	for (const int u : mPredecessors[v]) {
-		if (mDominators[u].contains(v)) {
+		if (mDominators[u].testBit(v)) {
 			queueForReachUnder.push_back(u);
 		}
 	}
@@ -376,7 +380,7 @@ bool Structurizator::isHeadOfCycle(int v, QSet<int> &reachUnder)
 		queueForReachUnder.pop_front();
 		reachUnder.insert(u);
 		for (const int w : mPredecessors[u]) {
-			if (mDominators[w].contains(v) && !reachUnder.contains(w)) {
+			if (mDominators[w].testBit(v) && !reachUnder.contains(w)) {
 				queueForReachUnder.push_back(w);
 			}
 		}
@@ -471,9 +475,13 @@ bool Structurizator::checkCommonExitUniqueness(int commonExit, const QMap<int, Q
 
 bool Structurizator::checkNodes(const QSet<int> &verticesWithExits)
 {
-	QSet<int> testSet = mWasPreviouslyDetectedAsNodeWithExit.keys().toSet();
-	testSet.intersect(verticesWithExits);
-	return testSet.isEmpty();
+	for (const int v : verticesWithExits) {
+		if (mWasPreviouslyDetectedAsNodeWithExit.contains(v)) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 void Structurizator::reduceBlock(QSet<QPair<int, int>> &edgesToRemove, QMap<QString, int> &verticesRoles)
@@ -587,10 +595,11 @@ void Structurizator::reduceConditionsWithBreaks(int &v, QMap<int, QSet<int>> &no
 
 		StructurizatorNodeWithBreaks *nodeWithBreaks = new StructurizatorNodeWithBreaks(mTrees[u]
 				, exitBranches, this);
-		replace(appendVertex(nodeWithBreaks), edgesToRemove, vertices);
+		const int newNodeNumber = appendVertex(nodeWithBreaks);
+		replace(newNodeNumber, edgesToRemove, vertices);
 
 		if (u == v) {
-			v = mTrees.key(nodeWithBreaks);
+			v = newNodeNumber;
 		}
 	}
 
@@ -624,9 +633,21 @@ void Structurizator::updateEdges(int newNodeNumber, QSet<QPair<int, int>> &edges
 		mPredecessors[p.second].removeAll(p.first);
 	}
 
-	const QMap<int, QVector<int>> followers = mFollowers;
+	// only edges incident to replaced vertices change, so only their sources have to be visited
+	QSet<int> sources = vertices;
+	for (const int u : vertices) {
+		for (const int v : mPredecessors[u]) {
+			sources.insert(v);
+		}
+	}
+
 	for (const int v : mVertices) {
-		for (const int u : followers[v]) {
+		if (v == newNodeNumber || !sources.contains(v)) {
+			continue;
+		}
+
+		const QVector<int> followers = mFollowers[v];
+		for (const int u : followers) {
 
 			int newV = vertices.contains(v) ? newNodeNumber : v;
 			int newU = vertices.contains(u) ? newNodeNumber : u;
@@ -646,8 +667,8 @@ void Structurizator::updateEdges(int newNodeNumber, QSet<QPair<int, int>> &edges
 	}
 
 	for (const int v : vertices) {
-		mFollowers.remove(v);
-		mPredecessors.remove(v);
+		mFollowers[v].clear();
+		mPredecessors[v].clear();
 	}
 }
 
@@ -660,49 +681,61 @@ void Structurizator::updatePostOrder(int newNodeNumber, QSet<int> &verteces)
 		}
 	}
 
-	mPostOrder[newNodeNumber] = maximum;
-
 	for (int v : verteces) {
-		mPostOrder.remove(v);
+		mPostOrder[v] = -1;
 	}
 
-	mMaxPostOrderTime = mMaxPostOrderTime - verteces.size() + 1;
-
-	QVector<int> times = mPostOrder.values().toVector();
-	std::sort(times.begin(), times.end());
+	// new vertex takes the latest time of replaced ones, remaining times are compacted keeping their order
+	QVector<int> vertexByTime;
+	vertexByTime.reserve(mVertexByTime.size() - verteces.size() + 1);
+	for (int time = 0; time < mVertexByTime.size(); ++time) {
+		const int v = time == maximum ? newNodeNumber : mVertexByTime[time];
+		if (v != newNodeNumber && mPostOrder[v] == -1) {
+			continue;
+		}
 
-	for (int i = 0; i <= mMaxPostOrderTime; i++) {
-		int v = mPostOrder.key(times[i]);
-		mPostOrder[v] = i;
+		mPostOrder[v] = vertexByTime.size();
+		vertexByTime.append(v);
 	}
+
+	mVertexByTime = vertexByTime;
+	mMaxPostOrderTime = mVertexByTime.size() - 1;
 }
 
 void Structurizator::updateDominators(int newNodeNumber, QSet<int> &vertices)
 {
 	// others
-	for (int v : mPostOrder.keys()) {
-		QSet<int> tempSet = mDominators[v];
-		tempSet.intersect(vertices);
-		if (!tempSet.isEmpty()) {
-			mDominators[v].subtract(vertices);
-			mDominators[v].insert(newNodeNumber);
+	for (const int v : mVertexByTime) {
+		QBitArray &dominators = mDominators[v];
+		bool dominatedByReplaced = false;
+		for (const int u : vertices) {
+			if (dominators.testBit(u)) {
+				dominatedByReplaced = true;
+				dominators.clearBit(u);
+			}
+		}
+
+		if (dominatedByReplaced) {
+			dominators.setBit(newNodeNumber);
 		}
 	}
 
 	// new
-	QSet<int> doms = mVertices;
-	for (int v : vertices) {
-		doms.intersect(mDominators[v]);
+	QBitArray doms = mVerticesMask;
+	for (const int v : vertices) {
+		doms &= mDominators[v];
 	}
 
-	doms.subtract(vertices);
-	doms.insert(newNodeNumber);
+	for (const int v : vertices) {
+		doms.clearBit(v);
+	}
 
+	doms.setBit(newNodeNumber);
 	mDominators[newNodeNumber] = doms;
 
 	// old
-	for (int v : vertices) {
-		mDominators.remove(v);
+	for (const int v : vertices) {
+		mDominators[v].fill(false);
 	}
 }
 
@@ -711,6 +744,12 @@ void Structurizator::updateVertices(int newNodeNumber, QSet<int> &vertices)
 	mStartVertex = vertices.contains(mStartVertex) ? newNodeNumber : mStartVertex;
 	mVertices.subtract(vertices);
 	mVertices.insert(newNodeNumber);
+
+	for (const int v : vertices) {
+		mVerticesMask.clearBit(v);
+	}
+
+	mVerticesMask.setBit(newNodeNumber);
 }
 
 void Structurizator::removeNodesPreviouslyDetectedAsNodeWithExit(QSet<int> &vertices)
@@ -723,10 +762,11 @@ void Structurizator::removeNodesPreviouslyDetectedAsNodeWithExit(QSet<int> &vert
 void Structurizator::calculateDominators()
 {
 	for (const int u : mVertices) {
-		mDominators[u] = mVertices;
+		mDominators[u] = mVerticesMask;
 	}
 
-	mDominators[mStartVertex] = { mStartVertex };
+	mDominators[mStartVertex].fill(false);
+	mDominators[mStartVertex].setBit(mStartVertex);
 
 	bool somethingChanged = true;
 	while (somethingChanged) {
@@ -737,12 +777,12 @@ void Structurizator::calculateDominators()
 				continue;
 			}
 
-			QSet<int> doms = mVertices;
+			QBitArray doms = mVerticesMask;
 			for (const int u : mPredecessors[v]) {
-				doms = doms.intersect(mDominators[u]);
+				doms &= mDominators[u];
 			}
 
-			doms.insert(v);
+			doms.setBit(v);
 
 			if (doms != mDominators[v]) {
 				mDominators[v] = doms;
@@ -750,8 +790,6 @@ void Structurizator::calculateDominators()
 			}
 		}
 	}
-
-
 }
 
 void Structurizator::findStartVertex()
@@ -766,13 +804,10 @@ void Structurizator::findStartVertex()
 
 void Structurizator::calculatePostOrder()
 {
-	mPostOrder.clear();
-
-	QMap<int, bool> used;
-	for (const int v : mVertices) {
-		used[v] = false;
-	}
+	mPostOrder.fill(-1);
+	mVertexByTime.clear();
 
+	QVector<bool> used(mFollowers.size(), false);
 	int currentTime = 0;
 	dfs(mStartVertex, currentTime, used);
 
@@ -781,12 +816,12 @@ void Structurizator::calculatePostOrder()
 
 void Structurizator::createInitialNodesForIds()
 {
-	for (const int v : mVertices) {
-		mTrees[v] = new SimpleStructurizatorNode(mMapIdToInt.key(v), this);
+	for (auto it = mMapIdToInt.cbegin(); it != mMapIdToInt.cend(); ++it) {
+		mTrees[it.value()] = new SimpleStructurizatorNode(it.key(), this);
 	}
 }
 
-void Structurizator::dfs(int v, int &currentTime, QMap<int, bool> &used)
+void Structurizator::dfs(int v, int &currentTime, QVector<bool> &used)
 {
 	used[v] = true;
 	for (const int u : mFollowers[v]) {
@@ -796,6 +831,7 @@ void Structurizator::dfs(int v, int &currentTime, QMap<int, bool> &used)
 	}
 
 	mPostOrder[v] = currentTime;
+	mVertexByTime.append(v);
 	currentTime++;
 }
 
@@ -809,12 +845,38 @@ void Structurizator::appendNodesDetectedAsNodeWithExit(QSet<int> &vertices, int
 int Structurizator::appendVertex(IntermediateStructurizatorNode *node)
 {
 	mVerticesNumber++;
+	reserveVertex(mVerticesNumber);
 	mTrees[mVerticesNumber] = node;
 	mVertices.insert(mVerticesNumber);
+	mVerticesMask.setBit(mVerticesNumber);
 
 	return mVerticesNumber;
 }
 
+void Structurizator::reserveVertex(int v)
+{
+	if (v < mFollowers.size()) {
+		return;
+	}
+
+	// growing geometrically keeps resizing of all dominator sets amortized
+	const int oldCapacity = mFollowers.size();
+	const int capacity = qMax(v + 1, 2 * oldCapacity);
+	mFollowers.resize(capacity);
+	mPredecessors.resize(capacity);
+	mTrees.resize(capacity);
+	mVerticesMask.resize(capacity);
+	mPostOrder.resize(capacity);
+	for (int u = oldCapacity; u < capacity; ++u) {
+		mPostOrder[u] = -1;
+	}
+
+	mDominators.resize(capacity);
+	for (QBitArray &dominators : mDominators) {
+		dominators.resize(capacity);
+	}
+}
+
 int Structurizator::outgoingEdgesNumber(int v) const
 {
 	return mFollowers[v].size();
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <QtCore/QBitArray>
 #include <QtCore/QSet>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 
 #include <qrkernel/ids.h>
 
@@ -117,24 +119,36 @@ private:
 	void findStartVertex();
 	void calculatePostOrder();
 	void createInitialNodesForIds();
-	void dfs(int v, int &currentTime, QMap<int, bool> &used);
+	void dfs(int v, int &currentTime, QVector<bool> &used);
 
 	void appendNodesDetectedAsNodeWithExit(QSet<int> &vertices, int cycleHead);
 	void removeNodesPreviouslyDetectedAsNodeWithExit(QSet<int> &vertices);
 	int appendVertex(IntermediateStructurizatorNode *node);
 
+	/// Makes per-vertex arrays and dominator sets large enough to hold vertex number \a v.
+	void reserveVertex(int v);
+
 	int outgoingEdgesNumber(int v) const;
 	int incomingEdgesNumber(int v) const;
 
 	QMap<qReal::Id, int> mMapIdToInt;
 	QSet<VertexNumber> mVertices;
-	QMap<VertexNumber, QVector<VertexNumber>> mFollowers;
-	QMap<VertexNumber, QVector<VertexNumber>> mPredecessors;
-	QMap<VertexNumber, QSet<VertexNumber>> mDominators;
-	QMap<VertexNumber, Time> mPostOrder;
+
+	/// Vertex numbers are dense, so per-vertex data is stored in arrays indexed by vertex number.
+	QVector<QVector<VertexNumber>> mFollowers;
+	QVector<QVector<VertexNumber>> mPredecessors;
+
+	/// Dominators of each vertex as a bit set over vertex numbers.
+	QVector<QBitArray> mDominators;
+	QBitArray mVerticesMask;
+
+	/// Post-order time of each vertex, -1 for removed vertices, and the inverse mapping.
+	QVector<Time> mPostOrder;
+	QVector<VertexNumber> mVertexByTime;
+
 	QMap<VertexNumber, VertexNumber> mWasPreviouslyDetectedAsNodeWithExit;
 
-	QMap<int, IntermediateStructurizatorNode *> mTrees;
+	QVector<IntermediateStructurizatorNode *> mTrees;
 
 	QSet<qReal::Id> mInitialIds;
 	int mVerticesNumber;
@@ -17,10 +17,11 @@
 #include <QtCore/QDebug>
 #include <QtCore/QUuid>
 
-#include <qrutils/inFile.h>
 #include <qrutils/nameNormalizer.h>
 #include <qrkernel/logging.h>
 
+#include "src/templatesStore.h"
+
 using namespace generatorBase;
 
 TemplateParametrizedEntity::TemplateParametrizedEntity()
@@ -39,16 +40,14 @@ TemplateParametrizedEntity::~TemplateParametrizedEntity()
 QString TemplateParametrizedEntity::readTemplate(const QString &pathFromRoot) const
 {
 	for (const QString &path: mPathsToRoot) {
-		const QString fullPath = path + '/' + pathFromRoot;
-		if (QFile::exists(fullPath)) {
-			QString errorMessage;
-			const QString result = utils::InFile::readAll(fullPath, &errorMessage);
-			if (!errorMessage.isEmpty()) {
+		const auto generatorTemplate = TemplatesStore::instance().get(path + '/' + pathFromRoot);
+		if (generatorTemplate) {
+			if (!generatorTemplate->errorMessage().isEmpty()) {
 				QLOG_ERROR() << "Reading from template while generating code failed";
-				qWarning() << "TemplateParametrizedEntity::readTemplate" << errorMessage;
+				qWarning() << "TemplateParametrizedEntity::readTemplate" << generatorTemplate->errorMessage();
 			}
 
-			return addRandomIds(result);
+			return generatorTemplate->instantiate();
 		}
 	}
 
@@ -61,15 +60,13 @@ QString TemplateParametrizedEntity::readTemplate(const QString &pathFromRoot) co
 QString TemplateParametrizedEntity::readTemplateIfExists(const QString &pathFromRoot, const QString &fallback) const
 {
 	for (const QString &path: mPathsToRoot) {
-		const QString fullPath = path + '/' + pathFromRoot;
-		if (QFile::exists(fullPath)) {
-			QString errorMessage;
-			const QString result = utils::InFile::readAll(fullPath, &errorMessage);
-			if (!errorMessage.isEmpty()) {
+		const auto generatorTemplate = TemplatesStore::instance().get(path + '/' + pathFromRoot);
+		if (generatorTemplate) {
+			if (!generatorTemplate->errorMessage().isEmpty()) {
 				QLOG_ERROR() << "Reading from template while generating code failed";
-				qWarning() << "TemplateParametrizedEntity::readTemplate" << errorMessage;
+				qWarning() << "TemplateParametrizedEntity::readTemplate" << generatorTemplate->errorMessage();
 			} else {
-				return addRandomIds(result);
+				return generatorTemplate->instantiate();
 			}
 		}
 	}
@@ -0,0 +1,139 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "templatesStore.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSet>
+#include <QtCore/QUuid>
+
+#include <qrutils/inFile.h>
+#include <qrutils/nameNormalizer.h>
+
+using namespace generatorBase;
+
+GeneratorTemplate::GeneratorTemplate(const QString &contents, const QString &errorMessage)
+	: mContents(contents)
+	, mErrorMessage(errorMessage)
+{
+	split();
+}
+
+QString GeneratorTemplate::errorMessage() const
+{
+	return mErrorMessage;
+}
+
+void GeneratorTemplate::split()
+{
+	if (!mContents.contains("@@RANDOM_ID")) {
+		return;
+	}
+
+	static const QRegularExpression placeholder("@@RANDOM_ID(?:_(\\d+))?@@");
+
+	// @@RANDOM_ID@@ is always replaced, numbered ones only while the numbering is continuous.
+	QSet<int> presentIds;
+	QRegularExpressionMatchIterator matches = placeholder.globalMatch(mContents);
+	while (matches.hasNext()) {
+		const QRegularExpressionMatch match = matches.next();
+		presentIds << (match.captured(1).isEmpty() ? 0 : match.captured(1).toInt());
+	}
+
+	int lastId = 0;
+	while (presentIds.contains(lastId + 1)) {
+		++lastId;
+	}
+
+	int position = 0;
+	matches = placeholder.globalMatch(mContents);
+	while (matches.hasNext()) {
+		const QRegularExpressionMatch match = matches.next();
+		const int id = match.captured(1).isEmpty() ? 0 : match.captured(1).toInt();
+		if (id > lastId) {
+			continue;
+		}
+
+		mSegments << Segment{mContents.mid(position, match.capturedStart() - position), -1};
+		mSegments << Segment{QString(), id};
+		position = match.capturedEnd();
+	}
+
+	mSegments << Segment{mContents.mid(position), -1};
+	mRandomIdsCount = lastId + 1;
+}
+
+QString GeneratorTemplate::instantiate() const
+{
+	if (mSegments.isEmpty()) {
+		return mContents;
+	}
+
+	QVector<QString> ids(mRandomIdsCount);
+	QString result;
+	result.reserve(mContents.size() + 16 * mSegments.size());
+	for (const Segment &segment : mSegments) {
+		if (segment.randomId < 0) {
+			result += segment.text;
+			continue;
+		}
+
+		QString &id = ids[segment.randomId];
+		if (id.isEmpty()) {
+			id = utils::NameNormalizer::normalizeStrongly(QUuid::createUuid().toString(), false);
+		}
+
+		result += id;
+	}
+
+	return result;
+}
+
+TemplatesStore &TemplatesStore::instance()
+{
+	static TemplatesStore store;
+	return store;
+}
+
+QSharedPointer<const GeneratorTemplate> TemplatesStore::get(const QString &fullPath)
+{
+	{
+		QReadLocker locker(&mLock);
+		const auto it = mTemplates.constFind(fullPath);
+		if (it != mTemplates.constEnd()) {
+			return it.value();
+		}
+	}
+
+	const QSharedPointer<const GeneratorTemplate> loaded = load(fullPath);
+	if (!loaded || !loaded->errorMessage().isEmpty()) {
+		return loaded;
+	}
+
+	QWriteLocker locker(&mLock);
+	// Some other thread may have loaded it while we were reading the file, keeping the first one.
+	return *mTemplates.insert(fullPath, mTemplates.value(fullPath, loaded));
+}
+
+QSharedPointer<const GeneratorTemplate> TemplatesStore::load(const QString &fullPath)
+{
+	if (!QFile::exists(fullPath)) {
+		return QSharedPointer<const GeneratorTemplate>();
+	}
+
+	QString errorMessage;
+	const QString contents = utils::InFile::readAll(fullPath, &errorMessage);
+	return QSharedPointer<const GeneratorTemplate>(new GeneratorTemplate(contents, errorMessage));
+}
@@ -0,0 +1,77 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
+
+namespace generatorBase {
+
+/// Immutable contents of one generator template file.
+/// Positions of @@RANDOM_ID@@ placeholders are found once when the file is loaded, so instantiation
+/// of the template without such placeholders costs nothing and with them is a single concatenation.
+class GeneratorTemplate
+{
+public:
+	/// Creates template from the file contents.
+	GeneratorTemplate(const QString &contents, const QString &errorMessage);
+
+	/// Returns a message of the error occured while reading the file or empty string if read was successfull.
+	QString errorMessage() const;
+
+	/// Returns template contents with all @@RANDOM_ID@@ and @@RANDOM_ID_<n>@@ occurences replaced with
+	/// fresh random c++ identifiers. Same placeholders in one instantiation get the same identifier.
+	QString instantiate() const;
+
+private:
+	struct Segment
+	{
+		QString text;
+		int randomId;  // -1 if this segment is a plain text.
+	};
+
+	void split();
+
+	const QString mContents;
+	const QString mErrorMessage;
+	QVector<Segment> mSegments;  // Empty if there are no random id placeholders.
+	int mRandomIdsCount {};
+};
+
+/// Process-wide cache of generator templates. Each template file is read from disk once, all generators
+/// and all TemplateParametrizedEntity instances share it afterwards. Missing and unreadable files are not cached,
+/// so templates that appear later are picked up.
+/// Thread-safe.
+class TemplatesStore
+{
+public:
+	static TemplatesStore &instance();
+
+	/// Returns the template by its full path, loading it if needed. Returns null if there is no such file.
+	QSharedPointer<const GeneratorTemplate> get(const QString &fullPath);
+
+private:
+	TemplatesStore() = default;
+	Q_DISABLE_COPY(TemplatesStore)
+
+	static QSharedPointer<const GeneratorTemplate> load(const QString &fullPath);
+
+	QReadWriteLock mLock;
+	QHash<QString, QSharedPointer<const GeneratorTemplate>> mTemplates;
+};
+
+}
@@ -22,6 +22,7 @@
 #include <qrutils/stringUtils.h>
 #include <generatorBase/parts/initTerminateCodeGenerator.h>
 #include <generatorBase/gotoControlFlowGenerator.h>
+#include <generatorBase/outputBuilder.h>
 #include <generatorBase/parts/subprograms.h>
 #include <generatorBase/parts/threads.h>
 #include <generatorBase/parts/variables.h>
@@ -148,43 +149,37 @@ QString PioneerLuaMasterGenerator::generate(const QString &indentString)
 		return QString();
 	}
 
-	QString resultCode = readTemplate("main.t");
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS_FORWARDING@@"
-			, mCustomizer->factory()->subprograms()->forwardDeclarations());
-	replaceWithAutoIndent(resultCode, "@@SUBPROGRAMS@@"
-			, mCustomizer->factory()->subprograms()->implementations());
-	replaceWithAutoIndent(resultCode, "@@THREADS_FORWARDING@@"
-			, mCustomizer->factory()->threads().generateDeclarations());
-	replaceWithAutoIndent(resultCode, "@@THREADS@@"
-			, mCustomizer->factory()->threads().generateImplementations(indentString));
-	replaceWithAutoIndent(resultCode, "@@MAIN_CODE@@", mainCode);
-	replaceWithAutoIndent(resultCode, "@@INITHOOKS@@", mCustomizer->factory()->initCode());
-	replaceWithAutoIndent(resultCode, "@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
+	const QString mainTemplate = readTemplate("main.t");
+	OutputBuilder builder;
+	builder.setPlaceholder("@@SUBPROGRAMS_FORWARDING@@", mCustomizer->factory()->subprograms()->forwardDeclarations());
+	builder.setPlaceholder("@@SUBPROGRAMS@@", mCustomizer->factory()->subprograms()->implementations());
+	builder.setPlaceholder("@@THREADS_FORWARDING@@", mCustomizer->factory()->threads().generateDeclarations());
+	builder.setPlaceholder("@@THREADS@@", mCustomizer->factory()->threads().generateImplementations(indentString));
+	builder.setPlaceholder("@@MAIN_CODE@@", mainCode);
+	builder.setPlaceholder("@@INITHOOKS@@", mCustomizer->factory()->initCode());
+	builder.setPlaceholder("@@TERMINATEHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->terminateCode(), 1, indentString));
-	replaceWithAutoIndent(resultCode, "@@USERISRHOOKS@@", utils::StringUtils::addIndent(
+	builder.setPlaceholder("@@USERISRHOOKS@@", utils::StringUtils::addIndent(
 			mCustomizer->factory()->isrHooksCode(), 1, indentString));
 	const QString constantsString = mCustomizer->factory()->variables()->generateConstantsString();
 	const QString variablesString = mCustomizer->factory()->variables()->generateVariableString();
 
-	if (resultCode.contains("@@CONSTANTS@@")) {
-		replaceWithAutoIndent(resultCode, "@@CONSTANTS@@", constantsString);
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", variablesString);
+	if (mainTemplate.contains("@@CONSTANTS@@")) {
+		builder.setPlaceholder("@@CONSTANTS@@", constantsString);
+		builder.setPlaceholder("@@VARIABLES@@", variablesString);
 	} else {
-		replaceWithAutoIndent(resultCode, "@@VARIABLES@@", constantsString + "\n" + variablesString);
+		builder.setPlaceholder("@@VARIABLES@@", constantsString + "\n" + variablesString);
 	}
 
-	// This will remove too many empty lines
-	resultCode.replace(QRegExp("\n(\n)+"), "\n\n");
+	QString resultCode = builder.expand(mainTemplate);
 
 	// This will remove leading and trailing whitespaces, line breaks and other unneeded stuff.
 	resultCode = resultCode.trimmed();
 
 	processGeneratedCode(resultCode);
 
-	generateLinkingInfo(resultCode);
-
 	const QString pathToOutput = targetPath();
-	outputCode(pathToOutput, resultCode);
+	outputProgram(pathToOutput, resultCode);
 
 	afterGeneration();
 
@@ -16,8 +16,6 @@
 
 #include <ev3Kit/communication/ev3DirectCommand.h>
 
-const unsigned colorSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace ev3::communication;
 using namespace kitBase::robotModel;
@@ -26,15 +24,26 @@ ColorSensorAmbient::ColorSensorAmbient(const kitBase::robotModel::DeviceInfo &in
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::ColorSensorAmbient(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::percent, 1)
 {
 }
 
 void ColorSensorAmbient::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 1);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &ColorSensorAmbient::inputDevice() const
+{
+	return mImplementation;
+}
+
+void ColorSensorAmbient::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	emit newData(static_cast<int>(reading[0]));
 }
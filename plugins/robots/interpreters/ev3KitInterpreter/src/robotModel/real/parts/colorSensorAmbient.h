@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class ColorSensorAmbient : public kitBase::robotModel::robotParts::ColorSensorAmbient
+class ColorSensorAmbient : public kitBase::robotModel::robotParts::ColorSensorAmbient, public Ev3BatchableSensor
 {
 	Q_OBJECT
 public:
@@ -34,10 +34,11 @@ public:
 
 	void read() override;
 
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
+
 private:
 	Ev3InputDevice mImplementation;
-	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
-	static constexpr unsigned colorSensorResponseSize = 9;
 };
 
 }
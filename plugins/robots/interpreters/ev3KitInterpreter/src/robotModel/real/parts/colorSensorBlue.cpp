@@ -24,15 +24,26 @@ ColorSensorBlue::ColorSensorBlue(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::ColorSensorBlue(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::percent, 4)
 {
 }
 
 void ColorSensorBlue::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 4);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf[5]));
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &ColorSensorBlue::inputDevice() const
+{
+	return mImplementation;
+}
+
+void ColorSensorBlue::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	emit newData(static_cast<int>(reading[0]));
 }
@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class ColorSensorBlue : public kitBase::robotModel::robotParts::ColorSensorBlue
+class ColorSensorBlue : public kitBase::robotModel::robotParts::ColorSensorBlue, public Ev3BatchableSensor
 {
 	Q_OBJECT
 
@@ -35,10 +35,11 @@ public:
 
 	void read() override;
 
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
+
 private:
 	Ev3InputDevice mImplementation;
-	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
-	static constexpr unsigned colorSensorResponseSize = 9;
 };
 
 }
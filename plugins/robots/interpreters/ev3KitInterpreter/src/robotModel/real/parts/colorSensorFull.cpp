@@ -24,15 +24,26 @@ ColorSensorFull::ColorSensorFull(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::ColorSensorFull(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::raw, 2)
 {
 }
 
 void ColorSensorFull::read()
 {
-	const QByteArray command = mImplementation.readyRawCommand(mImplementation.lowLevelPort(), 2);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &ColorSensorFull::inputDevice() const
+{
+	return mImplementation;
+}
+
+void ColorSensorFull::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	emit newData(static_cast<int>(reading[0]));
 }
@@ -24,15 +24,26 @@ ColorSensorGreen::ColorSensorGreen(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::ColorSensorGreen(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::percent, 3)
 {
 }
 
 void ColorSensorGreen::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 3);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &ColorSensorGreen::inputDevice() const
+{
+	return mImplementation;
+}
+
+void ColorSensorGreen::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	emit newData(static_cast<int>(reading[0]));
 }
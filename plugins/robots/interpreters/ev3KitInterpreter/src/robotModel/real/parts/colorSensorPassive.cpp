@@ -24,15 +24,26 @@ ColorSensorPassive::ColorSensorPassive(const kitBase::robotModel::DeviceInfo &in
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::ColorSensorPassive(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::percent, 1)
 {
 }
 
 void ColorSensorPassive::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 1);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, colorSensorResponseSize, outputBuf);
-	emit newData(static_cast<int>(outputBuf.data()[5]));
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &ColorSensorPassive::inputDevice() const
+{
+	return mImplementation;
+}
+
+void ColorSensorPassive::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	emit newData(static_cast<int>(reading[0]));
 }
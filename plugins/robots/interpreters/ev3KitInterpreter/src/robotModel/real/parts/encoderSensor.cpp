@@ -16,30 +16,40 @@
 
 #include <ev3Kit/communication/ev3DirectCommand.h>
 
-const unsigned encoderSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
 EncoderSensor::EncoderSensor(const DeviceInfo &info, const PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::EncoderSensor(info, port)
-	, mImplementation(robotCommunicator, port)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::raw, 0)
 	, mRobotCommunicator(robotCommunicator)
 {
 }
 
 void EncoderSensor::read()
 {
-	QByteArray command = mImplementation.readyRawCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, encoderSensorResponseSize, outputBuf);
-	int secondByte = static_cast<quint8>(outputBuf[6]) << 8;
-	if (static_cast<int>(outputBuf[7]) < 0) {
-		secondByte = static_cast<int>(outputBuf[6]) << 8;
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &EncoderSensor::inputDevice() const
+{
+	return mImplementation;
+}
+
+void EncoderSensor::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	int secondByte = static_cast<quint8>(reading[1]) << 8;
+	if (static_cast<int>(reading[2]) < 0) {
+		secondByte = static_cast<int>(reading[1]) << 8;
 	}
 
-	emit newData(static_cast<quint8>(outputBuf[5]) | secondByte);
+	emit newData(static_cast<quint8>(reading[0]) | secondByte);
 }
 
 void EncoderSensor::nullify()
@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class EncoderSensor : public kitBase::robotModel::robotParts::EncoderSensor
+class EncoderSensor : public kitBase::robotModel::robotParts::EncoderSensor, public Ev3BatchableSensor
 {
 	Q_OBJECT
 
@@ -34,6 +34,9 @@ public:
 			, utils::robotCommunication::RobotCommunicator &robotCommunicator);
 
 	void read() override;
+
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
 	void nullify() override;
 
 private:
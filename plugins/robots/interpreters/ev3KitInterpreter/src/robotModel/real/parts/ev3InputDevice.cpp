@@ -14,18 +14,19 @@
 
 #include "ev3InputDevice.h"
 
-#include <ev3Kit/communication/commandConstants.h>
-#include <ev3Kit/communication/ev3DirectCommand.h>
-
 using namespace ev3::robotModel::real::parts;
 using namespace ev3::communication;
 using namespace kitBase::robotModel;
 using namespace utils;
 
 Ev3InputDevice::Ev3InputDevice(utils::robotCommunication::RobotCommunicator &robotCommunicator
-		, const kitBase::robotModel::PortInfo &port)
+		, const kitBase::robotModel::PortInfo &port
+		, Ev3BatchedReadCommand::Format format
+		, int sensorMode)
 	: mRobotCommunicator(robotCommunicator)
 	, mLowLevelPort(port.name().at(0).toLatin1() - '1')
+	, mFormat(format)
+	, mSensorMode(sensorMode)
 {
 }
 
@@ -39,47 +40,16 @@ char Ev3InputDevice::lowLevelPort() const
 	return mLowLevelPort;
 }
 
-QByteArray Ev3InputDevice::readySiCommand(int port, int sensorMode)
-{
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_SI, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        //type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
-}
-
-QByteArray Ev3InputDevice::readyRawCommand(int port, int sensorMode)
+int Ev3InputDevice::addReadingTo(Ev3BatchedReadCommand &command) const
 {
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_RAW, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        // type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
+	return command.add(mLowLevelPort, mFormat, mSensorMode);
 }
 
-QByteArray Ev3InputDevice::readyPercentCommand(int port, int sensorMode)
+QByteArray Ev3InputDevice::read()
 {
-	QByteArray command = Ev3DirectCommand::formCommand(21, 2, 4, 0
-			, enums::commandType::CommandTypeEnum::DIRECT_COMMAND_REPLY);
-	int index = 7;
-	Ev3DirectCommand::addOpcode(enums::opcode::OpcodeEnum::INPUT_DEVICE_READY_PCT, command, index);
-	Ev3DirectCommand::addByteParameter(enums::daisyChainLayer::DaisyChainLayerEnum::EV3, command, index);
-	Ev3DirectCommand::addByteParameter(port, command, index);
-	Ev3DirectCommand::addByteParameter(0x00, command, index);        // type (0 = Don’t change type)
-	Ev3DirectCommand::addByteParameter(sensorMode, command, index);  // mode – Device mode [0-7]
-	Ev3DirectCommand::addByteParameter(0x01, command, index);        // # values
-	Ev3DirectCommand::addGlobalIndex(0x00, command, index);          // index for return data
-	return command;
+	Ev3BatchedReadCommand command;
+	addReadingTo(command);
+	QByteArray reply;
+	mRobotCommunicator.send(command.command(), command.responseSize(), reply);
+	return Ev3BatchedReadCommand::reading(reply, 0);
 }
@@ -18,34 +18,56 @@
 
 #include <kitBase/robotModel/robotParts/abstractSensor.h>
 #include <utils/robotCommunication/robotCommunicator.h>
+#include <ev3Kit/communication/ev3BatchedReadCommand.h>
 
 namespace ev3 {
 namespace robotModel {
 namespace real {
 namespace parts {
 
+/// Common implementation of EV3 input devices. Knows the port, the format and the mode in which device is read,
+/// so the same request can be sent alone or as a part of batched reading of several devices.
 class Ev3InputDevice : public QObject
 {
 	Q_OBJECT
 
 public:
 	Ev3InputDevice(utils::robotCommunication::RobotCommunicator &robotCommunicator
-			, const kitBase::robotModel::PortInfo &port);
+			, const kitBase::robotModel::PortInfo &port
+			, communication::Ev3BatchedReadCommand::Format format
+			, int sensorMode);
 
 	void send(const QByteArray &command, const unsigned responseSize, QByteArray reading);
 
 	/// Returns a value of port that can be used as corresponding byte in request packages.
 	char lowLevelPort() const;
 
-	QByteArray readySiCommand(int port, int sensorMode);
-	QByteArray readyRawCommand(int port, int sensorMode);
-	QByteArray readyPercentCommand(int port, int sensorMode);
+	/// Adds reading of this device to the given batched command.
+	/// @returns index of the reading in a reply or -1 if the command is full.
+	int addReadingTo(communication::Ev3BatchedReadCommand &command) const;
 
-private:
-	//enums::inputPort::InputPortEnum parsePort();
+	/// Synchronously reads this device alone.
+	/// @returns 4 bytes of the reading or empty array if reading failed.
+	QByteArray read();
 
+private:
 	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
 	char mLowLevelPort;
+	communication::Ev3BatchedReadCommand::Format mFormat;
+	int mSensorMode;
+};
+
+/// Sensor that can be read within one batched command together with other sensors, see RealRobotModel.
+class Ev3BatchableSensor
+{
+public:
+	virtual ~Ev3BatchableSensor() {}
+
+	/// Returns input device implementation that describes the reading request of this sensor.
+	virtual const Ev3InputDevice &inputDevice() const = 0;
+
+	/// Decodes the reading obtained for this sensor and emits new data. Empty reading means failure.
+	virtual void processReading(const QByteArray &reading) = 0;
 };
 
 }
@@ -14,8 +14,6 @@
 
 #include "gyroscope.h"
 
-const unsigned gyroscopeSensorResponseSize = 9;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -23,8 +21,7 @@ Gyroscope::Gyroscope(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: kitBase::robotModel::robotParts::GyroscopeSensor(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::percent, 0)
 {
 }
 
@@ -36,8 +33,20 @@ void Gyroscope::calibrate()
 
 void Gyroscope::read()
 {
-	const QByteArray command = mImplementation.readyPercentCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, gyroscopeSensorResponseSize, outputBuf);
-	setLastData({static_cast<int>(outputBuf.data()[5])});
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &Gyroscope::inputDevice() const
+{
+	return mImplementation;
+}
+
+void Gyroscope::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	setLastData({static_cast<int>(reading[0])});
 }
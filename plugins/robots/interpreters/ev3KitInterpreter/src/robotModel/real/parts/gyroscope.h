@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class Gyroscope : public kitBase::robotModel::robotParts::GyroscopeSensor
+class Gyroscope : public kitBase::robotModel::robotParts::GyroscopeSensor, public Ev3BatchableSensor
 {
 	Q_OBJECT
 
@@ -35,11 +35,13 @@ public:
 
 	void read() override;
 
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
+
 	void calibrate() override;
 
 private:
 	Ev3InputDevice mImplementation;
-	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
 };
 
 }
@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class LightSensor : public kitBase::robotModel::robotParts::LightSensor
+class LightSensor : public kitBase::robotModel::robotParts::LightSensor, public Ev3BatchableSensor
 {
 	Q_OBJECT
 
@@ -35,9 +35,11 @@ public:
 
 	void read() override;
 
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
+
 private:
 	Ev3InputDevice mImplementation;
-	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
 };
 
 }
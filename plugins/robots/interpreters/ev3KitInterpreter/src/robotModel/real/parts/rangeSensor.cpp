@@ -16,8 +16,6 @@
 
 #include <qrkernel/logging.h>
 
-const unsigned rangeSensorResponseSize = 10;
-
 using namespace ev3::robotModel::real::parts;
 using namespace kitBase::robotModel;
 
@@ -25,25 +23,35 @@ RangeSensor::RangeSensor(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: robotParts::RangeSensor(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::si, 0)
 {
 }
 
 void RangeSensor::read()
 {
-	QByteArray command = mImplementation.readySiCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, rangeSensorResponseSize, outputBuf);
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &RangeSensor::inputDevice() const
+{
+	return mImplementation;
+}
+
+void RangeSensor::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
 
 	union {
 		float f;
 		uchar b[4];
 	} floatFromBytesCast {};
-	floatFromBytesCast.b[3] = outputBuf.data()[8];
-	floatFromBytesCast.b[2] = outputBuf.data()[7];
-	floatFromBytesCast.b[1] = outputBuf.data()[6];
-	floatFromBytesCast.b[0] = outputBuf.data()[5];
+	floatFromBytesCast.b[3] = reading[3];
+	floatFromBytesCast.b[2] = reading[2];
+	floatFromBytesCast.b[1] = reading[1];
+	floatFromBytesCast.b[0] = reading[0];
 
 	const int data = qIsNaN(floatFromBytesCast.f) ? 0 : static_cast<int>(floatFromBytesCast.f);
 	emit newData(data);
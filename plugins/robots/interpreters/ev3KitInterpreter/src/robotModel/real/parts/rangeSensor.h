@@ -24,7 +24,7 @@ namespace robotModel {
 namespace real {
 namespace parts {
 
-class RangeSensor : public kitBase::robotModel::robotParts::RangeSensor
+class RangeSensor : public kitBase::robotModel::robotParts::RangeSensor, public Ev3BatchableSensor
 {
 	Q_OBJECT
 	Q_CLASSINFO("name", "sonar")
@@ -37,9 +37,11 @@ public:
 
 	void read() override;
 
+	const Ev3InputDevice &inputDevice() const override;
+	void processReading(const QByteArray &reading) override;
+
 private:
 	Ev3InputDevice mImplementation;
-	utils::robotCommunication::RobotCommunicator &mRobotCommunicator;
 };
 
 }
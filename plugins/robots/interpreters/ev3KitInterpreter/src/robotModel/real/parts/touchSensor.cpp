@@ -14,7 +14,6 @@
 
 #include "touchSensor.h"
 
-const unsigned touchSensorResponseSize = 9;
 const unsigned pressed = 63;
 
 using namespace ev3::robotModel::real::parts;
@@ -24,17 +23,28 @@ TouchSensor::TouchSensor(const kitBase::robotModel::DeviceInfo &info
 		, const kitBase::robotModel::PortInfo &port
 		, utils::robotCommunication::RobotCommunicator &robotCommunicator)
 	: robotParts::TouchSensor(info, port)
-	, mImplementation(robotCommunicator, port)
-	, mRobotCommunicator(robotCommunicator)
+	, mImplementation(robotCommunicator, port, communication::Ev3BatchedReadCommand::Format::si, 0)
 {
 }
 
 void TouchSensor::read()
 {
-	const QByteArray command = mImplementation.readySiCommand(mImplementation.lowLevelPort(), 0);
-	QByteArray outputBuf;
-	mRobotCommunicator.send(command, touchSensorResponseSize, outputBuf);
-	if (outputBuf.data()[8] == pressed) {
+	processReading(mImplementation.read());
+}
+
+const Ev3InputDevice &TouchSensor::inputDevice() const
+{
+	return mImplementation;
+}
+
+void TouchSensor::processReading(const QByteArray &reading)
+{
+	if (reading.isEmpty()) {
+		emit failure();
+		return;
+	}
+
+	if (reading[3] == pressed) {
 		emit newData(1);
 	} else {
 		emit newData(0);
@@ -15,6 +15,7 @@
 #include "realRobotModel.h"
 
 #include <qrkernel/settingsManager.h>
+#include <ev3Kit/communication/ev3BatchedReadCommand.h>
 
 #include "parts/display.h"
 #include "parts/speaker.h"
@@ -35,6 +36,7 @@
 #include "parts/gyroscope.h"
 
 using namespace ev3::robotModel::real;
+using namespace ev3::communication;
 using namespace utils::robotCommunication;
 using namespace kitBase::robotModel;
 
@@ -65,6 +67,72 @@ void RealRobotModel::disconnectFromRobot()
 	mRobotCommunicator->disconnect();
 }
 
+void RealRobotModel::updateSensorsValues() const
+{
+	QList<robotParts::AbstractSensor *> sensors;
+	for (robotParts::Device * const device : configuration().devices()) {
+		robotParts::AbstractSensor * const sensor = dynamic_cast<robotParts::AbstractSensor *>(device);
+		if (sensor && !sensor->port().reservedVariable().isEmpty()) {
+			sensors << sensor;
+		}
+	}
+
+	readSensors(sensors);
+}
+
+void RealRobotModel::updateSensorsValuesOn(const QList<PortInfo> &ports) const
+{
+	QList<robotParts::AbstractSensor *> sensors;
+	for (const PortInfo &port : ports) {
+		robotParts::AbstractSensor * const sensor = dynamic_cast<robotParts::AbstractSensor *>(
+				configuration().device(port));
+		if (sensor) {
+			sensors << sensor;
+		}
+	}
+
+	readSensors(sensors);
+}
+
+void RealRobotModel::readSensors(const QList<robotParts::AbstractSensor *> &sensors) const
+{
+	Ev3BatchedReadCommand command;
+	QList<parts::Ev3BatchableSensor *> batch;
+	for (robotParts::AbstractSensor * const sensor : sensors) {
+		if (!sensor->ready() || sensor->isLocked()) {
+			continue;
+		}
+
+		parts::Ev3BatchableSensor * const batchable = dynamic_cast<parts::Ev3BatchableSensor *>(sensor);
+		if (!batchable) {
+			sensor->read();
+			continue;
+		}
+
+		batchable->inputDevice().addReadingTo(command);
+		batch << batchable;
+		if (command.isFull()) {
+			sendBatch(command, batch);
+			command = Ev3BatchedReadCommand();
+			batch.clear();
+		}
+	}
+
+	if (!batch.isEmpty()) {
+		sendBatch(command, batch);
+	}
+}
+
+void RealRobotModel::sendBatch(const Ev3BatchedReadCommand &command
+		, const QList<parts::Ev3BatchableSensor *> &sensors) const
+{
+	QByteArray reply;
+	mRobotCommunicator->send(command.command(), command.responseSize(), reply);
+	for (int i = 0; i < sensors.size(); ++i) {
+		sensors[i]->processReading(Ev3BatchedReadCommand::reading(reply, i));
+	}
+}
+
 robotParts::Device *RealRobotModel::createDevice(const PortInfo &port, const DeviceInfo &deviceInfo)
 {
 	if (deviceInfo.isA(speakerInfo())) {
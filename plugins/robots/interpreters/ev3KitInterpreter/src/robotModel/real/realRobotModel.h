@@ -17,10 +17,20 @@
 #include <ev3Kit/robotModel/ev3RobotModelBase.h>
 #include <utils/robotCommunication/robotCommunicator.h>
 
+namespace ev3 {
+namespace communication {
+class Ev3BatchedReadCommand;
+}
+}
+
 namespace ev3 {
 namespace robotModel {
 namespace real {
 
+namespace parts {
+class Ev3BatchableSensor;
+}
+
 class RealRobotModel : public Ev3RobotModelBase
 {
 	Q_OBJECT
@@ -34,6 +44,11 @@ public:
 	void connectToRobot() override;
 	void disconnectFromRobot() override;
 
+	/// Reads all sensors within as few direct commands as possible, one round trip to the brick for every
+	/// Ev3BatchedReadCommand::maxReadings sensors instead of one round trip per sensor.
+	void updateSensorsValues() const override;
+	void updateSensorsValuesOn(const QList<kitBase::robotModel::PortInfo> &ports) const override;
+
 signals:
 	/// Emitted when communicator throws an error to be displayed with error reporter.
 	void errorOccured(const QString &text);
@@ -46,6 +61,13 @@ private:
 			const kitBase::robotModel::PortInfo &port
 			, const kitBase::robotModel::DeviceInfo &deviceInfo) override;
 
+	/// Reads given sensors, batching those that support it.
+	void readSensors(const QList<kitBase::robotModel::robotParts::AbstractSensor *> &sensors) const;
+
+	/// Sends batched command and passes each reading from the reply to its sensor.
+	void sendBatch(const communication::Ev3BatchedReadCommand &command
+			, const QList<parts::Ev3BatchableSensor *> &sensors) const;
+
 	// WARNING: This class must be disposed in the last turn so do not make it storing by value.
 	utils::robotCommunication::RobotCommunicator *mRobotCommunicator;  // Takes ownership
 	QString mLastCommunicationValue;
@@ -17,7 +17,9 @@
 #include <QtCore/QTimer>
 #include <QtCore/QObject>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
 
+#include <qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterface.h>
 #include <kitBase/robotModel/robotModelManagerInterface.h>
 
 #include "interpreterCore/textLanguage/robotsBlockParser.h"
@@ -31,6 +33,9 @@ namespace interpreter {
 namespace details {
 
 /// Keeps sensor variables available from math expressions in a program up to date, by querying robot model.
+/// Sensors whose variables or ports are mentioned somewhere in a program are polled every updating interval of robot
+/// model, other sensors are polled once in 10 intervals, just to keep watch windows alive. The split is decided once
+/// when polling starts, a sensor is not re-rated by how often a program actually reads it.
 /// Expects that model does not change and sensors are not reconfigured when updating is active.
 class SensorVariablesUpdater : public QObject
 {
@@ -40,8 +45,11 @@ public:
 	/// Constructor.
 	/// @param robotModelManager - has reference to current robot model.
 	/// @param parser - contains sensor variables and is needed here to update them.
+	/// @param logicalModelApi - a program that is going to be interpreted, used to find out which sensor variables
+	///        it uses. If not provided, all sensors are polled every updating interval.
 	SensorVariablesUpdater(const kitBase::robotModel::RobotModelManagerInterface &robotModelManager
 			, qrtext::DebuggerInterface &textLanguageToolbox
+			, const qReal::LogicalModelAssistInterface *logicalModelApi = nullptr
 			);
 
 	~SensorVariablesUpdater();
@@ -55,26 +63,47 @@ public slots:
 
 private slots:
 	void onTimerTimeout();
-	void onScalarSensorResponse(int reading);
-	void onVectorSensorResponse(const QVector<int> &reading);
 	void onFailure();
 
 private:
+	/// Polled sensor with everything needed to update its variable resolved once when polling starts.
+	struct SensorSlot
+	{
+		kitBase::robotModel::PortInfo port;
+		QString variable;
+
+		/// Sensor is polled once in this number of updating intervals.
+		int period = 1;
+
+		/// Last reading pushed into the parser, used to skip updates that change nothing.
+		QVector<int> lastReading;
+		bool hasReading = false;
+	};
+
 	int updateInterval() const;
 
-	void updateScalarSensorVariables(const kitBase::robotModel::PortInfo &sensorPortInfo, int reading);
-	void updateScalarSensorVariable(const QString &variable, int reading);
+	/// Polls sensors that are due on the current updating interval.
+	void pollSensors();
 
-	void updateVectorSensorVariables(const kitBase::robotModel::PortInfo &sensorPortInfo
-			, const QVector<int> &reading);
+	/// Returns a set of sensor variables mentioned in properties of program elements directly or by port name
+	/// (like in wait blocks), or all variables if there is no program to analyze.
+	/// @param portVariables - maps port names and aliases to the variables of sensors on these ports.
+	QSet<QString> referencedVariables(const QSet<QString> &sensorVariables
+			, const QHash<QString, QString> &portVariables) const;
 
-	void updateVectorSensorVariable(const QString &variable, const QVector<int> &reading);
+	void updateScalarSensorVariable(SensorSlot &slot, int reading);
+	void updateVectorSensorVariable(SensorSlot &slot, const QVector<int> &reading);
 
 	void resetVariables();
 
 	QScopedPointer<utils::AbstractTimer> mUpdateTimer;
 	const kitBase::robotModel::RobotModelManagerInterface &mRobotModelManager;
 	qrtext::DebuggerInterface &mParser;
+	const qReal::LogicalModelAssistInterface *mLogicalModelApi;
+
+	QList<SensorSlot> mSlots;
+	QList<QMetaObject::Connection> mSensorConnections;
+	int mUpdatesCount = 0;
 };
 
 }
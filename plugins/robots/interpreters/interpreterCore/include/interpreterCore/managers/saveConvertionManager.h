@@ -16,6 +16,8 @@
 
 #include <functional>
 #include <QtCore/QList>
+#include <QtCore/QPair>
+#include <QtXml/QDomDocument>
 
 #include <qrgui/plugins/toolPluginInterface/projectConverter.h>
 
@@ -75,17 +77,18 @@ private:
 	static bool isRobotsDiagram(const qReal::Id &element);
 	static bool isDiagramType(const qReal::Id &element);
 	static bool isEdgeType(const qReal::Id &element);
-	static qReal::IdList elementsOfRobotsDiagrams(const qReal::LogicalModelAssistInterface &logicalApi);
 	static QString editor();
 	static void reconnectEdges(const qReal::Id &newBlock, const qReal::Id &block
 							   , qReal::details::ModelsAssistInterface &Api);
 
 	/// Helper method, creates "typical" that applies a list of filters to a block if block satisfies given condition.
+	/// Filters form a single element rewriting rule, so the converter is fused with neighbouring rule-based
+	/// converters and does not traverse the model by itself.
 	/// @param oldVersion - version from which converter can convert.
 	/// @param newVersion - version to which converter converts save.
 	/// @param filters - a list of elementary conversion steps. Each filter is a function that takes Id of a block
 	///        and logical model API and shall return true if it has changed something or false if it did nothing.
-	///        Every filter will be called for every logical block in a save.
+	///        Every filter will be called for every logical block of robots diagrams in a save.
 	/// @param condition - logical predicate that shall be true for a block to be processed.
 	static qReal::ProjectConverter constructConverter(const QString &oldVersion, const QString &newVersion
 			, const QList<LogicalFilter> &logicalFilters
@@ -94,6 +97,19 @@ private:
 					= [] (const qReal::Id &block) { return !block.isNull(); }
 			);
 
+	/// Helper method, constructs converter that rewrites world model of a save.
+	static qReal::ProjectConverter constructWorldModelConverter(const QString &oldVersion, const QString &newVersion
+			, const qReal::ProjectConverter::XmlRewriter &rewriter);
+
+	/// Helper method, calls \a rewriter for every attribute value and text of \a node and its descendants.
+	/// Attribute name is passed to \a rewriter along with the value, empty name is passed for texts.
+	/// Returns true if \a rewriter returned true for some value, it means that value was modified.
+	static bool rewriteXmlValues(const QDomNode &node
+			, const std::function<bool(const QString &, QString &)> &rewriter);
+
+	/// Helper method, applies replacements in the given order to every attribute value and text of a document.
+	static bool replaceInXml(QDomDocument &document, const QList<QPair<QString, QString>> &replacementRules);
+
 	/// Helper method, constructs property replace filter. Takes map in form { {<from>, <to>}, ... } and applies
 	/// replacements coded in this map to every property of a block.
 	static LogicalFilter replace(const QMap<QString, QString> &replacementRules);
@@ -22,11 +22,16 @@
 using namespace interpreterCore::interpreter::details;
 using namespace kitBase::robotModel;
 
+/// Sensors not mentioned in a program are polled once in this number of updating intervals.
+static const int unreferencedSensorPeriod = 10;
+
 SensorVariablesUpdater::SensorVariablesUpdater(const RobotModelManagerInterface &robotModelManager
 		, qrtext::DebuggerInterface &textLanguageToolbox
+		, const qReal::LogicalModelAssistInterface *logicalModelApi
 		)
 	: mRobotModelManager(robotModelManager)
 	, mParser(textLanguageToolbox)
+	, mLogicalModelApi(logicalModelApi)
 {
 }
 
@@ -38,69 +43,66 @@ void SensorVariablesUpdater::run()
 {
 	mUpdateTimer.reset(mRobotModelManager.model().timeline().produceTimer());
 	connect(mUpdateTimer.data(), &utils::AbstractTimer::timeout, this, &SensorVariablesUpdater::onTimerTimeout);
-	resetVariables();
 
-	for (robotParts::Device * const device : mRobotModelManager.model().configuration().devices()) {
-		robotParts::ScalarSensor * const scalarSensor = dynamic_cast<robotParts::ScalarSensor *>(device);
-		if (scalarSensor && !scalarSensor->port().reservedVariable().isEmpty()) {
+	for (const QMetaObject::Connection &connection : mSensorConnections) {
+		disconnect(connection);
+	}
 
-			if (!scalarSensor->ready()) {
-				/// @todo Error reporting
-				continue;
-			}
+	mSensorConnections.clear();
+	mSlots.clear();
+	mUpdatesCount = 0;
 
-			using namespace std::placeholders;
-			connect(
-					scalarSensor
-					, &robotParts::ScalarSensor::newData
-					, this
-					, std::bind(&SensorVariablesUpdater::onScalarSensorResponse, this,
-									std::bind(&QVariant::value<int>, _1))
-					, Qt::UniqueConnection
-					);
-
-			connect(
-					scalarSensor
-					, &robotParts::AbstractSensor::failure
-					, this
-					, &SensorVariablesUpdater::onFailure
-					, Qt::UniqueConnection
-					);
+	resetVariables();
 
+	QList<robotParts::AbstractSensor *> sensors;
+	QSet<QString> sensorVariables;
+	QHash<QString, QString> portVariables;
+	for (robotParts::Device * const device : mRobotModelManager.model().configuration().devices()) {
+		robotParts::AbstractSensor * const sensor = dynamic_cast<robotParts::AbstractSensor *>(device);
+		if (!sensor || sensor->port().reservedVariable().isEmpty()) {
 			continue;
 		}
 
-		robotParts::VectorSensor * const vectorSensor = dynamic_cast<robotParts::VectorSensor *>(device);
-		if (vectorSensor && !vectorSensor->port().reservedVariable().isEmpty()) {
-
-			if (!vectorSensor->ready()) {
-				/// @todo Error reporting
-				continue;
-			}
+		if (!sensor->ready()) {
+			/// @todo Error reporting
+			continue;
+		}
 
-			using namespace std::placeholders;
-			connect(
-					vectorSensor
-					, &robotParts::VectorSensor::newData
-					, this
-					, std::bind(&SensorVariablesUpdater::onVectorSensorResponse,
-								this, std::bind(&QVariant::value<QVector<int>>, _1))
-					, Qt::UniqueConnection
-					);
-
-			connect(
-					vectorSensor
-					, &robotParts::AbstractSensor::failure
-					, this
-					, &SensorVariablesUpdater::onFailure
-					, Qt::UniqueConnection
-					);
+		sensors << sensor;
+		sensorVariables << sensor->port().reservedVariable();
+		portVariables[sensor->port().name()] = sensor->port().reservedVariable();
+		for (const QString &alias : sensor->port().nameAliases()) {
+			portVariables[alias] = sensor->port().reservedVariable();
+		}
+	}
 
-			continue;
+	const QSet<QString> usedVariables = referencedVariables(sensorVariables, portVariables);
+
+	for (robotParts::AbstractSensor * const sensor : sensors) {
+		SensorSlot slot;
+		slot.port = sensor->port();
+		slot.variable = sensor->port().reservedVariable();
+		slot.period = usedVariables.contains(slot.variable) ? 1 : unreferencedSensorPeriod;
+		const int index = mSlots.size();
+		mSlots << slot;
+
+		if (robotParts::ScalarSensor * const scalarSensor = dynamic_cast<robotParts::ScalarSensor *>(sensor)) {
+			mSensorConnections << connect(scalarSensor, &robotParts::ScalarSensor::newData, this
+					, [this, index](const QVariant &reading) {
+						updateScalarSensorVariable(mSlots[index], reading.value<int>());
+					});
+		} else if (robotParts::VectorSensor * const vectorSensor = dynamic_cast<robotParts::VectorSensor *>(sensor)) {
+			mSensorConnections << connect(vectorSensor, &robotParts::VectorSensor::newData, this
+					, [this, index](const QVariant &reading) {
+						updateVectorSensorVariable(mSlots[index], reading.value<QVector<int>>());
+					});
 		}
+
+		mSensorConnections << connect(sensor, &robotParts::AbstractSensor::failure
+				, this, &SensorVariablesUpdater::onFailure);
 	}
 
-	mRobotModelManager.model().updateSensorsValues();
+	pollSensors();
 
 	mUpdateTimer->start(updateInterval());
 }
@@ -112,33 +114,75 @@ void SensorVariablesUpdater::suspend()
 	}
 }
 
-void SensorVariablesUpdater::onScalarSensorResponse(int reading)
+void SensorVariablesUpdater::onTimerTimeout()
 {
-	robotParts::ScalarSensor * const scalarSensor = dynamic_cast<robotParts::ScalarSensor *>(sender());
-	if (!scalarSensor) {
-		/// @todo Error reporting.
-		return;
-	}
+	++mUpdatesCount;
+	pollSensors();
 
-	updateScalarSensorVariables(scalarSensor->port(), reading);
+	mUpdateTimer->start(updateInterval());
 }
 
-void SensorVariablesUpdater::onVectorSensorResponse(const QVector<int> &reading)
+void SensorVariablesUpdater::pollSensors()
 {
-	robotParts::VectorSensor * const vectorSensor = dynamic_cast<robotParts::VectorSensor *>(sender());
-	if (!vectorSensor) {
-		/// @todo Error reporting.
-		return;
+	QList<PortInfo> ports;
+	for (const SensorSlot &slot : mSlots) {
+		if (mUpdatesCount % slot.period == 0) {
+			ports << slot.port;
+		}
 	}
 
-	updateVectorSensorVariables(vectorSensor->port(), reading);
+	if (!ports.isEmpty()) {
+		mRobotModelManager.model().updateSensorsValuesOn(ports);
+	}
 }
 
-void SensorVariablesUpdater::onTimerTimeout()
+QSet<QString> SensorVariablesUpdater::referencedVariables(const QSet<QString> &sensorVariables
+		, const QHash<QString, QString> &portVariables) const
 {
-	mRobotModelManager.model().updateSensorsValues();
+	if (!mLogicalModelApi) {
+		return sensorVariables;
+	}
 
-	mUpdateTimer->start(updateInterval());
+	const qrRepo::LogicalRepoApi &repo = mLogicalModelApi->logicalRepoApi();
+	QSet<QString> result;
+	qReal::IdList toVisit = repo.children(qReal::Id::rootId());
+	while (!toVisit.isEmpty() && result.size() < sensorVariables.size()) {
+		const qReal::Id element = toVisit.takeLast();
+		toVisit << repo.children(element);
+		QMapIterator<QString, QVariant> property = repo.propertiesIterator(element);
+		while (property.hasNext()) {
+			property.next();
+			if (property.value().type() != QVariant::String) {
+				continue;
+			}
+
+			const QString code = property.value().toString();
+			const QString portVariable = portVariables.value(code.trimmed());
+			if (!portVariable.isEmpty()) {
+				result << portVariable;
+				continue;
+			}
+
+			for (int i = 0; i < code.length(); ) {
+				if (!code[i].isLetter() && code[i] != '_') {
+					++i;
+					continue;
+				}
+
+				const int start = i;
+				while (i < code.length() && (code[i].isLetterOrNumber() || code[i] == '_')) {
+					++i;
+				}
+
+				const QString word = code.mid(start, i - start);
+				if (sensorVariables.contains(word)) {
+					result << word;
+				}
+			}
+		}
+	}
+
+	return result;
 }
 
 int SensorVariablesUpdater::updateInterval() const
@@ -150,24 +194,26 @@ void SensorVariablesUpdater::onFailure()
 {
 }
 
-void SensorVariablesUpdater::updateScalarSensorVariables(const PortInfo &sensorPortInfo, int reading)
+void SensorVariablesUpdater::updateScalarSensorVariable(SensorSlot &slot, int reading)
 {
-	updateScalarSensorVariable(sensorPortInfo.reservedVariable(), reading);
-}
+	if (slot.hasReading && slot.lastReading.size() == 1 && slot.lastReading[0] == reading) {
+		return;
+	}
 
-void SensorVariablesUpdater::updateScalarSensorVariable(const QString &variable, int reading)
-{
-	mParser.setVariableValue(variable, reading);
+	slot.lastReading = { reading };
+	slot.hasReading = true;
+	mParser.setVariableValue(slot.variable, reading);
 }
 
-void SensorVariablesUpdater::updateVectorSensorVariables(const PortInfo &sensorPortInfo, const QVector<int> &reading)
+void SensorVariablesUpdater::updateVectorSensorVariable(SensorSlot &slot, const QVector<int> &reading)
 {
-	updateVectorSensorVariable(sensorPortInfo.reservedVariable(), reading);
-}
+	if (slot.hasReading && slot.lastReading == reading) {
+		return;
+	}
 
-void SensorVariablesUpdater::updateVectorSensorVariable(const QString &variable, const QVector<int> &reading)
-{
-	mParser.setVectorVariableValue(variable, reading);
+	slot.lastReading = reading;
+	slot.hasReading = true;
+	mParser.setVectorVariableValue(slot.variable, reading);
 }
 
 void SensorVariablesUpdater::resetVariables()
@@ -183,13 +229,13 @@ void SensorVariablesUpdater::resetVariables()
 
 		robotParts::ScalarSensor * const scalarSensor = dynamic_cast<robotParts::ScalarSensor *>(device);
 		if (scalarSensor) {
-			updateScalarSensorVariables(scalarSensor->port(), 0);
+			mParser.setVariableValue(scalarSensor->port().reservedVariable(), 0);
 		}
 
 		robotParts::VectorSensor * const vectorSensor = dynamic_cast<robotParts::VectorSensor *>(device);
 		if (vectorSensor) {
 			scalarSensor->setLocked(false);
-			updateVectorSensorVariables(vectorSensor->port(), {});
+			mParser.setVectorVariableValue(vectorSensor->port().reservedVariable(), QVector<int>());
 		}
 	}
 }
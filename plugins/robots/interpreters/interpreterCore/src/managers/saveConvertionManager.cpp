@@ -13,7 +13,6 @@
  * limitations under the License. */
 
 #include "interpreterCore/managers/saveConvertionManager.h"
-#include "QDomDocument"
 
 using namespace interpreterCore;
 using namespace qReal;
@@ -241,112 +240,88 @@ ProjectConverter SaveConvertionManager::from312to313Converter()
 
 ProjectConverter SaveConvertionManager::from320to330Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("3.2.0"), Version::fromString("3.3.0")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &logicalApi)
-	{
-		QString worldModel = logicalApi.logicalRepoApi().metaInformation("worldModel").toString();
-		if (!worldModel.contains("trikV62KitRobot")) {
-			return ProjectConverter::NoModificationsMade;
-		}
-		worldModel.replace("trikV62KitRobot", "trikKitRobot");
-		logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel);
-		return ProjectConverter::Success;
+	return constructWorldModelConverter("3.2.0", "3.3.0", [](QDomDocument &worldModel) {
+		return replaceInXml(worldModel, {{"trikV62KitRobot", "trikKitRobot"}});
 	});
 }
 
 ProjectConverter SaveConvertionManager::from330to20204Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("3.3.0"), Version::fromString("2020.4")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &logicalApi)
-	{
-		QString worldModel = logicalApi.logicalRepoApi().metaInformation("worldModel").toString();
-		if (!worldModel.contains("trik::robotModel::parts::TrikLineSensor")
-				&& !worldModel.contains("value=\"trik::robotModel::twoD::parts::TwoDInfraredSensor")) {
-			return ProjectConverter::NoModificationsMade;
-		}
+	return constructWorldModelConverter("3.3.0", "2020.4", [](QDomDocument &worldModel) {
+		const QString infraredSensor = "trik::robotModel::twoD::parts::TwoDInfraredSensor";
+		bool hasOldSensors = false;
+		rewriteXmlValues(worldModel, [&](const QString &name, QString &value) {
+			hasOldSensors |= value.contains("trik::robotModel::parts::TrikLineSensor")
+					|| (name == "value" && value.startsWith(infraredSensor));
+			return false;
+		});
 
-		worldModel.replace("value=\"trik::robotModel::twoD::parts::TwoDInfraredSensor"
-				, "value=\"twoDModel::robotModel::parts::RangeSensor");
+		if (!hasOldSensors) {
+			return false;
+		}
 
-		worldModel.replace("TrikLineSensorPort###lineSensor", "###");
-		worldModel.replace("LineSensorPort", "Video2Port");
+		rewriteXmlValues(worldModel, [&](const QString &name, QString &value) {
+			const QString oldValue = value;
+			if (name == "value" && value.startsWith(infraredSensor)) {
+				value.replace(0, infraredSensor.length(), "twoDModel::robotModel::parts::RangeSensor");
+			}
 
-		worldModel.replace("TrikLineSensor", "TrikVideoCamera");
+			value.replace("TrikLineSensorPort###lineSensor", "###");
+			value.replace("LineSensorPort", "Video2Port");
+			value.replace("TrikLineSensor", "TrikVideoCamera");
+			return value != oldValue;
+		});
 
-		logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel);
-		return ProjectConverter::Success;
+		return true;
 	});
 }
 
 ProjectConverter SaveConvertionManager::from20204to20205Converter()
 {
 	return ProjectConverter(editor(), Version::fromString("2020.4"), Version::fromString("2020.4.1")
-			, [=](GraphicalModelAssistInterface &graphicalApi, LogicalModelAssistInterface &logicalApi)
+			, { [=](const Id &logicalBlock, GraphicalModelAssistInterface &graphicalApi
+					, LogicalModelAssistInterface &logicalApi)
 	{
-		if (!logicalApi.logicalRepoApi()
-				.metaInformation("lastKitId").toString().contains("trik", Qt::CaseInsensitive)) {
-			return ProjectConverter::NoModificationsMade;
+		if (!isRobotsDiagram(logicalBlock) || logicalBlock.element() != "PrintText"
+				|| !logicalApi.logicalRepoApi().metaInformation("lastKitId").toString()
+						.contains("trik", Qt::CaseInsensitive)) {
+			return false;
 		}
 
-		bool modificationsMade = false;
-
-		for (const Id &block : elementsOfRobotsDiagrams(logicalApi)) {
-			const Id logicalBlock = graphicalApi.isGraphicalId(block)
-					? graphicalApi.logicalId(block)
-					: block;
-
-			Id graphicalBlock;
-			if (graphicalApi.isGraphicalId(block)) {
-				graphicalBlock = block;
-			} else {
-				const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
-				if (graphicalIds.isEmpty()) {
-					continue;
-				}
-
-				graphicalBlock = graphicalIds.first();
-			}
+		const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
+		if (graphicalIds.isEmpty()) {
+			return false;
+		}
 
-			if (graphicalBlock.element() == "PrintText") {
-				const auto newType = Id(graphicalBlock.editor(), graphicalBlock.diagram(), "TrikPrintText");
-				const auto newGraphicalBlock = graphicalApi.createElement(graphicalApi.parent(graphicalBlock)
-						, newType.sameTypeId()
-						, false
-						, graphicalApi.name(graphicalBlock)
-						, graphicalApi.position(graphicalBlock)
-						, logicalApi.createElement(logicalApi.parent(logicalBlock), newType));
-				graphicalApi.copyProperties(newGraphicalBlock, graphicalBlock);
-				const auto newLogicalBlock = graphicalApi.logicalId(newGraphicalBlock);
-
-				auto iterator = logicalApi.logicalRepoApi().propertiesIterator(logicalBlock);
-				while (iterator.hasNext()) {
-					iterator.next();
-					logicalApi.mutableLogicalRepoApi().setProperty(newLogicalBlock, iterator.key(), iterator.value());
-				}
+		const Id graphicalBlock = graphicalIds.first();
+		const auto newType = Id(graphicalBlock.editor(), graphicalBlock.diagram(), "TrikPrintText");
+		const auto newGraphicalBlock = graphicalApi.createElement(graphicalApi.parent(graphicalBlock)
+				, newType.sameTypeId()
+				, false
+				, graphicalApi.name(graphicalBlock)
+				, graphicalApi.position(graphicalBlock)
+				, logicalApi.createElement(logicalApi.parent(logicalBlock), newType));
+		graphicalApi.copyProperties(newGraphicalBlock, graphicalBlock);
+		const auto newLogicalBlock = graphicalApi.logicalId(newGraphicalBlock);
 
-				logicalApi.setPropertyByRoleName(newLogicalBlock, 20, "FontSize");
-				reconnectEdges(newGraphicalBlock, graphicalBlock, graphicalApi);
-				reconnectEdges(newLogicalBlock, logicalBlock, logicalApi);
-				graphicalApi.removeElement(graphicalBlock);
-				logicalApi.removeElement(logicalBlock);
-				modificationsMade = true;
-			}
+		auto iterator = logicalApi.logicalRepoApi().propertiesIterator(logicalBlock);
+		while (iterator.hasNext()) {
+			iterator.next();
+			logicalApi.mutableLogicalRepoApi().setProperty(newLogicalBlock, iterator.key(), iterator.value());
 		}
 
-		return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
-	});
+		logicalApi.setPropertyByRoleName(newLogicalBlock, 20, "FontSize");
+		reconnectEdges(newGraphicalBlock, graphicalBlock, graphicalApi);
+		reconnectEdges(newLogicalBlock, logicalBlock, logicalApi);
+		graphicalApi.removeElement(graphicalBlock);
+		logicalApi.removeElement(logicalBlock);
+		return true;
+	}}, &isEdgeType);
 }
 
 ProjectConverter SaveConvertionManager::from20205to20222Converter()
 {
-	return ProjectConverter(editor(), Version::fromString("2020.5"), Version::fromString("2022.2")
-			, [=](GraphicalModelAssistInterface &, LogicalModelAssistInterface &logicalApi)
-	{
-		QString xml = logicalApi.logicalRepoApi().metaInformation("worldModel").toString();
-
-		if (xml.isEmpty()) return ProjectConverter::NoModificationsMade;
-		QDomDocument worldModel;
-		if (!worldModel.setContent(xml)) return ProjectConverter::SaveInvalid;
+	return constructWorldModelConverter("2020.5", "2022.2", [](QDomDocument &worldModel) {
 		QDomElement root = worldModel.firstChildElement("root");
 
 		QDomElement world = root.firstChildElement("world");
@@ -366,8 +341,7 @@ ProjectConverter SaveConvertionManager::from20205to20222Converter()
 		oldRobot.removeAttribute("direction");
 		// start position reparented automatically
 
-		logicalApi.mutableLogicalRepoApi().setMetaInformation("worldModel", worldModel.toString(4));
-		return ProjectConverter::Success;
+		return true;
 	});
 }
 
@@ -388,24 +362,6 @@ bool SaveConvertionManager::isEdgeType(const Id &element)
 	return element.element() == "ControlFlow";
 }
 
-IdList SaveConvertionManager::elementsOfRobotsDiagrams(const LogicalModelAssistInterface &logicalApi)
-{
-	IdList nodes;
-	IdList edges;
-	for (const Id &blockId : logicalApi.children(Id::rootId())) {
-		if (isRobotsDiagram(blockId)) {
-			if (isEdgeType(blockId)) {
-				edges += blockId;
-			} else {
-				nodes += blockId;
-			}
-		}
-	}
-
-	// When we traverse elements it is important to traverse first nodes and then edges.
-	return nodes + edges;
-}
-
 qReal::ProjectConverter SaveConvertionManager::constructConverter(const QString &oldVersion
 		, const QString &newVersion
 		, const QList<LogicalFilter> &logicalFilters
@@ -414,46 +370,90 @@ qReal::ProjectConverter SaveConvertionManager::constructConverter(const QString
 		)
 {
 	return ProjectConverter(editor(), Version::fromString(oldVersion), Version::fromString(newVersion)
-			, [=](GraphicalModelAssistInterface &graphicalApi, LogicalModelAssistInterface &logicalApi)
+			, { [=](const Id &logicalBlock, GraphicalModelAssistInterface &graphicalApi
+					, LogicalModelAssistInterface &logicalApi)
 	{
+		if (!isRobotsDiagram(logicalBlock) || !condition(logicalBlock)) {
+			return false;
+		}
+
 		bool modificationsMade = false;
+		for (const auto &filter : logicalFilters) {
+			modificationsMade |= filter(logicalBlock, logicalApi);
+		}
 
-		for (const Id &block : elementsOfRobotsDiagrams(logicalApi)) {
-			const Id logicalBlock = graphicalApi.isGraphicalId(block)
-					? graphicalApi.logicalId(block)
-					: block;
+		if (graphicalFilters.isEmpty()) {
+			// A small optimization not to count graphical id.
+			return modificationsMade;
+		}
 
-			if (!condition(logicalBlock)) {
-				continue;
-			}
+		const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
+		if (graphicalIds.isEmpty()) {
+			return modificationsMade;
+		}
 
-			for (const auto &filter : logicalFilters) {
-				modificationsMade |= filter(logicalBlock, logicalApi);
-			}
+		const Id graphicalBlock = graphicalIds.first();
+		for (const auto &filter : graphicalFilters) {
+			modificationsMade |= filter(graphicalBlock, graphicalApi);
+		}
 
-			if (graphicalFilters.isEmpty()) {
-				// A small optimization not to count graphical id.
-				continue;
-			}
+		return modificationsMade;
+	}}, &isEdgeType);
+}
 
-			Id graphicalBlock;
-			if (graphicalApi.isGraphicalId(block)) {
-				graphicalBlock = block;
-			} else {
-				const IdList graphicalIds = graphicalApi.graphicalIdsByLogicalId(logicalBlock);
-				if (graphicalIds.isEmpty()) {
-					continue;
-				}
+qReal::ProjectConverter SaveConvertionManager::constructWorldModelConverter(const QString &oldVersion
+		, const QString &newVersion
+		, const ProjectConverter::XmlRewriter &rewriter)
+{
+	return ProjectConverter(editor(), Version::fromString(oldVersion), Version::fromString(newVersion)
+			, QList<ProjectConverter::ElementRewriter>()
+			, ProjectConverter::EdgePredicate()
+			, {{"worldModel", rewriter}});
+}
 
-				graphicalBlock = graphicalIds.first();
+bool SaveConvertionManager::rewriteXmlValues(const QDomNode &node
+		, const std::function<bool(const QString &, QString &)> &rewriter)
+{
+	bool modificationsMade = false;
+	if (node.isElement()) {
+		const QDomNamedNodeMap attributes = node.attributes();
+		for (int i = 0; i < attributes.count(); ++i) {
+			QDomAttr attribute = attributes.item(i).toAttr();
+			QString value = attribute.value();
+			if (rewriter(attribute.name(), value)) {
+				attribute.setValue(value);
+				modificationsMade = true;
 			}
+		}
+	} else if (node.isCharacterData() && !node.isComment()) {
+		QDomCharacterData text = node.toCharacterData();
+		QString value = text.data();
+		if (rewriter(QString(), value)) {
+			text.setData(value);
+			modificationsMade = true;
+		}
+	}
+
+	for (QDomNode child = node.firstChild(); !child.isNull(); child = child.nextSibling()) {
+		modificationsMade |= rewriteXmlValues(child, rewriter);
+	}
 
-			for (const auto &filter : graphicalFilters) {
-				modificationsMade |= filter(graphicalBlock, graphicalApi);
+	return modificationsMade;
+}
+
+bool SaveConvertionManager::replaceInXml(QDomDocument &document
+		, const QList<QPair<QString, QString>> &replacementRules)
+{
+	return rewriteXmlValues(document, [&replacementRules](const QString &, QString &value) {
+		bool replacementOccured = false;
+		for (const auto &rule : replacementRules) {
+			if (value.contains(rule.first)) {
+				value.replace(rule.first, rule.second);
+				replacementOccured = true;
 			}
 		}
 
-		return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
+		return replacementOccured;
 	});
 }
 
@@ -115,7 +115,8 @@ void RobotsPluginFacade::init(const qReal::PluginConfigurator &configurer)
 	}
 
 	mSensorVariablesUpdater.reset(
-		new interpreterCore::interpreter::details::SensorVariablesUpdater(mRobotModelManager, *mParser));
+		new interpreterCore::interpreter::details::SensorVariablesUpdater(mRobotModelManager, *mParser
+				, &configurer.logicalModelApi()));
 
 	connect(&mRobotModelManager, &RobotModelManager::allDevicesConfigured,
 			mSensorVariablesUpdater.data(), &interpreter::details::SensorVariablesUpdater::run);
@@ -0,0 +1,64 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
+
+namespace trik {
+
+/// Process-wide cache of frames returned by imitation camera for image folders (the one chosen in settings
+/// or the one where images packed into a project are unpacked). Frames are converted to camera format once
+/// and then shared between interpretation runs; total size of cached frames is bounded. Folder contents are
+/// watched, any change drops the folder from the cache.
+class TrikImitationCameraCache : public QObject
+{
+	Q_OBJECT
+
+public:
+	/// Returns the single instance of the cache. Shall be called from the main thread first.
+	static TrikImitationCameraCache &instance();
+
+	/// Starts watching @a path for changes. Shall be called from the main thread before a run.
+	void prepare(const QString &path);
+
+	/// Returns frame with a given number from images in @a path. Frames are numbered cyclically in the order
+	/// imitation camera returns them. Returns empty vector if folder contains no images.
+	/// Thread-safe.
+	QVector<uint8_t> frame(const QString &path, int index);
+
+	/// Drops everything cached for images in @a path.
+	void invalidate(const QString &path);
+
+private:
+	struct Folder;
+
+	TrikImitationCameraCache();
+	~TrikImitationCameraCache() override;
+
+	static QString key(const QString &path);
+	QSharedPointer<Folder> folder(const QString &key);
+
+	QMutex mMutex;
+	QHash<QString, QSharedPointer<Folder>> mFolders;
+	QFileSystemWatcher mWatcher;
+	qint64 mCachedBytes = 0;
+};
+
+}
@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <functional>
+
+#include <QtCore/QMutex>
+#include <QtCore/QVector>
+
 #include <trikControl/displayInterface.h>
 
 #include <trikKitInterpreterCommon/robotModel/twoD/trikTwoDRobotModel.h>
@@ -58,11 +63,20 @@ public slots:
 	void redraw() override;
 
 private:
-	Qt::ConnectionType callType() const;
+	/// Queues drawing command for execution in display thread. Commands are delivered there in batches: only the
+	/// first command after previous batch posts a cross-thread call, the rest just join the queue.
+	void post(std::function<void()> &&command);
+
+	/// Executes all queued drawing commands, must be called in display thread.
+	void flush();
 
 	trikControl::DisplayWidgetInterface mDisplayWidgetInterface;
 	QSharedPointer<robotModel::twoD::TrikTwoDRobotModel> mTwoDRobotModel;
 	robotModel::twoD::parts::Display * mDisplay;
+
+	/// Drawing commands from script thread that are not executed by display yet.
+	QVector<std::function<void()>> mPendingCommands;
+	QMutex mPendingCommandsMutex;
 };
 
 }
@@ -39,10 +39,6 @@ namespace utils {
 class AbstractTimer;
 }
 
-namespace trikControl {
-class CameraImplementationInterface;
-}
-
 namespace trik {
 
 class TrikBrick final : public trikControl::BrickInterface
@@ -133,7 +129,8 @@ private:
 	QScopedPointer<TrikGyroscopeAdapter> mGyroscope;
 	QScopedPointer<TrikProxyMarker> mTrikProxyMarker;
 
-	QScopedPointer<trikControl::CameraImplementationInterface> mImitationCamera;
+	QString mImitationCameraPath;
+	int mImitationCameraFrame = 0;
 
 	QDir mCurrentDir;
 	bool mIsExcerciseMode = false;
@@ -126,6 +126,8 @@ void Display::printText(int x, int y, const QString &text, int fontSize)
 	if (mLabelsMap.contains(coords)) {
 		mLabelsMap[coords]->setText(text);
 		mLabelsMap[coords]->setFontSize(fontSize);
+		// Label is already rasterized with its old text.
+		invalidateFramebuffer();
 	} else {
 		utils::TextObject * const textObject = new utils::TextObject(x, y, text
 			, mCurrentPenColor, mCurrentPenWidth, fontSize);
@@ -189,7 +191,7 @@ void Display::paint(QPainter *painter, const QRect &outputRect)
 	const qreal xScale = displayRect.width() / (realWidth * 1.0);
 	const qreal yScale = (displayRect.height() - scaledTopMenuHeight) / (realHeight * 1.0);
 	painter->scale(xScale, yScale);
-	Canvas::paint(painter, {0, 0, realWidth, realHeight});
+	Canvas::paintFramebuffer(painter, {0, 0, realWidth, realHeight});
 	painter->restore();
 }
 
@@ -42,7 +42,8 @@ void TrikDisplayWidget::setPainter(qReal::ui::PainterInterface *painter)
 
 void TrikDisplayWidget::repaintDisplay()
 {
-	mUi->display->repaint();
+	// Scheduled, not immediate repaint: a batch of drawing commands with several redraws results in one paint.
+	mUi->display->update();
 }
 
 int TrikDisplayWidget::displayWidth() const
@@ -0,0 +1,146 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "trikKitInterpreterCommon/trikEmulation/trikImitationCameraCache.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+
+#include <src/imitationCameraImplementation.h>
+
+using namespace trik;
+
+/// Upper bound for the total size of cached frames, in bytes.
+const qint64 maxCachedBytes = 64 * 1024 * 1024;
+
+const QStringList imageFilters = {"*.jpg", "*.png"};
+
+struct TrikImitationCameraCache::Folder
+{
+	explicit Folder(const QString &path)
+		: source(new trikControl::ImitationCameraImplementation(imageFilters, path))
+		, framesCount(QDir(path).entryList(imageFilters, QDir::Files).size())
+		, frames(framesCount)
+	{
+	}
+
+	/// Imitation camera does the decoding, it returns images one by one starting from the first.
+	QScopedPointer<trikControl::CameraImplementationInterface> source;
+
+	/// Number of the frame that will be returned by the next call of source's getPhoto().
+	int sourcePosition = 0;
+
+	int framesCount;
+	QVector<QVector<uint8_t>> frames;
+	qint64 bytes = 0;
+};
+
+TrikImitationCameraCache &TrikImitationCameraCache::instance()
+{
+	// Intentionally leaked, frames may be requested by script threads until the very end.
+	static TrikImitationCameraCache * const cache = new TrikImitationCameraCache();
+	return *cache;
+}
+
+TrikImitationCameraCache::TrikImitationCameraCache()
+{
+	connect(&mWatcher, &QFileSystemWatcher::directoryChanged, this, &TrikImitationCameraCache::invalidate);
+	connect(&mWatcher, &QFileSystemWatcher::fileChanged, this, [this](const QString &file) {
+		invalidate(QFileInfo(file).absolutePath());
+	});
+}
+
+TrikImitationCameraCache::~TrikImitationCameraCache() = default;
+
+void TrikImitationCameraCache::prepare(const QString &path)
+{
+	const QString folderKey = key(path);
+	if (!QFileInfo(folderKey).isDir()) {
+		return;
+	}
+
+	const QStringList watched = mWatcher.directories() + mWatcher.files();
+	QStringList paths;
+	if (!watched.contains(folderKey)) {
+		paths << folderKey;
+	}
+
+	const QDir dir(folderKey);
+	for (const QString &file : dir.entryList(imageFilters, QDir::Files)) {
+		const QString filePath = dir.absoluteFilePath(file);
+		if (!watched.contains(filePath)) {
+			paths << filePath;
+		}
+	}
+
+	if (!paths.isEmpty()) {
+		mWatcher.addPaths(paths);
+	}
+}
+
+QVector<uint8_t> TrikImitationCameraCache::frame(const QString &path, int index)
+{
+	QMutexLocker lock(&mMutex);
+	const QSharedPointer<Folder> cached = folder(key(path));
+	if (cached->framesCount == 0) {
+		return {};
+	}
+
+	const int frameIndex = index % cached->framesCount;
+	if (!cached->frames[frameIndex].isEmpty()) {
+		return cached->frames[frameIndex];
+	}
+
+	// Frames are usually requested one after another, so normally this takes exactly one getPhoto() call.
+	forever {
+		const int position = cached->sourcePosition;
+		cached->sourcePosition = (position + 1) % cached->framesCount;
+		const QVector<uint8_t> photo = cached->source->getPhoto();
+		const qint64 bytes = photo.size();
+		if (!photo.isEmpty() && cached->frames[position].isEmpty() && mCachedBytes + bytes <= maxCachedBytes) {
+			cached->frames[position] = photo;
+			cached->bytes += bytes;
+			mCachedBytes += bytes;
+		}
+
+		if (position == frameIndex || photo.isEmpty()) {
+			return photo;
+		}
+	}
+}
+
+void TrikImitationCameraCache::invalidate(const QString &path)
+{
+	QMutexLocker lock(&mMutex);
+	const QSharedPointer<Folder> removed = mFolders.take(key(path));
+	if (removed) {
+		mCachedBytes -= removed->bytes;
+	}
+}
+
+QString TrikImitationCameraCache::key(const QString &path)
+{
+	return QDir::cleanPath(QFileInfo(path).absoluteFilePath());
+}
+
+QSharedPointer<TrikImitationCameraCache::Folder> TrikImitationCameraCache::folder(const QString &key)
+{
+	QSharedPointer<Folder> &result = mFolders[key];
+	if (!result) {
+		result.reset(new Folder(key));
+	}
+
+	return result;
+}
@@ -14,6 +14,8 @@
 
 #include <trikKitInterpreterCommon/trikEmulation/trikdisplayemu.h>
 
+#include <QtCore/QThread>
+
 #include <kitBase/robotModel/robotModelUtils.h>
 ///todo:
 #include <trikKitInterpreterCommon/robotModel/twoD/parts/twoDDisplay.h>
@@ -26,12 +28,6 @@ TrikDisplayEmu::TrikDisplayEmu(const QSharedPointer<robotModel::twoD::TrikTwoDRo
 {
 }
 
-Qt::ConnectionType TrikDisplayEmu::callType() const {
-	return Qt::AutoConnection;
-	// Very strange, but forced blocking connection causes SIGSEGV crash....
-	// return thread() != mDisplay->thread()? Qt::BlockingQueuedConnection : Qt::DirectConnection;
-}
-
 trikControl::DisplayWidgetInterface &TrikDisplayEmu::graphicsWidget()
 {
 	return mDisplayWidgetInterface;
@@ -45,70 +41,101 @@ void TrikDisplayEmu::init()
 void TrikDisplayEmu::showImage(const QString &fileName)
 {
 	const bool smile = fileName.endsWith(QLatin1String("sad.png"));
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->drawSmile(smile); }, callType());
+	post([=]() { mDisplay->drawSmile(smile); });
 }
 
 void TrikDisplayEmu::show(const QVector<int32_t> &array, int width, int height, const QString &format)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->show(array, width, height, format); }, callType());
+	post([=]() { mDisplay->show(array, width, height, format); });
 }
 
 void TrikDisplayEmu::addLabel(const QString &text, int x, int y, int fontSize)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->printText(x, y, text, fontSize); }, callType());
+	post([=]() { mDisplay->printText(x, y, text, fontSize); });
 }
 
 void TrikDisplayEmu::setPainterColor(const QString &color)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->setPainterColor(color); }, callType());
+	post([=]() { mDisplay->setPainterColor(color); });
 }
 
 void TrikDisplayEmu::setPainterWidth(int penWidth)
 {
-	QMetaObject::invokeMethod(mDisplay,[=](){ mDisplay->setPainterWidth(penWidth); }, callType());
+	post([=]() { mDisplay->setPainterWidth(penWidth); });
 }
 
 void TrikDisplayEmu::drawLine(int x1, int y1, int x2, int y2)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->drawLine(x1, y1, x2, y2); }, callType());
+	post([=]() { mDisplay->drawLine(x1, y1, x2, y2); });
 }
 
 void TrikDisplayEmu::drawPoint(int x, int y)
 {
-	QMetaObject::invokeMethod(mDisplay, [=]() { mDisplay->drawPixel(x, y); }, callType());
+	post([=]() { mDisplay->drawPixel(x, y); });
 }
 
 void TrikDisplayEmu::drawRect(int x, int y, int w, int h, bool filled)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->drawRect(x, y, w, h, filled); }, callType());
+	post([=]() { mDisplay->drawRect(x, y, w, h, filled); });
 }
 
 void TrikDisplayEmu::drawEllipse(int x, int y, int w, int h, bool filled)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->drawEllipse(x, y, w, h, filled); }, callType());
+	post([=]() { mDisplay->drawEllipse(x, y, w, h, filled); });
 }
 
 void TrikDisplayEmu::drawArc(int x, int y, int w, int h, int start, int span)
 {
-	QMetaObject::invokeMethod(mDisplay, [=]() { mDisplay->drawArc(x, y, w, h, start, span); },  callType());
+	post([=]() { mDisplay->drawArc(x, y, w, h, start, span); });
 }
 
 void TrikDisplayEmu::setBackground(const QString &color)
 {
-	QMetaObject::invokeMethod(mDisplay, [=](){ mDisplay->setBackground(color); }, callType());
+	post([=]() { mDisplay->setBackground(color); });
 }
 
 void TrikDisplayEmu::clear()
 {
-	QMetaObject::invokeMethod(mDisplay, &Display::clearScreen, callType());
+	post([=]() { mDisplay->clearScreen(); });
 }
 
 void TrikDisplayEmu::reset()
 {
-	QMetaObject::invokeMethod(mDisplay, &Display::reset, callType());
+	post([=]() { mDisplay->reset(); });
 }
 
 void TrikDisplayEmu::redraw()
 {
-	QMetaObject::invokeMethod(mDisplay, &Display::redraw,  callType());
+	post([=]() { mDisplay->redraw(); });
+}
+
+void TrikDisplayEmu::post(std::function<void()> &&command)
+{
+	if (QThread::currentThread() == mDisplay->thread()) {
+		flush();
+		command();
+		return;
+	}
+
+	QMutexLocker locker(&mPendingCommandsMutex);
+	const bool batchStarted = mPendingCommands.isEmpty();
+	mPendingCommands.append(std::move(command));
+	locker.unlock();
+
+	if (batchStarted) {
+		QMetaObject::invokeMethod(mDisplay, [this]() { flush(); }, Qt::QueuedConnection);
+	}
+}
+
+void TrikDisplayEmu::flush()
+{
+	QVector<std::function<void()>> commands;
+	{
+		QMutexLocker locker(&mPendingCommandsMutex);
+		commands.swap(mPendingCommands);
+	}
+
+	for (const auto &command : commands) {
+		command();
+	}
 }
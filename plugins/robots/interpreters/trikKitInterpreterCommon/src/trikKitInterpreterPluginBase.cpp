@@ -29,6 +29,8 @@
 #include <qrgui/textEditor/qscintillaTextEdit.h>
 #include <qrgui/textEditor/languageInfo.h>
 
+#include "trikKitInterpreterCommon/trikEmulation/trikImitationCameraCache.h"
+
 using namespace trik;
 using namespace qReal;
 
@@ -182,6 +184,7 @@ void TrikKitInterpreterPluginBase::handleImitationCameraWork()
 				}
 
 				dir.cd(curPath);
+				TrikImitationCameraCache::instance().invalidate(path);
 			}
 		}
 	};
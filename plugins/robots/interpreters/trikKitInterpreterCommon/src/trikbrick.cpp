@@ -18,6 +18,7 @@
 #include <QtCore/QThread>
 
 #include <trikKitInterpreterCommon/trikbrick.h>
+#include <trikKitInterpreterCommon/trikEmulation/trikImitationCameraCache.h>
 
 #include <utils/abstractTimer.h>
 #include <kitBase/robotModel/robotModelUtils.h>
@@ -32,7 +33,6 @@
 #include <qrkernel/settingsListener.h>
 #include <qrkernel/platformInfo.h>
 #include <src/qtCameraImplementation.h>
-#include <src/imitationCameraImplementation.h>
 #include <QApplication>
 
 ///todo: temporary
@@ -141,13 +141,11 @@ void TrikBrick::setCurrentInputs(const QString &f)
 
 void TrikBrick::reinitImitationCamera()
 {
-	if (not qReal::SettingsManager::value("TrikSimulatedCameraImagesFromProject").toBool()) {
-		const QString path = qReal::SettingsManager::value("TrikSimulatedCameraImagesPath").toString();
-		mImitationCamera.reset(new trikControl::ImitationCameraImplementation({"*.jpg","*.png"}, path));
-	} else {
-		const QString path = qReal::PlatformInfo::invariantSettingsPath("trikCameraImitationImagesDir");
-		mImitationCamera.reset(new trikControl::ImitationCameraImplementation({"*.jpg","*.png"}, path));
-	}
+	mImitationCameraPath = qReal::SettingsManager::value("TrikSimulatedCameraImagesFromProject").toBool()
+			? qReal::PlatformInfo::invariantSettingsPath("trikCameraImitationImagesDir")
+			: qReal::SettingsManager::value("TrikSimulatedCameraImagesPath").toString();
+	mImitationCameraFrame = 0;
+	TrikImitationCameraCache::instance().prepare(mImitationCameraPath);
 }
 
 void TrikBrick::say(const QString &msg) {
@@ -388,7 +386,8 @@ QVector<uint8_t> TrikBrick::getStillImage()
 
 		return photo;
 	} else {
-		QVector<uint8_t> photo = mImitationCamera->getPhoto();
+		QVector<uint8_t> photo = TrikImitationCameraCache::instance().frame(mImitationCameraPath
+				, mImitationCameraFrame++);
 		if (photo.isEmpty()) {
 			error(tr("Cannot get a photo from folders/project (possibly because of wrong path/empty project)"));
 		}
@@ -90,6 +90,7 @@ HEADERS += \
 	$$PWD/include/trikKitInterpreterCommon/trikEmulation/trikGyroscopeAdapter.h \
 	$$PWD/include/trikKitInterpreterCommon/trikEmulation/trikProxyMarker.h \
 	$$PWD/include/trikKitInterpreterCommon/trikEmulation/triklidaremu.h \
+	$$PWD/include/trikKitInterpreterCommon/trikEmulation/trikImitationCameraCache.h \
 	$$PWD/include/trikKitInterpreterCommon/trikTextualInterpreter.h \
 	$$PWD/include/trikKitInterpreterCommon/twoDExecutionControl.h \
 
@@ -144,6 +145,7 @@ SOURCES += \
 	$$PWD/src/trikEmulation/trikGyroscopeAdapter.cpp \
 	$$PWD/src/trikEmulation/trikProxyMarker.cpp \
 	$$PWD/src/trikEmulation/triklidaremu.cpp \
+	$$PWD/src/trikEmulation/trikImitationCameraCache.cpp \
 	$$PWD/src/trikTextualInterpreter.cpp \
 	$$PWD/src/twoDExecutionControl.cpp \
 
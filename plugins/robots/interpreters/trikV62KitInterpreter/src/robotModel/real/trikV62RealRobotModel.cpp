@@ -79,6 +79,13 @@ void RealRobotModel::updateSensorsValues() const
 	mRobotCommunicator.data()->requestData();
 }
 
+void RealRobotModel::updateSensorsValuesOn(const QList<kitBase::robotModel::PortInfo> &ports) const
+{
+	// Robot sends all sensor readings in one response, so there is nothing to save by asking only for some of them.
+	Q_UNUSED(ports)
+	updateSensorsValues();
+}
+
 bool RealRobotModel::needsConnection() const
 {
 	return true;
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <QtGui/QImage>
+#include <QtGui/QTransform>
+
 #include <qrutils/widgets/painterInterface.h>
 
 #include "utils/utilsDeclSpec.h"
@@ -113,6 +116,14 @@ public:
 	void paint(QPainter *painter, const QRect &outputRect) override;
 
 protected:
+	/// Paints canvas contents like paint() does, but through a pixel framebuffer of the size of \a outputRect
+	/// in device coordinates. Only objects added since previous call are rasterized, the rest of the picture is
+	/// just blitted, so painting cost does not grow with the number of shapes drawn.
+	void paintFramebuffer(QPainter *painter, const QRect &outputRect);
+
+	/// Must be called when some already drawn object was modified, forces framebuffer to be rasterized from scratch.
+	void invalidateFramebuffer();
+
 	/// Has ownership
 	QList<PointObject *> mPixels;
 
@@ -139,6 +150,16 @@ protected:
 
 	int mCurrentPenWidth;
 	QColor mCurrentPenColor;
+
+private:
+	/// Rasterized contents of the canvas, see paintFramebuffer().
+	QImage mFramebuffer;
+
+	/// World transform of a painter which was used to rasterize framebuffer.
+	QTransform mFramebufferTransform;
+
+	/// Count of objects from mObjects that are already rasterized into framebuffer.
+	int mRasterizedObjects = 0;
 };
 
 }
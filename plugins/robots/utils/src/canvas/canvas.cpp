@@ -16,6 +16,7 @@
 
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
+#include <QtGui/QPainter>
 
 #include "utils/canvas/pointObject.h"
 #include "utils/canvas/lineObject.h"
@@ -51,6 +52,7 @@ void Canvas::reset()
 	mLabels.clear();
 	mCurrentPenWidth = 1;
 	mCurrentPenColor = Qt::black;
+	invalidateFramebuffer();
 }
 
 const QList<CanvasObject *> &Canvas::objects() const
@@ -159,3 +161,51 @@ void Canvas::paint(QPainter *painter, const QRect &outputRect)
 		object->paint(painter, outputRect);
 	}
 }
+
+void Canvas::paintFramebuffer(QPainter *painter, const QRect &outputRect)
+{
+	const QTransform transform = painter->worldTransform();
+	const QRect deviceRect = transform.mapRect(QRectF(outputRect)).toAlignedRect();
+	const qreal pixelRatio = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+	const QSize framebufferSize = deviceRect.size() * pixelRatio;
+	if (framebufferSize.isEmpty()) {
+		return;
+	}
+
+	if (mFramebuffer.size() != framebufferSize || mFramebuffer.devicePixelRatio() != pixelRatio
+			|| mFramebufferTransform != transform)
+	{
+		mFramebuffer = QImage(framebufferSize, QImage::Format_ARGB32_Premultiplied);
+		mFramebuffer.setDevicePixelRatio(pixelRatio);
+		mFramebufferTransform = transform;
+		mRasterizedObjects = 0;
+	}
+
+	if (mRasterizedObjects == 0) {
+		mFramebuffer.fill(Qt::transparent);
+	}
+
+	if (mRasterizedObjects < mObjects.size()) {
+		QPainter framebufferPainter(&mFramebuffer);
+		framebufferPainter.setRenderHints(painter->renderHints());
+		framebufferPainter.setFont(painter->font());
+		framebufferPainter.setPen(painter->pen());
+		framebufferPainter.setBrush(painter->brush());
+		framebufferPainter.setTransform(transform * QTransform::fromTranslate(-deviceRect.left(), -deviceRect.top()));
+		for (int i = mRasterizedObjects; i < mObjects.size(); ++i) {
+			mObjects[i]->paint(&framebufferPainter, outputRect);
+		}
+
+		mRasterizedObjects = mObjects.size();
+	}
+
+	painter->save();
+	painter->resetTransform();
+	painter->drawImage(deviceRect.topLeft(), mFramebuffer);
+	painter->restore();
+}
+
+void Canvas::invalidateFramebuffer()
+{
+	mRasterizedObjects = 0;
+}
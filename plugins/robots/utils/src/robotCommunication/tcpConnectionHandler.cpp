@@ -21,6 +21,7 @@
 #include <QNetworkProxy>
 
 const int keepaliveTime = 3000;
+const int maxMessageLength = 1 << 30;
 
 using namespace utils::robotCommunication;
 
@@ -84,6 +85,7 @@ bool TcpConnectionHandler::connect(const QHostAddress &serverAddress)
 	}
 
 	mBuffer.clear();
+	mReadOffset = 0;
 	mExpectedBytes = 0;
 
 	return result;
@@ -111,11 +113,14 @@ void TcpConnectionHandler::send(const QString &data)
 		return;
 	}
 
-	QByteArray dataByteArray = data.toUtf8();
-	dataByteArray = QByteArray::number(dataByteArray.size()) + ':' + dataByteArray;
-	mSocket.write(dataByteArray);
-	if (!mSocket.waitForBytesWritten(3000)) {
-		QLOG_ERROR() << "Unable to send data" << data << "to" << mSocket.peerAddress();
+	const QByteArray dataByteArray = data.toUtf8();
+	QByteArray message;
+	message.reserve(dataByteArray.size() + 12);
+	message.append(QByteArray::number(dataByteArray.size())).append(':').append(dataByteArray);
+
+	// Socket buffers outgoing data and flushes it from the event loop, so we do not block sender thread here.
+	if (mSocket.write(message) == -1) {
+		QLOG_ERROR() << "Unable to send data" << data << "to" << mSocket.peerAddress() << mSocket.errorString();
 	} else {
 		/// Resetting keepalive timer since we already sent something to the other side.
 		mKeepAliveTimer->start();
@@ -128,39 +133,55 @@ void TcpConnectionHandler::onIncomingData()
 		return;
 	}
 
-	const QByteArray &data = mSocket.readAll();
-	mBuffer.append(data);
+	mBuffer.append(mSocket.readAll());
 
-	while (!mBuffer.isEmpty()) {
+	// Buffer is re-read on every iteration since message handlers may reconnect and thus reset it.
+	while (mReadOffset < mBuffer.size()) {
+		const char * const data = mBuffer.constData();
 		if (mExpectedBytes == 0) {
 			// Determining the length of a message.
-			const int delimiterIndex = mBuffer.indexOf(':');
+			const int delimiterIndex = mBuffer.indexOf(':', mReadOffset);
 			if (delimiterIndex == -1) {
 				// We did not receive full message length yet.
-				return;
-			} else {
-				const QByteArray length = mBuffer.left(delimiterIndex);
-				mBuffer = mBuffer.mid(delimiterIndex + 1);
-				bool ok = false;
-				mExpectedBytes = length.toInt(&ok);
-				if (!ok) {
-					QLOG_ERROR() << "Malformed message, can not determine message length from this:" << length;
-					mExpectedBytes = 0;
-				}
+				break;
+			}
+
+			bool ok = delimiterIndex > mReadOffset;
+			int length = 0;
+			for (int i = mReadOffset; ok && i < delimiterIndex; ++i) {
+				ok = data[i] >= '0' && data[i] <= '9' && length < maxMessageLength / 10;
+				length = length * 10 + (data[i] - '0');
 			}
-		} else {
-			if (mBuffer.size() >= mExpectedBytes) {
-				const QByteArray message = mBuffer.left(mExpectedBytes);
-				mBuffer = mBuffer.mid(mExpectedBytes);
-				emit messageReceived(message);
 
+			if (!ok) {
+				QLOG_ERROR() << "Malformed message, can not determine message length from this:"
+						<< QByteArray(data + mReadOffset, delimiterIndex - mReadOffset);
+				length = 0;
+			}
+
+			mExpectedBytes = length;
+			mReadOffset = delimiterIndex + 1;
+		} else {
+			if (mBuffer.size() - mReadOffset >= mExpectedBytes) {
+				const QString message = QString::fromUtf8(data + mReadOffset, mExpectedBytes);
+				mReadOffset += mExpectedBytes;
 				mExpectedBytes = 0;
+				emit messageReceived(message);
 			} else {
 				// We don't have all message yet.
-				return;
+				break;
 			}
 		}
 	}
+
+	// Dropping consumed part of a buffer only once per read instead of once per message.
+	if (mReadOffset >= mBuffer.size()) {
+		mBuffer.clear();
+		mReadOffset = 0;
+	} else if (mReadOffset > 0) {
+		mBuffer.remove(0, mReadOffset);
+		mReadOffset = 0;
+	}
 }
 
 void TcpConnectionHandler::keepalive()
@@ -47,7 +47,13 @@ private:
 	/// Timer used to send "keepalive" packets for other side to be able to detect connection failure.
 	QTimer *mKeepAliveTimer {};
 	QTcpSocket mSocket;
+
+	/// Received but not yet processed data. Messages are parsed in place starting from mReadOffset.
 	QByteArray mBuffer;
+
+	/// Position of the first unprocessed byte in mBuffer.
+	int mReadOffset = 0;
+
 	int mExpectedBytes = 0;
 	const int mPort;
 };
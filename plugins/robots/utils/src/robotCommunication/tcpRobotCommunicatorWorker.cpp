@@ -26,6 +26,9 @@ using namespace utils::robotCommunication;
 static const uint controlPort = 8888;
 static const uint telemetryPort = 9000;
 
+/// If "data" request is not answered in that time, it is considered lost and may be resent, in milliseconds.
+static const int telemetryAnswerTimeout = 1000;
+
 TcpRobotCommunicatorWorker::TcpRobotCommunicatorWorker(const QString &robotIpRegistryKey)
 	: mRobotIpRegistryKey(robotIpRegistryKey)
 {
@@ -130,6 +133,12 @@ void TcpRobotCommunicatorWorker::requestData()
 		return;
 	}
 
+	if (mTelemetryRequestPending && !mTelemetryRequestTimer.hasExpired(telemetryAnswerTimeout)) {
+		return;
+	}
+
+	mTelemetryRequestPending = true;
+	mTelemetryRequestTimer.start();
 	mTelemetryConnection->send("data");
 }
 
@@ -179,6 +188,7 @@ void TcpRobotCommunicatorWorker::processTelemetryMessage(const QString &message)
 		data.remove(0, sensorMarker.length());
 		handleValue(data);
 	} else if (message.startsWith(allDataMarker)) {
+		mTelemetryRequestPending = false;
 		QString data(message);
 		data.remove(0, allDataMarker.length());
 		QStringList values = data.split(';');
@@ -242,6 +252,7 @@ void TcpRobotCommunicatorWorker::connect()
 	}
 
 	mCurrentIp = server;
+	mTelemetryRequestPending = false;
 	const bool result = mControlConnection->connect(hostAddress) && mTelemetryConnection->connect(hostAddress);
 	if (result) {
 		versionRequest();
@@ -253,6 +264,8 @@ void TcpRobotCommunicatorWorker::connect()
 
 void TcpRobotCommunicatorWorker::disconnectConnection()
 {
+	mTelemetryRequestPending = false;
+
 	mControlConnection->disconnect();
 	mTelemetryConnection->disconnect();
 
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QScopedPointer>
 #include <QtCore/QTimer>
 
@@ -74,7 +75,8 @@ public:
 	/// Requests telemetry data for given sensor.
 	Q_INVOKABLE void requestData(const QString &sensor);
 
-	/// Requests telemetry data for all ports.
+	/// Requests telemetry data for all ports. Does nothing if previous request is not answered yet, its answer
+	/// will carry fresh values anyway.
 	Q_INVOKABLE void requestData();
 
 	/// Establishes connection.
@@ -162,6 +164,12 @@ private:
 
 	/// Timer for version request.
 	QScopedPointer<QTimer> mVersionTimer;
+
+	/// Measures time since last "data" request was sent, used to detect that its answer was lost.
+	QElapsedTimer mTelemetryRequestTimer;
+
+	/// True when "data" request is sent and "allData:" answer is not received yet.
+	bool mTelemetryRequestPending = false;
 };
 
 }
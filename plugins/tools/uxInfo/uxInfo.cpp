@@ -14,6 +14,7 @@
 
 #include "uxInfo.h"
 
+#include <QtCore/QDateTime>
 #include <QtCore/QDir>
 #include <QtCore/QPointF>
 #include <QtWidgets/QApplication>
@@ -34,6 +35,8 @@ QString const settingChangesFileName = "/settingChanges.txt";
 QString const uxInfoDirName = "usabilityFiles";
 
 UXInfo::UXInfo()
+	: mStatus(false)
+	, mClosed(false)
 {
 	if (qReal::SettingsManager::value("usabilityTestingMode").toBool()) {
 		QString const dir = QApplication::applicationDirPath() + "/" + uxDir;
@@ -41,153 +44,68 @@ UXInfo::UXInfo()
 			QDir(dir).mkpath(dir);
 		}
 
-		///create and open all files
-		mElementOnSceneCreationFile.setFileName(dir + elementCreationFileName);
-		if (mElementOnSceneCreationFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mElementOnSceneCreationStream.setDevice(&mElementOnSceneCreationFile);
-		}
-
-		mCreationNumber = 1;
-
-		mErrorReporterFile.setFileName(dir + errorReporterFileName);
-		if (mErrorReporterFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mErrorReporterStream.setDevice(&mErrorReporterFile);
-		}
-
-		mErrorReporterNumber = 1;
-
-		mTotalTimeFile.setFileName(dir + totalTimeFileName);
-		if (mTotalTimeFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mTotalTimeStream.setDevice(&mTotalTimeFile);
-		}
-
-		mMenuElementUsingFile.setFileName(dir + menuElementUsingFileName);
-		if (mMenuElementUsingFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mMenuElementUsingStream.setDevice(&mMenuElementUsingFile);
-		}
-
-		mMenuElementUsingNumber = 1;
-
-		mMouseClickPositionFile.setFileName(dir + mouseClickPositionFileName);
-		if (mMouseClickPositionFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mMouseClickPositionStream.setDevice(&mMouseClickPositionFile);
-		}
-
-		mMouseClickPositionNumber = 1;
-
-		mSettingChangesFile.setFileName(dir + settingChangesFileName);
-		if (mSettingChangesFile.open(QFile::WriteOnly | QFile::Truncate)) {
-			mSettingChangesStream.setDevice(&mSettingChangesFile);
-		}
-
-		mSettingChangesNumber = 1;
+		// Order of files must correspond to UXInfoWriter::LogFile.
+		mWriter.reset(new UXInfoWriter({
+				dir + elementCreationFileName
+				, dir + errorReporterFileName
+				, dir + totalTimeFileName
+				, dir + menuElementUsingFileName
+				, dir + mouseClickPositionFileName
+				, dir + settingChangesFileName
+		}));
 
-		mTestNumber = 1;
+		mWriter->start(QThread::LowPriority);
 	}
-	mNotEnoughDiskSpace = false;
 }
 
 UXInfo::~UXInfo()
 {
 }
 
-bool UXInfo::writeData(QTextStream const &stream)
+bool UXInfo::writeData() const
 {
-	if (!mStatus || mNotEnoughDiskSpace) {
-		return false;
-	}
-
-	if (stream.status() == QTextStream::WriteFailed) {
-		mNotEnoughDiskSpace = true;
-		return false;
-	}
-	return true;
+	return mStatus && !mClosed && mWriter && !mWriter->writeFailed();
 }
 
-void UXInfo::reportCreationOfElements(const QString &editorName, const QString elementName)
+void UXInfo::post(UXInfoWriter::Event::Type type, const QString &first, const QString &second
+		, const QString &third, const QString &fourth, const QPoint &position)
 {
-	if (!writeData(mElementOnSceneCreationStream)) {
+	if (!writeData()) {
 		return;
 	}
 
-	mElementOnSceneCreationStream << mCreationNumber << " "
-			<< editorName << " "
-			<< elementName << " "
-			<< currentDateTime() << "\n";
+	mWriter->post({type, QDateTime::currentMSecsSinceEpoch(), first, second, third, fourth, position});
+}
 
-	mCreationNumber++;
+void UXInfo::reportCreationOfElements(const QString &editorName, const QString elementName)
+{
+	post(UXInfoWriter::Event::elementCreation, editorName, elementName);
 }
 
 void UXInfo::reportErrorsOfElements(const QString &type, const QString &editorName, const QString &elementName
 		, const QString &message)
 {
-	if (!writeData(mErrorReporterStream)) {
-		return;
-	}
-
-	mErrorReporterStream << mErrorReporterNumber << " "
-			<< type << " "
-			<< editorName << " "
-			<< elementName << " "
-			<< message << " "
-			<< currentDateTime() << "\n";
-
-	mErrorReporterNumber++;
+	post(UXInfoWriter::Event::error, type, editorName, elementName, message);
 }
 
 void UXInfo::reportTotalTimeOfExec(QString const &totalTime)
 {
-	if (!writeData(mTotalTimeStream)) {
-		return;
-	}
-
-	mTotalTimeStream << "TotalSessionTime: "
-			<< totalTime << " secs Exit code:"
-			<< 0 << "\n";
+	post(UXInfoWriter::Event::totalTime, totalTime);
 }
 
 void UXInfo::reportMenuElementsUsing(const QString &elementName, const QString &status)
 {
-	if (!writeData(mMenuElementUsingStream)) {
-		return;
-	}
-
-	QString const statusText = (status == "none") ? "" : status + " ";
-	mMenuElementUsingStream << mMenuElementUsingNumber << " "
-			<< elementName << " "
-			<< statusText
-			<< currentDateTime() << "\n";
-
-	mMenuElementUsingNumber++;
+	post(UXInfoWriter::Event::menuElementUsing, elementName, status);
 }
 
 void UXInfo::reportMouseClickPosition(const QPoint &pos)
 {
-	if (!writeData(mMouseClickPositionStream)) {
-		return;
-	}
-
-	mMouseClickPositionStream << mMouseClickPositionNumber << " ("
-			<< QString::number(pos.x()) << ", "
-			<< QString::number(pos.y()) << ") "
-			<< currentDateTime() << "\n";
-
-	mMouseClickPositionNumber++;
+	post(UXInfoWriter::Event::mouseClick, QString(), QString(), QString(), QString(), pos);
 }
 
 void UXInfo::reportSettingsChangesInfo(const QString &name, const QString &oldValue, const QString &newValue)
 {
-	if (!writeData(mSettingChangesStream)) {
-		return;
-	}
-
-	mSettingChangesStream << mSettingChangesNumber << " "
-			<< name << " "
-			<< oldValue << " "
-			<< newValue << " "
-			<< currentDateTime() << "\n";
-
-	mSettingChangesNumber++;
+	post(UXInfoWriter::Event::settingChange, name, oldValue, newValue);
 }
 
 void UXInfo::setActualStatus(bool status)
@@ -197,45 +115,12 @@ void UXInfo::setActualStatus(bool status)
 
 void UXInfo::reportTestStartedInfo()
 {
-	if (!writeData(mSettingChangesStream)) {
-		return;
-	}
-
-	QList<QTextStream *> streamList;
-	streamList << &mElementOnSceneCreationStream << &mErrorReporterStream << &mTotalTimeStream
-			<< &mMenuElementUsingStream << &mMouseClickPositionStream << &mSettingChangesStream;
-
-	QString const now = currentDateTime();
-	for (int i = 0; i < streamList.length(); ++i) {
-		*(streamList[i]) << "Test " << mTestNumber << " started at " << now << "\n";
-	}
+	post(UXInfoWriter::Event::testStarted);
 }
 
 void UXInfo::reportTestFinishedInfo()
 {
-	if (!writeData(mSettingChangesStream)) {
-		return;
-	}
-
-	QList<QTextStream *> streamList;
-	streamList << &mElementOnSceneCreationStream << &mErrorReporterStream << &mTotalTimeStream
-			<< &mMenuElementUsingStream << &mMouseClickPositionStream << &mSettingChangesStream;
-
-	QString const now = currentDateTime();
-	for (int i = 0; i < streamList.length(); ++i) {
-		*(streamList[i]) << "Test " << mTestNumber << " finished at " << now << "\n";
-	}
-	mTestNumber++;
-}
-
-void UXInfo::closeUXFiles()
-{
-	mElementOnSceneCreationFile.close();
-	mErrorReporterFile.close();
-	mTotalTimeFile.close();
-	mMenuElementUsingFile.close();
-	mMouseClickPositionFile.close();
-	mSettingChangesFile.close();
+	post(UXInfoWriter::Event::testFinished);
 }
 
 QString UXInfo::currentDateTime()
@@ -254,7 +139,12 @@ UXInfo *UXInfo::instance()
 
 void UXInfo::closeUXInfo()
 {
-	closeUXFiles();
+	if (!mWriter || mClosed) {
+		return;
+	}
+
+	mClosed = true;
+	mWriter->stop();
 
 	if (!mStatus) {
 		return;
@@ -262,40 +152,20 @@ void UXInfo::closeUXInfo()
 
 	QDir dir(".");
 	QString const newDirName = currentDateTime();
-	QString const oldElementOnSceneCreationName = mElementOnSceneCreationFile.fileName();
-	QString const oldErrorReporterName = mErrorReporterFile.fileName();
-	QString const oldTotalTimeName = mTotalTimeFile.fileName();
-	QString const oldMenuElementUsingName = mMenuElementUsingFile.fileName();
-	QString const oldMouseClickPositionName = mMouseClickPositionFile.fileName();
-	QString const oldSettingChangesName = mSettingChangesFile.fileName();
-
-	QString const newFileElementOnSceneCreationName = newDirName + elementCreationFileName;
-	QString const newFileErrorReporterName = newDirName + errorReporterFileName;
-	QString const newFileTotalTimeName = newDirName + totalTimeFileName;
-	QString const newFileMenuElementUsingName = newDirName + menuElementUsingFileName;
-	QString const newFileMouseClickPositionName = newDirName + mouseClickPositionFileName;
-	QString const newFileSettingChangesName = newDirName + settingChangesFileName;
-
 	if (!dir.exists(uxInfoDirName)) {
 		dir.mkdir(uxInfoDirName);
 	}
 
 	dir.cd(uxInfoDirName);
-	QString const dirAbsolutePathName = dir.absolutePath() + "/";
-	QString const newElementOnSceneCreationName = dirAbsolutePathName + newFileElementOnSceneCreationName;
-	QString const newErrorReporterName = dirAbsolutePathName + newFileErrorReporterName;
-	QString const newTotalTimeName = dirAbsolutePathName + newFileTotalTimeName;
-	QString const newMenuElementUsingName = dirAbsolutePathName + newFileMenuElementUsingName;
-	QString const newMouseClickPositionName = dirAbsolutePathName + newFileMouseClickPositionName;
-	QString const newSettingChangesName = dirAbsolutePathName + newFileSettingChangesName;
-
 	dir.mkdir(newDirName);
-	QFile::copy(oldElementOnSceneCreationName, newElementOnSceneCreationName);
-	QFile::copy(oldErrorReporterName, newErrorReporterName);
-	QFile::copy(oldTotalTimeName, newTotalTimeName);
-	QFile::copy(oldMenuElementUsingName, newMenuElementUsingName);
-	QFile::copy(oldMouseClickPositionName, newMouseClickPositionName);
-	QFile::copy(oldSettingChangesName, newSettingChangesName);
+	QString const newDirAbsolutePathName = dir.absolutePath() + "/" + newDirName;
+
+	QStringList const fileNames = { elementCreationFileName, errorReporterFileName, totalTimeFileName
+			, menuElementUsingFileName, mouseClickPositionFileName, settingChangesFileName };
+	for (int file = 0; file < UXInfoWriter::logFilesCount; ++file) {
+		QFile::copy(mWriter->fileName(static_cast<UXInfoWriter::LogFile>(file))
+				, newDirAbsolutePathName + fileNames[file]);
+	}
 }
 
 void UXInfo::reportCreation(const QString &editorName, const QString elementName)
@@ -14,14 +14,17 @@
 
 #pragma once
 
-#include <QtCore/QFile>
-#include <QtCore/QTextStream>
-#include <QtCore/QDateTime>
+#include <QtCore/QObject>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QVariant>
+
+#include "uxInfoWriter.h"
 
 namespace uxInfo {
 
 /// Singleton class for collecting user experience information about setting changes,
-/// click coordinates, diagram element creation and others.
+/// click coordinates, diagram element creation and others. Reports are only enqueued here, log files are
+/// written by UXInfoWriter in background.
 class UXInfo : public QObject
 {
 	Q_OBJECT
@@ -64,7 +67,7 @@ public:
 	///Record about finish of the usability test.
 	static void reportTestFinished();
 
-	/// Close all ux files.
+	/// Writes all pending records, closes all ux files and stores their copy in usability files directory.
 	void closeUXInfo();
 
 public slots:
@@ -78,7 +81,9 @@ private:
 	UXInfo();
 	~UXInfo();
 
-	bool writeData(QTextStream const &stream);
+	bool writeData() const;
+	void post(UXInfoWriter::Event::Type type, const QString &first = QString(), const QString &second = QString()
+			, const QString &third = QString(), const QString &fourth = QString(), const QPoint &position = QPoint());
 	void reportCreationOfElements(QString const &editorName, QString const elementName);
 	void reportErrorsOfElements(QString const &type, QString const &editorName, QString const &elementName,
 			QString const &message);
@@ -89,36 +94,13 @@ private:
 	void setActualStatus(bool status);
 	void reportTestStartedInfo();
 	void reportTestFinishedInfo();
-	void closeUXFiles();
 	QString currentDateTime();
 
 	static UXInfo* object;
 	bool mStatus;
-	bool mNotEnoughDiskSpace;
-
-	QFile mElementOnSceneCreationFile;
-	QTextStream mElementOnSceneCreationStream;
-	int mCreationNumber;
-
-	QFile mErrorReporterFile;
-	QTextStream mErrorReporterStream;
-	int mErrorReporterNumber;
-
-	QFile mTotalTimeFile;
-	QTextStream mTotalTimeStream;
-
-	QFile mMenuElementUsingFile;
-	QTextStream mMenuElementUsingStream;
-	int mMenuElementUsingNumber;
-
-	QFile mMouseClickPositionFile;
-	QTextStream mMouseClickPositionStream;
-	int mMouseClickPositionNumber;
-
-	QFile mSettingChangesFile;
-	QTextStream mSettingChangesStream;
-	int mSettingChangesNumber;
+	bool mClosed;
 
-	int mTestNumber;
+	/// Writer of log files, exists only in usability testing mode.
+	QScopedPointer<UXInfoWriter> mWriter;
 };
 }
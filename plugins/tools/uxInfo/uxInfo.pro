@@ -29,11 +29,13 @@ TRANSLATIONS = $$PWD/../../../qrtranslations/ru/plugins/uxInfo_ru.ts
 HEADERS = \
 	$$PWD/uxInfoPlugin.h \
 	$$PWD/uxInfo.h \
+	$$PWD/uxInfoWriter.h \
 	$$PWD/filterObject.h \
 
 SOURCES = \
 	$$PWD/uxInfoPlugin.cpp \
 	$$PWD/uxInfo.cpp \
+	$$PWD/uxInfoWriter.cpp \
 	$$PWD/filterObject.cpp \
 
 RESOURCES += \
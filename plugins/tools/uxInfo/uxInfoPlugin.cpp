@@ -14,6 +14,7 @@
 
 #include "uxInfoPlugin.h"
 
+#include <QtCore/QDateTime>
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QGridLayout>
 #include <QtWidgets/QToolBar>
@@ -54,10 +55,10 @@ void UXInfoPlugin::init(qReal::PluginConfigurator const &configurator)
 	connect(&configurator.systemEvents(), &qReal::SystemEvents::lowLevelEvent, this, &UXInfoPlugin::processEvent);
 
 	connect(&configurator.systemEvents(), &qReal::SystemEvents::closedMainWindow, [=]() {
-		UXInfo::instance()->closeUXInfo();
 		int const finishTimestamp = QDateTime::currentMSecsSinceEpoch();
 		QString const totalTime = QString::number((finishTimestamp - mStartTimestamp) / 1000);
 		UXInfo::reportTotalTime(totalTime);
+		UXInfo::instance()->closeUXInfo();
 	});
 
 	connect(&configurator.systemEvents(), &qReal::SystemEvents::graphicalElementAdded
@@ -0,0 +1,204 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "uxInfoWriter.h"
+
+#include <QtCore/QDateTime>
+
+using namespace uxInfo;
+
+/// How often writer wakes up to flush posted events, in milliseconds.
+const int flushInterval = 500;
+
+UXInfoWriter::UXInfoWriter(const QStringList &fileNames)
+	: mHead(nullptr)
+	, mStopped(0)
+	, mWriteFailed(0)
+{
+	for (int i = 0; i < logFilesCount && i < fileNames.size(); ++i) {
+		mFiles[i].setFileName(fileNames[i]);
+		if (mFiles[i].open(QFile::WriteOnly | QFile::Truncate)) {
+			mStreams[i].setDevice(&mFiles[i]);
+		}
+	}
+}
+
+UXInfoWriter::~UXInfoWriter()
+{
+	stop();
+}
+
+void UXInfoWriter::post(Event &&event)
+{
+	Node * const node = new Node{std::move(event), nullptr};
+	Node *head = nullptr;
+	do {
+		head = mHead.loadAcquire();
+		node->next = head;
+	} while (!mHead.testAndSetRelease(head, node));
+}
+
+void UXInfoWriter::stop()
+{
+	if (isRunning()) {
+		mStopped.storeRelease(1);
+		mWakeUp.release();
+		wait();
+	}
+
+	// Events may also be posted when writer thread was never started or after it has finished.
+	writeBatch();
+	for (QFile &file : mFiles) {
+		file.close();
+	}
+}
+
+bool UXInfoWriter::writeFailed() const
+{
+	return mWriteFailed.loadAcquire() != 0;
+}
+
+QString UXInfoWriter::fileName(LogFile file) const
+{
+	return mFiles[file].fileName();
+}
+
+void UXInfoWriter::run()
+{
+	while (!mStopped.loadAcquire()) {
+		mWakeUp.tryAcquire(1, flushInterval);
+		writeBatch();
+	}
+
+	writeBatch();
+}
+
+void UXInfoWriter::writeBatch()
+{
+	Node *node = mHead.fetchAndStoreAcquire(nullptr);
+	if (!node) {
+		return;
+	}
+
+	// Queue is a stack of posted events, reversing it to restore posting order.
+	Node *ordered = nullptr;
+	while (node) {
+		Node * const next = node->next;
+		node->next = ordered;
+		ordered = node;
+		node = next;
+	}
+
+	while (ordered) {
+		if (!writeFailed()) {
+			write(ordered->event);
+		}
+
+		Node * const next = ordered->next;
+		delete ordered;
+		ordered = next;
+	}
+
+	for (QTextStream &stream : mStreams) {
+		if (!stream.device()) {
+			continue;
+		}
+
+		stream.flush();
+		if (stream.status() == QTextStream::WriteFailed) {
+			mWriteFailed.storeRelease(1);
+		}
+	}
+}
+
+void UXInfoWriter::write(const Event &event)
+{
+	const QString time = timestampToString(event.timestamp);
+	switch (event.type) {
+	case Event::elementCreation:
+		stream(elementCreationLog) << mCreationNumber << " "
+				<< event.first << " "
+				<< event.second << " "
+				<< time << "\n";
+
+		mCreationNumber++;
+		break;
+	case Event::error:
+		stream(errorReporterLog) << mErrorReporterNumber << " "
+				<< event.first << " "
+				<< event.second << " "
+				<< event.third << " "
+				<< event.fourth << " "
+				<< time << "\n";
+
+		mErrorReporterNumber++;
+		break;
+	case Event::totalTime:
+		stream(totalTimeLog) << "TotalSessionTime: "
+				<< event.first << " secs Exit code:"
+				<< 0 << "\n";
+		break;
+	case Event::menuElementUsing:
+		stream(menuElementUsingLog) << mMenuElementUsingNumber << " "
+				<< event.first << " "
+				<< (event.second == "none" ? QString() : event.second + " ")
+				<< time << "\n";
+
+		mMenuElementUsingNumber++;
+		break;
+	case Event::mouseClick:
+		stream(mouseClickPositionLog) << mMouseClickPositionNumber << " ("
+				<< QString::number(event.position.x()) << ", "
+				<< QString::number(event.position.y()) << ") "
+				<< time << "\n";
+
+		mMouseClickPositionNumber++;
+		break;
+	case Event::settingChange:
+		stream(settingChangesLog) << mSettingChangesNumber << " "
+				<< event.first << " "
+				<< event.second << " "
+				<< event.third << " "
+				<< time << "\n";
+
+		mSettingChangesNumber++;
+		break;
+	case Event::testStarted:
+	case Event::testFinished:
+		for (QTextStream &logStream : mStreams) {
+			if (logStream.device()) {
+				logStream << "Test " << mTestNumber
+						<< (event.type == Event::testStarted ? " started at " : " finished at ")
+						<< time << "\n";
+			}
+		}
+
+		if (event.type == Event::testFinished) {
+			mTestNumber++;
+		}
+
+		break;
+	}
+}
+
+QTextStream &UXInfoWriter::stream(LogFile file)
+{
+	return mStreams[file];
+}
+
+QString UXInfoWriter::timestampToString(qint64 timestamp)
+{
+	return QDateTime::fromMSecsSinceEpoch(timestamp).toString("yyyy.MM.dd_hh.mm.ss.zzz");
+}
@@ -0,0 +1,119 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QAtomicPointer>
+#include <QtCore/QFile>
+#include <QtCore/QPoint>
+#include <QtCore/QSemaphore>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+
+namespace uxInfo {
+
+/// Background writer of usability logs. Events are posted into a lock-free queue, so reporting thread
+/// never waits for disk or formats strings; writer thread formats them and flushes in batches.
+class UXInfoWriter : public QThread
+{
+public:
+	/// Log files written by this writer.
+	enum LogFile {
+		elementCreationLog = 0
+		, errorReporterLog
+		, totalTimeLog
+		, menuElementUsingLog
+		, mouseClickPositionLog
+		, settingChangesLog
+		, logFilesCount
+	};
+
+	/// One reported event. Meaning of text fields depends on event type, they are listed in the order
+	/// they appear in a log line.
+	struct Event
+	{
+		enum Type {
+			elementCreation
+			, error
+			, totalTime
+			, menuElementUsing
+			, mouseClick
+			, settingChange
+			, testStarted
+			, testFinished
+		};
+
+		Type type;
+		qint64 timestamp;
+		QString first;
+		QString second;
+		QString third;
+		QString fourth;
+		QPoint position;
+	};
+
+	/// Creates writer and opens (truncating) log files with given paths. Writer does not start by itself.
+	/// @param fileNames - paths of log files, indexed by LogFile.
+	explicit UXInfoWriter(const QStringList &fileNames);
+
+	/// Stops writer if needed.
+	~UXInfoWriter() override;
+
+	/// Enqueues event for writing. Does not block and may be called from any thread.
+	void post(Event &&event);
+
+	/// Writes all posted events, closes files and stops writer thread.
+	void stop();
+
+	/// Returns true if some write has failed, most likely due to lack of disk space.
+	bool writeFailed() const;
+
+	/// Returns path to a given log file.
+	QString fileName(LogFile file) const;
+
+private:
+	struct Node
+	{
+		Event event;
+		Node *next;
+	};
+
+	void run() override;
+
+	/// Takes all events posted so far and writes them into files.
+	void writeBatch();
+	void write(const Event &event);
+	QTextStream &stream(LogFile file);
+
+	static QString timestampToString(qint64 timestamp);
+
+	QAtomicPointer<Node> mHead;
+	QAtomicInt mStopped;
+	QAtomicInt mWriteFailed;
+	QSemaphore mWakeUp;
+
+	QFile mFiles[logFilesCount];
+	QTextStream mStreams[logFilesCount];
+
+	int mCreationNumber = 1;
+	int mErrorReporterNumber = 1;
+	int mMenuElementUsingNumber = 1;
+	int mMouseClickPositionNumber = 1;
+	int mSettingChangesNumber = 1;
+	int mTestNumber = 1;
+};
+
+}
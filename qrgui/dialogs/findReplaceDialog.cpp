@@ -37,6 +37,7 @@ FindReplaceDialog::FindReplaceDialog(const qrRepo::LogicalRepoApi &logicalRepoAp
 
 	connect(mUi->mFindButton, SIGNAL(clicked()), this, SLOT(findClicked()));
 	connect(mUi->mReplaceButton, SIGNAL(clicked()), this, SLOT(replaceHandler()));
+	connect(mUi->mListWidget, SIGNAL(itemClicked(QListWidgetItem*)), this, SLOT(itemChosen(QListWidgetItem*)));
 
 	stateClear();
 
@@ -109,19 +110,20 @@ void FindReplaceDialog::itemChosen(QListWidgetItem *item)
 void FindReplaceDialog::initIds(QMap<QString, QString> foundData)
 {
 	mUi->mListWidget->clear();
+	addIds(foundData);
+}
 
-	for (auto const &currentId : foundData.keys()) {
-		qReal::Id parentId = mCommonApi.parent(qReal::Id::loadFromString(currentId));
+void FindReplaceDialog::addIds(const QMap<QString, QString> &foundData)
+{
+	for (auto it = foundData.constBegin(); it != foundData.constEnd(); ++it) {
+		const qReal::Id id = qReal::Id::loadFromString(it.key());
+		qReal::Id parentId = mCommonApi.parent(id);
 		QString parentName = mCommonApi.name(parentId);
 		if (!parentName.contains("qrm:/")) {
 			QListWidgetItem *item = new QListWidgetItem();
-			item->setText(parentName + tr(" / ") +
-				mCommonApi.name(qReal::Id::loadFromString(currentId)) + foundData[currentId]);
-			item->setData(Qt::ToolTipRole, currentId);
+			item->setText(parentName + tr(" / ") + mCommonApi.name(id) + it.value());
+			item->setData(Qt::ToolTipRole, it.key());
 			mUi->mListWidget->addItem(item);
 		}
 	}
-
-	QObject::connect(mUi->mListWidget, SIGNAL(itemClicked(QListWidgetItem*)), this
-			, SLOT(itemChosen(QListWidgetItem*)));
 }
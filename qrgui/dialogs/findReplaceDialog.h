@@ -42,6 +42,10 @@ public:
 	/// @param foundData - found data.
 	void initIds(QMap<QString, QString> foundData = QMap<QString, QString>());
 
+	/// Appends found data to already shown results, used when results come in portions.
+	/// @param foundData - found data.
+	void addIds(const QMap<QString, QString> &foundData);
+
 	/// Stets dialog state as starter.
 	void stateClear();
 	~FindReplaceDialog();
@@ -14,6 +14,87 @@
 
 #include "findManager.h"
 
+#include <functional>
+
+#include <QtCore/QRunnable>
+
+#include <qrrepo/elementsSearch.h>
+
+using namespace qrRepo;
+
+/// Count of elements checked between deliveries of found items and checks of cancellation.
+static const int searchPortionSize = 1000;
+
+namespace {
+
+/// Searches a snapshot of the repository, sends results to FindManager in portions.
+class SearchTask : public QRunnable
+{
+public:
+	SearchTask(ElementsSearch::Snapshot &&snapshot
+			, const QString &key
+			, bool sensitivity
+			, bool regExpression
+			, const QList<QPair<ElementsSearch::Mode, QString>> &modes
+			, const QString &prefix
+			, const QString &separator
+			, const QSharedPointer<QAtomicInt> &cancelled
+			, const std::function<void(const QMap<QString, QString> &)> &report)
+		: mSnapshot(std::move(snapshot))
+		, mSearch(key, sensitivity, regExpression)
+		, mModes(modes)
+		, mPrefix(prefix)
+		, mSeparator(separator)
+		, mCancelled(cancelled)
+		, mReport(report)
+	{
+		for (const auto &mode : mModes) {
+			mAllModes |= mode.first;
+		}
+	}
+
+	void run() override
+	{
+		QMap<QString, QString> found;
+		for (int i = 0; i < mSnapshot.size(); ++i) {
+			const ElementsSearch::Modes matched = mSearch.match(mSnapshot[i], mAllModes);
+			if (matched) {
+				QStringList description;
+				for (const auto &mode : mModes) {
+					if (matched & mode.first) {
+						description << mode.second;
+					}
+				}
+
+				found.insert(mSnapshot[i].id.toString(), mPrefix + description.join(mSeparator));
+			}
+
+			if ((i + 1) % searchPortionSize == 0 || i + 1 == mSnapshot.size()) {
+				if (mCancelled->load()) {
+					return;
+				}
+
+				if (!found.isEmpty()) {
+					mReport(found);
+					found.clear();
+				}
+			}
+		}
+	}
+
+private:
+	const ElementsSearch::Snapshot mSnapshot;
+	const ElementsSearch mSearch;
+	const QList<QPair<ElementsSearch::Mode, QString>> mModes;
+	const QString mPrefix;
+	const QString mSeparator;
+	ElementsSearch::Modes mAllModes;
+	const QSharedPointer<QAtomicInt> mCancelled;
+	const std::function<void(const QMap<QString, QString> &)> mReport;
+};
+
+}
+
 FindManager::FindManager(qrRepo::RepoControlInterface &controlApi
 		, qrRepo::LogicalRepoApi &logicalApi
 		, qReal::gui::MainWindowInterpretersInterface *mainWindow
@@ -25,6 +106,13 @@ FindManager::FindManager(qrRepo::RepoControlInterface &controlApi
 	, mFindReplaceDialog(findReplaceDialog)
 	, mMainWindow(mainWindow)
 {
+	mSearchThread.setMaxThreadCount(1);
+}
+
+FindManager::~FindManager()
+{
+	cancelSearch();
+	mSearchThread.waitForDone();
 }
 
 void FindManager::handleRefsDialog(const qReal::Id &id)
@@ -49,35 +137,83 @@ qReal::IdList FindManager::foundByMode(const QString &key, const QString &curren
 	}
 }
 
-QMap<QString, QString> FindManager::findItems(const QStringList &searchData)
+void FindManager::findItems(const QStringList &searchData)
 {
-	QMap<QString, QString> found;
-	bool sensitivity = searchData.contains(tr("case sensitivity"));
-	bool regExpression = searchData.contains(tr("by regular expression"));
-
-	for(int i = 1; i < searchData.length(); i++) {
-		if (searchData[i] != tr("case sensitivity") && searchData[i] != tr("by regular expression")) {
-			auto const& byMode = foundByMode(searchData.first(), searchData[i], sensitivity
-					, regExpression);
-			for (const qReal::Id &currentId : byMode) {
-				if (found.contains(currentId.toString())) {
-					found[currentId.toString()] += tr(", ") + searchData[i];
-					continue;
-				}
-				found.insert(currentId.toString(), tr("   :: ") + searchData[i]);
+	cancelSearch();
+	mFindReplaceDialog->initIds();
+
+	const QList<QPair<ElementsSearch::Mode, QString>> knownModes = {
+		{ElementsSearch::byName, tr("by name")}
+		, {ElementsSearch::byType, tr("by type")}
+		, {ElementsSearch::byProperty, tr("by property")}
+		, {ElementsSearch::byPropertyContent, tr("by property content")}
+	};
+
+	// Modes are described in the same order as they were given.
+	QList<QPair<ElementsSearch::Mode, QString>> modes;
+	for (int i = 1; i < searchData.length(); ++i) {
+		for (const auto &mode : knownModes) {
+			if (mode.second == searchData[i]) {
+				modes << mode;
 			}
 		}
 	}
-	return found;
+
+	if (modes.isEmpty()) {
+		return;
+	}
+
+	const int searchId = ++mSearchId;
+	mSearchCancelled.reset(new QAtomicInt(0));
+	mSearchThread.start(new SearchTask(mControlApi.searchSnapshot()
+			, searchData.first()
+			, searchData.contains(tr("case sensitivity"))
+			, searchData.contains(tr("by regular expression"))
+			, modes
+			, tr("   :: ")
+			, tr(", ")
+			, mSearchCancelled
+			, [this, searchId](const QMap<QString, QString> &found) {
+				QMetaObject::invokeMethod(this, [this, searchId, found]() {
+					onItemsFound(searchId, found);
+				}, Qt::QueuedConnection);
+			}));
+}
+
+void FindManager::onItemsFound(int searchId, const QMap<QString, QString> &found)
+{
+	if (searchId != mSearchId) {
+		return;
+	}
+
+	// Elements might be removed after the snapshot was taken.
+	QMap<QString, QString> existing;
+	for (auto it = found.constBegin(); it != found.constEnd(); ++it) {
+		if (mLogicalApi.exist(qReal::Id::loadFromString(it.key()))) {
+			existing.insert(it.key(), it.value());
+		}
+	}
+
+	mFindReplaceDialog->addIds(existing);
+}
+
+void FindManager::cancelSearch()
+{
+	++mSearchId;
+	if (mSearchCancelled) {
+		mSearchCancelled->store(1);
+	}
 }
 
 void FindManager::handleFindDialog(const QStringList &searchData)
 {
-	mFindReplaceDialog->initIds(findItems(searchData));
+	findItems(searchData);
 }
 
 void FindManager::handleReplaceDialog(QStringList &searchData)
 {
+	cancelSearch();
+
 	if (searchData.contains(tr("by name"))) {
 		qReal::IdList toRename = foundByMode(searchData.first(), tr("by name")
 				, searchData.contains(tr("case sensitivity"))
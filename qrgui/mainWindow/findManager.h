@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <QtCore/QAtomicInt>
 #include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
 
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterface.h>
 #include <qrgui/models/logicalModelAssistApi.h>
@@ -31,6 +34,8 @@ public:
 			, FindReplaceDialog *findReplaceDialog
 			, QObject *paresnt = nullptr);
 
+	~FindManager() override;
+
 public slots:
 	/// handler for find dialog 'button find' pressed
 	/// @param searchData - data was input to find
@@ -45,14 +50,23 @@ public slots:
 	void handleReplaceDialog(QStringList &searchData);
 
 private:
+	/// Receives a portion of found elements from the search worker.
+	/// @param searchId - number of the search the results belong to, outdated results are dropped.
+	/// @param found - found elements ids mapped to the description of the modes they matched.
+	void onItemsFound(int searchId, const QMap<QString, QString> &found);
+
+	/// Stops current background search, its results that are not yet delivered will be dropped.
+	void cancelSearch();
+
 	/// Finds items by input name and search mode
 	/// @param key - name
 	/// @param currentMode - mode
 	qReal::IdList foundByMode(const QString &key, const QString &currentMode, bool sensitivity, bool regExpression);
 
-	/// Finds items by input name and search modes - searchData
+	/// Starts search of items by input name and search modes - searchData. Search runs in a separate thread
+	/// against a snapshot of the repository and sends found items to the dialog in portions.
 	/// @param searchData - name and search modes
-	QMap<QString, QString> findItems(const QStringList &searchData);
+	void findItems(const QStringList &searchData);
 
 	qrRepo::RepoControlInterface &mControlApi;
 
@@ -62,4 +76,13 @@ private:
 	FindReplaceDialog *mFindReplaceDialog;
 
 	qReal::gui::MainWindowInterpretersInterface *mMainWindow;
+
+	/// Thread that runs the search.
+	QThreadPool mSearchThread;
+
+	/// Number of the current search.
+	int mSearchId = 0;
+
+	/// Cancellation flag of the current search, shared with its worker.
+	QSharedPointer<QAtomicInt> mSearchCancelled;
 };
@@ -14,11 +14,24 @@
 
 #include "miniMap.h"
 
+#include <QtGui/QPainter>
+#include <QtGui/QPaintEvent>
+#include <QtWidgets/QScrollBar>
+
+/// Minimal interval between cache updates, in milliseconds.
+static const int cacheUpdateInterval = 250;
+
+/// When more changed areas are accumulated, they are merged into their bounding rectangle.
+static const int maxDirtyRects = 32;
+
 MiniMap::MiniMap(QWidget *parent)
 		: QGraphicsView(parent)
 		, mEditorView(nullptr)
 		, mMode(None)
 {
+	mCacheUpdateTimer.setSingleShot(true);
+	mCacheUpdateTimer.setInterval(cacheUpdateInterval);
+	connect(&mCacheUpdateTimer, &QTimer::timeout, this, &MiniMap::updateCache);
 }
 
 void MiniMap::init(qReal::MainWindow *window)
@@ -52,11 +65,25 @@ void MiniMap::setCurrentScene()
 	setScene(mEditorView->scene());
 	// can affect zoom - need to change it if we make another desision about it
 	connect(mEditorView->scene(), SIGNAL(sceneRectChanged(QRectF)), this, SLOT(showScene()));
+
+	// the rectangle of the editor view is drawn live, the rest is taken from the cache
+	connect(mEditorView->horizontalScrollBar(), &QScrollBar::valueChanged, this, &MiniMap::updateEditorViewRect);
+	connect(mEditorView->verticalScrollBar(), &QScrollBar::valueChanged, this, &MiniMap::updateEditorViewRect);
 }
 
 void MiniMap::setScene(QGraphicsScene *scene)
 {
+	if (QGraphicsView::scene()) {
+		disconnect(QGraphicsView::scene(), SIGNAL(sceneRectChanged(QRectF)), this, SLOT(showScene()));
+		disconnect(QGraphicsView::scene(), &QGraphicsScene::changed, this, &MiniMap::invalidateCache);
+	}
+
 	QGraphicsView::setScene(scene);
+	if (scene) {
+		connect(scene, &QGraphicsScene::changed, this, &MiniMap::invalidateCache);
+	}
+
+	mCache = QImage();
 	showScene();
 }
 
@@ -66,6 +93,97 @@ void MiniMap::showScene()
 		setSceneRect(scene()->sceneRect());
 		fitInView(sceneRect(), Qt::KeepAspectRatio);
 	}
+
+	resetCache();
+}
+
+void MiniMap::invalidateCache(const QList<QRectF> &region)
+{
+	mDirtyRects << region;
+	if (mDirtyRects.size() > maxDirtyRects) {
+		QRectF boundingRect;
+		for (const QRectF &rect : mDirtyRects) {
+			boundingRect |= rect;
+		}
+
+		mDirtyRects = {boundingRect};
+	}
+
+	if (!mCacheUpdateTimer.isActive()) {
+		mCacheUpdateTimer.start();
+	}
+}
+
+void MiniMap::resetCache()
+{
+	mCacheInvalid = true;
+	mDirtyRects.clear();
+	if (!mCacheUpdateTimer.isActive()) {
+		mCacheUpdateTimer.start();
+	}
+}
+
+void MiniMap::updateCache()
+{
+	if (scene() == nullptr) {
+		mCache = QImage();
+		mDirtyRects.clear();
+		return;
+	}
+
+	const QRectF rect = sceneRect();
+	const QSize size = mapFromScene(rect).boundingRect().size().expandedTo(QSize(1, 1));
+	if (mCacheInvalid || mCache.size() != size || mCacheSceneRect != rect) {
+		mCache = QImage(size, QImage::Format_ARGB32_Premultiplied);
+		mCacheSceneRect = rect;
+		mDirtyRects = {rect};
+		mCacheInvalid = false;
+	}
+
+	if (mDirtyRects.isEmpty() || rect.isEmpty()) {
+		return;
+	}
+
+	const qreal xScale = size.width() / rect.width();
+	const qreal yScale = size.height() / rect.height();
+	QTransform transform;
+	transform.scale(xScale, yScale);
+	transform.translate(-rect.left(), -rect.top());
+
+	QPainter painter(&mCache);
+	painter.setRenderHints(renderHints());
+	painter.setTransform(transform);
+	QRegion updatedRegion;
+	for (const QRectF &dirtyRect : mDirtyRects) {
+		// one pixel of the cache around is also affected by antialiasing
+		const QRectF area = dirtyRect.adjusted(-1 / xScale, -1 / yScale, 1 / xScale, 1 / yScale).intersected(rect);
+		if (area.isEmpty()) {
+			continue;
+		}
+
+		painter.save();
+		painter.setClipRect(area);
+		painter.setCompositionMode(QPainter::CompositionMode_Source);
+		painter.fillRect(area, Qt::transparent);
+		painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+		scene()->render(&painter, area, area, Qt::IgnoreAspectRatio);
+		painter.restore();
+		updatedRegion += mapFromScene(area).boundingRect().adjusted(-1, -1, 1, 1);
+	}
+
+	mDirtyRects.clear();
+	viewport()->update(updatedRegion);
+}
+
+void MiniMap::updateEditorViewRect()
+{
+	QRegion region = mapFromScene(mEditorViewRect).boundingRect().adjusted(-1, -1, 1, 1);
+	if (mEditorView) {
+		mEditorViewRect = getNewRect();
+	}
+
+	region += mapFromScene(mEditorViewRect).boundingRect().adjusted(-1, -1, 1, 1);
+	viewport()->update(region);
 }
 
 void MiniMap::ensureVisible(const QList<QRectF> &region)
@@ -77,6 +195,11 @@ void MiniMap::ensureVisible(const QList<QRectF> &region)
 
 void MiniMap::clear()
 {
+	if (mEditorView) {
+		disconnect(mEditorView->horizontalScrollBar(), nullptr, this, nullptr);
+		disconnect(mEditorView->verticalScrollBar(), nullptr, this, nullptr);
+	}
+
 	mEditorViewRect = QRectF();
 	mEditorView = nullptr;
 }
@@ -128,6 +251,21 @@ void MiniMap::resizeEvent(QResizeEvent *event)
 	QGraphicsView::resizeEvent(event);
 }
 
+void MiniMap::paintEvent(QPaintEvent *event)
+{
+	QPainter painter(viewport());
+	painter.fillRect(event->rect(), backgroundBrush().style() == Qt::NoBrush
+			? palette().brush(QPalette::Base) : backgroundBrush());
+
+	painter.setTransform(viewportTransform());
+	if (!mCache.isNull()) {
+		painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+		painter.drawImage(mCacheSceneRect, mCache);
+	}
+
+	drawForeground(&painter, mapToScene(event->rect()).boundingRect());
+}
+
 void MiniMap::drawForeground(QPainter *painter, const QRectF &rect)
 {
 	QGraphicsView::drawForeground(painter, rect);
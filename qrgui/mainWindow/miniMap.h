@@ -15,6 +15,9 @@
 #pragma once
 
 #include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtGui/QImage>
+#include <QtGui/QRegion>
 #include <QtWidgets/QGraphicsView>
 
 #include "editor/editorView.h"
@@ -26,6 +29,9 @@
 * Displays the scene of current diagram. The area of the scene, visible in the
 * EditorView, displayed on the minimap as a rectangle. Navigation on the scene is possible
 * by moving that rectangle with mouse.
+*
+* Scene items are not painted live: the minimap shows a low-resolution image of the scene, in which only
+* changed areas are re-rasterized, not more often than a few times per second.
 */
 
 class MiniMap : public QGraphicsView
@@ -53,6 +59,8 @@ protected:
 	void mouseMoveEvent(QMouseEvent *event);
 	void mouseReleaseEvent(QMouseEvent *event);
 	void resizeEvent(QResizeEvent *event);
+	/// blits the cached scene image and draws the foreground over it
+	void paintEvent(QPaintEvent *event);
 
 	void drawForeground(QPainter *painter, const QRectF &rect);
 	/// painting out the areas which aren't to be painted on the minimap (not in the scene rect)
@@ -60,7 +68,20 @@ protected:
 	/// @return list of areas visible on the minimap but not included in the scene rectangle
 	QList<QRectF> getNonExistentAreas(const QRectF &rect);
 
+private slots:
+	/// remembers changed areas of the scene (in the scene coordinates) to re-rasterize them in the cache later
+	void invalidateCache(const QList<QRectF> &region);
+
+	/// re-rasterizes changed areas of the scene into the cache
+	void updateCache();
+
+	/// repaints the rectangle of the editor view at its old and new positions
+	void updateEditorViewRect();
+
 private:
+	/// schedules full re-rasterization of the cache
+	void resetCache();
+
 	void setCurrentScene();
 	void clear();
 	/// @return a rectangle of the scene which is viewed in the editor view
@@ -73,4 +94,15 @@ private:
 	QRectF mEditorViewRect;
 
 	Mode mMode;
+
+	/// low-resolution image of the scene shown instead of live items
+	QImage mCache;
+	/// scene rectangle covered by mCache
+	QRectF mCacheSceneRect;
+	/// areas of the scene changed since the last cache update, in the scene coordinates
+	QList<QRectF> mDirtyRects;
+	/// true if the whole cache must be rasterized from scratch
+	bool mCacheInvalid {true};
+	/// throttles cache updates
+	QTimer mCacheUpdateTimer;
 };
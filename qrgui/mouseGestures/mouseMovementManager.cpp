@@ -118,9 +118,10 @@ void MouseMovementManager::initializeGestures()
 	gestures.insert(deletionGestureKey, stringToPath(deletionGesture));
 	for (const Id &element : mEditorManagerInterface.elements(mDiagram)) {
 		const QString pathStr = mEditorManagerInterface.mouseGesture(element);
-		if (!pathStr.isEmpty() && !mInitializedGestures.contains(element)) {
-			gestures.insert(element.toString(), stringToPath(pathStr));
-			mInitializedGestures << element;
+		const QString key = element.toString();
+		if (!pathStr.isEmpty() && !mInitializedGestures.contains(key)) {
+			gestures.insert(key, stringToPath(pathStr));
+			mInitializedGestures.insert(key, element);
 		}
 	}
 
@@ -199,24 +200,13 @@ MouseMovementManager::GestureResult MouseMovementManager::result()
 	GestureResult result;
 	mGesturesManager->setKey(mPath);
 	mPath.clear();
-	qreal minDist = INT_MAX;
 
-	QMap<QString, Id> gestures;
-	gestures[deletionGestureKey] = Id();
-	for (const Id &element : mEditorManagerInterface.elements(mDiagram)) {
-		if (mInitializedGestures.contains(element)) {
-			gestures[element.toString()] = element;
-		}
-	}
-
-	for (const QString &key: gestures.keys()) {
-		minDist = qMin(minDist, mGesturesManager->getMaxDistance(key));
-		const qreal dist = mGesturesManager->getDistance(key);
-		if (dist < minDist) {
-			minDist = dist;
-			result.setType(key == deletionGestureKey ? deleteGesture : createElementGesture);
-			result.setElementType(gestures[key]);
-		}
+	const QString gesture = mGesturesManager->nearestGesture(mGesturesManager->getMaxDistance(QString()));
+	if (gesture == deletionGestureKey) {
+		result.setType(deleteGesture);
+	} else if (!gesture.isEmpty()) {
+		result.setType(createElementGesture);
+		result.setElementType(mInitializedGestures.value(gesture));
 	}
 
 	return result;
@@ -16,6 +16,7 @@
 
 #include <qrkernel/ids.h>
 
+#include <QtCore/QHash>
 #include <QtCore/QMap>
 #include <QtWidgets/QWidget>
 
@@ -66,7 +67,8 @@ private:
 	const EditorManagerInterface &mEditorManagerInterface;
 	PathVector mPath;
 	QPointF mCenter;
-	QSet<Id> mInitializedGestures;
+	/// Elements with ideal gestures already passed to gestures manager, by their gesture names.
+	QHash<QString, Id> mInitializedGestures;
 	QScopedPointer<KeyManager> mKeyStringManager;
 	QScopedPointer<GesturesManager> mGesturesManager;
 	bool mInitializing;
@@ -38,6 +38,10 @@ public:
 	virtual qreal getMaxDistance(const QString &object) = 0;
 	virtual qreal getDistance(const QString &object) = 0;
 	virtual bool isMultistroke() = 0;
+
+	/// Returns the name of the ideal gesture nearest to the current key, or empty string if every ideal gesture
+	/// is at \a maxDistance or farther. Among equally distant gestures the one with the least name is chosen.
+	virtual QString nearestGesture(qreal maxDistance) = 0;
 };
 
 template <typename TKey>
@@ -68,6 +72,20 @@ public:
 		mKey = getKey(path);
 	}
 
+	QString nearestGesture(qreal maxDistance) override
+	{
+		QString result;
+		for (auto it = mGestures.constBegin(); it != mGestures.constEnd(); ++it) {
+			const qreal distance = getDistance(mKey, it.value());
+			if (distance < maxDistance) {
+				maxDistance = distance;
+				result = it.key();
+			}
+		}
+
+		return result;
+	}
+
 	virtual qreal getMaxDistance(const QString &object) override = 0;
 
 protected:
@@ -14,44 +14,53 @@
 
 #include "levenshteinDistance.h"
 
-#include <QtCore/QList>
+#include <algorithm>
+#include <cstdlib>
+
+#include <QtCore/QVector>
 
 using namespace qReal::gestures;
 
 int LevenshteinDistance::getLevenshteinDistance(const QString &key1, const QString &key2)
+{
+	return getLevenshteinDistance(key1, key2, std::max(key1.size(), key2.size()));
+}
+
+int LevenshteinDistance::getLevenshteinDistance(const QString &key1, const QString &key2, int bound)
 {
 	const int m = key1.size();
 	const int n = key2.size();
 
+	if (std::abs(m - n) > bound)
+		return bound + 1;
+
 	if (m == 0)
 		return n;
 
 	if (n == 0)
 		return m;
 
-	QList<QList<int> > matrix;
-	for (int i = 0; i <= m; i++) {
-		QList<int> list;
-		for (int j = 0; j <= n; j++)
-			list << 0;
-		matrix << list;
-	}
-
-	for (int i = 0; i <= m; i++)
-		for (int j = 0; j <= n; j++)
-			if (i == 0 || j == 0)
-				matrix[i][j] = std::max(i, j);
+	// Only previous row of the matrix is needed, so one row is kept and updated in place.
+	static thread_local QVector<int> row;
+	row.resize(n + 1);
+	for (int j = 0; j <= n; ++j)
+		row[j] = j;
 
-	matrix[0][0] = 0;
-	int cost = 0;
 	for (int i = 1; i <= m; ++i) {
-		for(int j = 1; j <= n; ++j) {
-			cost = (key1[i - 1] == key2[j - 1]) ? 0 : 1;
-			const int aboveCell = matrix[i - 1][j];
-			const int leftCell = matrix[i][j - 1];
-			const int diagonalCell = matrix[i - 1][j - 1];
-			matrix[i][j] = std::min(std::min(aboveCell + 1, leftCell + 1), diagonalCell + cost);
+		int diagonalCell = row[0];
+		row[0] = i;
+		int rowMinimum = row[0];
+		for (int j = 1; j <= n; ++j) {
+			const int cost = (key1[i - 1] == key2[j - 1]) ? 0 : 1;
+			const int aboveCell = row[j];
+			row[j] = std::min(std::min(aboveCell + 1, row[j - 1] + 1), diagonalCell + cost);
+			diagonalCell = aboveCell;
+			rowMinimum = std::min(rowMinimum, row[j]);
 		}
+
+		if (rowMinimum > bound)
+			return bound + 1;
 	}
-	return matrix[m][n];
+
+	return row[n];
 }
@@ -24,6 +24,9 @@ class LevenshteinDistance
 {
 public:
 	static int getLevenshteinDistance(const QString &key1, const QString &key2);
+
+	/// Bounded version: stops as soon as distance is known to exceed \a bound and returns bound + 1 then.
+	static int getLevenshteinDistance(const QString &key1, const QString &key2, int bound);
 };
 
 }
@@ -14,6 +14,9 @@
 
 #include "mixedgesturesmanager.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "rectanglegesturesmanager.h"
 #include "nearestposgridgesturesmanager.h"
 #include "keyBuilder.h"
@@ -54,6 +57,86 @@ MixedGesturesManager::key_type MixedGesturesManager::getKey(const PathVector &pa
 	return {key1, key2};
 }
 
+void MixedGesturesManager::initIdealGestures(const QMap<QString, PathVector> &objects)
+{
+	GesturesRecognizer::initIdealGestures(objects);
+
+	mIndex.clear();
+	mIndex.reserve(mGestures.size());
+	for (auto it = mGestures.constBegin(); it != mGestures.constEnd(); ++it) {
+		mIndex.append({it.key(), it.value(), sum(it.value().first), sum(it.value().second)});
+	}
+}
+
+QString MixedGesturesManager::nearestGesture(qreal maxDistance)
+{
+	const int cellsCount = gridSize * gridSize;
+	const qreal rectangleSum = sum(mKey.first);
+	const qreal gridSum = sum(mKey.second);
+
+	// |sum(a) - sum(b)| <= sum(|a - b|) and max(|a - b|) >= sum(|a - b|) / n, which gives the lower bound of
+	// getDistance(). Tiny margin compensates rounding errors, so the bound never exceeds the exact distance.
+	QVector<QPair<qreal, int>> candidates;
+	candidates.reserve(mIndex.size());
+	for (int i = 0; i < mIndex.size(); ++i) {
+		const IndexEntry &entry = mIndex[i];
+		const qreal lowerBound = (weight1 * qAbs(rectangleSum - entry.rectangleSum)
+				+ weight2 * 2 * qAbs(gridSum - entry.gridSum)) / cellsCount * (1 - 1e-9);
+		if (lowerBound < maxDistance) {
+			candidates.append({lowerBound, i});
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end());
+
+	const IndexEntry *best = nullptr;
+	qreal bestDistance = maxDistance;
+	for (const auto &candidate : candidates) {
+		if (candidate.first > bestDistance) {
+			break;
+		}
+
+		const IndexEntry &entry = mIndex[candidate.second];
+		const qreal distance = boundedDistance(mKey, entry.key, bestDistance);
+		if (distance < bestDistance || (best && distance == bestDistance && entry.name < best->name)) {
+			bestDistance = distance;
+			best = &entry;
+		}
+	}
+
+	return best ? best->name : QString();
+}
+
+qreal MixedGesturesManager::boundedDistance(const key_type &key1, const key_type &key2, qreal bound)
+{
+	// The same as RectangleGesturesManager and NearestPosGridGesturesManager distances combined, computed in
+	// one pass. Partial value never decreases, so it is checked against bound after each grid row.
+	const int cellsCount = gridSize * gridSize;
+	qreal rectangleSum = 0;
+	qreal gridSum = 0;
+	qreal gridNorm = 0;
+	for (int row = 0; row < cellsCount; row += gridSize) {
+		for (int i = row; i < row + gridSize; ++i) {
+			rectangleSum += qAbs(key1.first[i] - key2.first[i]);
+			const qreal gridDifference = qAbs(key1.second[i] - key2.second[i]);
+			gridSum += gridDifference;
+			gridNorm = qMax(gridNorm, gridDifference);
+		}
+
+		const qreal distance = rectangleSum / cellsCount * weight1 + (gridNorm + gridSum / cellsCount) * weight2;
+		if (distance > bound) {
+			return distance;
+		}
+	}
+
+	return rectangleSum / cellsCount * weight1 + (gridNorm + gridSum / cellsCount) * weight2;
+}
+
+qreal MixedGesturesManager::sum(const QVector<qreal> &key)
+{
+	return std::accumulate(key.constBegin(), key.constEnd(), qreal(0));
+}
+
 MixedClassifier::MixedClassifier(MixedGesturesManager::key_type &&key)
 	: mKey(key)
 {
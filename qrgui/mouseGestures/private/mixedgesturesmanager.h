@@ -37,6 +37,32 @@ public:
 
 	qreal getDistance(const key_type &key1, const key_type &key2) override;
 	key_type  getKey(const PathVector &path) override;
+
+	void initIdealGestures(const QMap<QString, PathVector> &objects) override;
+
+	/// Searches the index of ideal gestures. Candidates are ordered by a cheap lower bound of the distance
+	/// computed from key sums, and exact distance is computed only while this bound can still beat the best match,
+	/// itself stopping early once it exceeds the best distance found so far.
+	QString nearestGesture(qreal maxDistance) override;
+
+private:
+	/// Ideal gesture prepared for the nearest gesture search.
+	struct IndexEntry
+	{
+		QString name;
+		key_type key;
+		qreal rectangleSum;
+		qreal gridSum;
+	};
+
+	/// Same as getDistance(), but may stop and return any value greater than \a bound as soon as it is known
+	/// that the distance exceeds it.
+	static qreal boundedDistance(const key_type &key1, const key_type &key2, qreal bound);
+
+	/// Returns sum of all components of a key.
+	static qreal sum(const QVector<qreal> &key);
+
+	QVector<IndexEntry> mIndex;
 };
 
 class MixedClassifier
@@ -136,6 +136,10 @@ public:
 	/// Loads SDF description of element's appearance.
 	void loadSdf(const QDomElement &picture);
 
+	/// Sets path to a file (usually a resource) with SDF description of element's appearance. The file is parsed on
+	/// the first request of sdf(), so types that are never shown do not pay for building their pictures.
+	void setSdfPath(const QString &path);
+
 	/// Returns a list of all labels on instances of this type.
 	const QList<QSharedPointer<LabelProperties>> &labels() const;
 
@@ -185,11 +189,18 @@ protected:
 	explicit ElementType(Metamodel &metamodel);
 
 private:
+	/// Parses SDF file set by setSdfPath(), if any.
+	void loadPendingSdf() const;
+
+	/// Merges the given picture into SDF description of this element.
+	void mergeSdf(const QDomElement &picture) const;
+
 	QString mName;
 	QString mFriendlyName;
 	QString mDescription;
 	QString mDiagram;
 	QScopedPointer<QDomDocument> mSdf;
+	mutable QString mPendingSdfPath;
 	QList<QSharedPointer<LabelProperties>> mLabels;
 	QStringList mPropertyNames;
 	QStringList mReferenceProperties;
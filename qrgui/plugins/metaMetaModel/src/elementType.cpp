@@ -14,8 +14,10 @@
 
 #include "metaMetaModel/elementType.h"
 
+#include <QtCore/QFile>
 #include <QtXml/QDomDocument>
 
+#include <qrkernel/logging.h>
 #include <qrgraph/queries.h>
 
 #include "metaMetaModel/metamodel.h"
@@ -170,10 +172,40 @@ void ElementType::setDiagram(const QString &diagramName)
 
 QDomElement ElementType::sdf() const
 {
+	loadPendingSdf();
 	return mSdf->isNull() ? QDomElement() : mSdf->documentElement();
 }
 
 void ElementType::loadSdf(const QDomElement &picture)
+{
+	loadPendingSdf();
+	mergeSdf(picture);
+}
+
+void ElementType::setSdfPath(const QString &path)
+{
+	loadPendingSdf();
+	mPendingSdfPath = path;
+}
+
+void ElementType::loadPendingSdf() const
+{
+	if (mPendingSdfPath.isEmpty()) {
+		return;
+	}
+
+	QFile file(mPendingSdfPath);
+	mPendingSdfPath.clear();
+	QDomDocument picture;
+	if (!file.open(QIODevice::ReadOnly) || !picture.setContent(&file)) {
+		QLOG_ERROR() << "Can not load SDF for" << mName << "from" << file.fileName();
+		return;
+	}
+
+	mergeSdf(picture.documentElement());
+}
+
+void ElementType::mergeSdf(const QDomElement &picture) const
 {
 	if (mSdf->isNull()) {
 		mSdf->appendChild(mSdf->importNode(picture, true));
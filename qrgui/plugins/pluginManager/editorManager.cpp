@@ -318,13 +318,22 @@ QIcon EditorManager::icon(const Id &id) const
 		return QIcon();
 	}
 
-	return SdfIconLoader::iconOf(id, elementType(id).sdf());
+	// Palette asks for icons of all elements, so the picture is parsed only when the icon is really drawn.
+	return SdfIconLoader::iconOf(id, [this, id]() {
+		return mMetamodels.contains(id.editor()) ? elementType(id).sdf() : QDomElement();
+	});
 }
 
 QSize EditorManager::iconSize(const Id &id) const
 {
 	Q_ASSERT(mMetamodels.contains(id.editor()));
 
+	// Declared size of a node comes from its picture, so there is no need to parse the picture itself.
+	const NodeElementType *node = dynamic_cast<const NodeElementType *>(&elementType(id));
+	if (node && !node->size().isEmpty()) {
+		return node->size().toSize();
+	}
+
 	return SdfIconLoader::preferedSizeOf(id, elementType(id).sdf());
 }
 
@@ -816,10 +816,28 @@ SdfIconEngineV2::SdfIconEngineV2(const QDomElement &picture)
 	mSize = QSize(mRenderer.pictureWidth(), mRenderer.pictureHeight());
 }
 
+SdfIconEngineV2::SdfIconEngineV2(const std::function<QDomElement()> &pictureProducer)
+	: mPictureProducer(pictureProducer)
+{
+}
+
+void SdfIconEngineV2::loadPendingPicture() const
+{
+	if (!mPictureProducer) {
+		return;
+	}
+
+	mRenderer.load(mPictureProducer());
+	mRenderer.noScale();
+	mSize = QSize(mRenderer.pictureWidth(), mRenderer.pictureHeight());
+	mPictureProducer = nullptr;
+}
+
 void SdfIconEngineV2::paint(QPainter *painter, const QRect &rect, QIcon::Mode mode, QIcon::State state)
 {
 	Q_UNUSED(mode)
 	Q_UNUSED(state)
+	loadPendingPicture();
 	painter->eraseRect(rect);
 	int rh = rect.height();
 	int rw = rect.width();
@@ -850,6 +868,7 @@ QIconEngine *SdfIconEngineV2::clone() const
 
 QSize SdfIconEngineV2::preferedSize() const
 {
+	loadPendingPicture();
 	return mSize;
 }
 
@@ -859,9 +878,22 @@ QIcon SdfIconLoader::iconOf(const Id &id, const QDomElement &sdf)
 	return loadPixmap(id, sdf);
 }
 
+QIcon SdfIconLoader::iconOf(const Id &id, const std::function<QDomElement()> &sdfProducer)
+{
+	if (!instance()->mLoadedIcons.contains(id)) {
+		// QIcon takes ownership over SdfIconEngineV2
+		instance()->mLoadedIcons[id] = QIcon(new SdfIconEngineV2(sdfProducer));
+	}
+
+	return instance()->mLoadedIcons[id];
+}
+
 QSize SdfIconLoader::preferedSizeOf(const Id &id, const QDomElement &sdf)
 {
-	loadPixmap(id, sdf);
+	if (!instance()->mPreferedSizes.contains(id)) {
+		instance()->mPreferedSizes[id] = SdfIconEngineV2(sdf).preferedSize();
+	}
+
 	return instance()->mPreferedSizes[id];
 }
 
@@ -25,6 +25,8 @@
 #include <QtGui/QIconEngine>
 #include <QtSvg/QSvgRenderer>
 
+#include <functional>
+
 #include <qrkernel/ids.h>
 #include <qrkernel/settingsManager.h>
 
@@ -128,13 +130,21 @@ public:
 	explicit SdfIconEngineV2(const QString &file);
 	explicit SdfIconEngineV2(const QDomDocument &document);
 	explicit SdfIconEngineV2(const QDomElement &picture);
+
+	/// Defers building the picture till the icon is painted or asked for its size for the first time.
+	/// @param pictureProducer - returns sdf description of the picture, called at most once.
+	explicit SdfIconEngineV2(const std::function<QDomElement()> &pictureProducer);
+
 	QSize preferedSize() const;
 	virtual void paint(QPainter *painter, const QRect &rect, QIcon::Mode mode, QIcon::State state);
 	virtual QIconEngine *clone() const;
 
 private:
-	SdfRenderer mRenderer;
-	QSize mSize;
+	void loadPendingPicture() const;
+
+	mutable SdfRenderer mRenderer;
+	mutable QSize mSize;
+	mutable std::function<QDomElement()> mPictureProducer;
 };
 
 /// Caches sdf-descripted icons
@@ -144,6 +154,10 @@ public:
 	/// Returns a pixmap of element in specified sdf-description. Descriptions are cached by id.
 	static QIcon iconOf(const Id &id, const QDomElement &sdf);
 
+	/// Returns an icon of element whose sdf description is requested only when the icon is painted for the first time,
+	/// so elements that are listed but never drawn do not pay for parsing their pictures. Icons are cached by id.
+	static QIcon iconOf(const Id &id, const std::function<QDomElement()> &sdfProducer);
+
 	/// Returns a size of the pixmap of element in specified sdf-description. Descriptions are cached by id.
 	static QSize preferedSizeOf(const Id &id, const QDomElement &sdf);
 
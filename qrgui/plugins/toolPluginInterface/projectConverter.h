@@ -16,10 +16,15 @@
 
 #include <functional>
 
+#include <QtCore/QList>
+#include <QtCore/QMap>
+
 #include <qrkernel/version.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/graphicalModelAssistInterface.h>
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterface.h>
 
+class QDomDocument;
+
 namespace qReal {
 
 /// A converter that transforms models from some version to later one.
@@ -42,6 +47,22 @@ public:
 	typedef std::function<ConvertionResult(GraphicalModelAssistInterface &
 			, LogicalModelAssistInterface &)> Converter;
 
+	/// Rewrites one element of a save. Takes the logical id of the element, returns true if something was modified.
+	/// If the element is removed, rules that follow will not be applied to it. Elements created by a rule
+	/// are not visited by rules of the same conversion pass, unlike with sequentially applied converters,
+	/// so a converter whose rules must see such elements has to be constructed with a conversion function.
+	typedef std::function<bool(const Id &, GraphicalModelAssistInterface &
+			, LogicalModelAssistInterface &)> ElementRewriter;
+
+	/// Tells if the given element of a save is an edge. Types of old saves may be missing in metamodel,
+	/// so converters know better how to recognize their edges.
+	typedef std::function<bool(const Id &)> EdgePredicate;
+
+	/// Rewrites XML document stored in some meta-information entry of a save,
+	/// returns true if something was modified. If the entry is not empty and can not be parsed,
+	/// the save is considered invalid.
+	typedef std::function<bool(QDomDocument &)> XmlRewriter;
+
 	ProjectConverter(const QString &editor
 			, const Version &fromVersion
 			, const Version &toVersion
@@ -53,6 +74,29 @@ public:
 	{
 	}
 
+	/// Constructs a converter made of rewriting rules. Such converter does not traverse the model itself,
+	/// rules of all consecutive rule-based converters are applied by VersionsConverterManager in one pass
+	/// over elements, and each rewritten meta-information entry is parsed and serialized only once.
+	/// Meta-information rewriters are applied after all element rewriters of the pass.
+	/// @param elementRewriters - rules that will be applied to every logical element of \a editor in a save,
+	/// all nodes are visited before edges.
+	/// @param isEdge - tells edges from nodes, if not set an element is an edge if it is connected to something.
+	/// @param metaInformationRewriters - rules for XML documents stored in meta-information, keyed by entry name.
+	ProjectConverter(const QString &editor
+			, const Version &fromVersion
+			, const Version &toVersion
+			, const QList<ElementRewriter> &elementRewriters
+			, const EdgePredicate &isEdge
+			, const QMap<QString, XmlRewriter> &metaInformationRewriters = {})
+		: mEditor(editor)
+		, mFromVersion(fromVersion)
+		, mToVersion(toVersion)
+		, mElementRewriters(elementRewriters)
+		, mIsEdge(isEdge)
+		, mMetaInformationRewriters(metaInformationRewriters)
+	{
+	}
+
 	/// Returns an editor whoose diagrams will be converted by this converter instance.
 	QString editor() const
 	{
@@ -71,9 +115,34 @@ public:
 		return mToVersion;
 	}
 
+	/// Returns true if this converter is made of rewriting rules and has no conversion function.
+	bool isRuleBased() const
+	{
+		return !mConverter;
+	}
+
+	/// Returns rules that shall be applied to every element of a save, in the order of their application.
+	QList<ElementRewriter> elementRewriters() const
+	{
+		return mElementRewriters;
+	}
+
+	/// Returns a predicate that tells edges from nodes for element rewriters, may be empty.
+	EdgePredicate edgePredicate() const
+	{
+		return mIsEdge;
+	}
+
+	/// Returns rules for XML documents stored in meta-information of a save, keyed by meta-information entry name.
+	QMap<QString, XmlRewriter> metaInformationRewriters() const
+	{
+		return mMetaInformationRewriters;
+	}
+
 	/// Performs conversion process and returns the success or the fail reason of this operation.
 	/// If operation was unsuccessful then the whole save is not accepted by the system
 	/// and corresponding error message will be shown.
+	/// Available only for converters constructed with conversion function, see isRuleBased().
 	ConvertionResult convert(GraphicalModelAssistInterface &graphicalApi
 			, LogicalModelAssistInterface &logicalApi)
 	{
@@ -85,6 +154,9 @@ private:
 	Version mFromVersion;
 	Version mToVersion;
 	Converter mConverter;
+	QList<ElementRewriter> mElementRewriters;
+	EdgePredicate mIsEdge;
+	QMap<QString, XmlRewriter> mMetaInformationRewriters;
 };
 
 }
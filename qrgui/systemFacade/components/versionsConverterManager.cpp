@@ -14,6 +14,8 @@
 
 #include "versionsConverterManager.h"
 
+#include <QtXml/QDomDocument>
+
 using namespace qReal;
 
 VersionsConverterManager::VersionsConverterManager(models::Models &models, ToolPluginManager &toolManager)
@@ -86,28 +88,36 @@ bool VersionsConverterManager::convertProject(const Version &enviromentVersion
 
 	bool converterApplied = false;
 
-	// Stage III: Sequentially applying converters
+	// Stage III: Sequentially applying converters. Consecutive rule-based converters are fused
+	// and applied in a single pass over the model.
+	QList<ProjectConverter> fusedConverters;
 	for (ProjectConverter &converter : sortedConverters) {
-		if (converter.fromVersion() >= saveVersion && converter.toVersion() <= enviromentVersion) {
-			const ProjectConverter::ConvertionResult result = converter.convert(
-					mModels.graphicalModelAssistApi()
-					, mModels.logicalModelAssistApi());
-			switch (result) {
-			case ProjectConverter::Success:
-				converterApplied = true;
-				break;
-			case ProjectConverter::NoModificationsMade:
-				break;
-			case ProjectConverter::SaveInvalid:
-				displayCannotConvertError();
-				return false;
-			case ProjectConverter::VersionTooOld:
-				displayTooOldSaveError(saveVersion);
-				return false;
-			}
+		if (converter.fromVersion() < saveVersion || converter.toVersion() > enviromentVersion) {
+			continue;
+		}
+
+		if (converter.isRuleBased()) {
+			fusedConverters << converter;
+			continue;
+		}
+
+		if (!processConvertionResult(applyRules(fusedConverters), saveVersion, converterApplied)) {
+			return false;
+		}
+
+		fusedConverters.clear();
+		const ProjectConverter::ConvertionResult result = converter.convert(
+				mModels.graphicalModelAssistApi()
+				, mModels.logicalModelAssistApi());
+		if (!processConvertionResult(result, saveVersion, converterApplied)) {
+			return false;
 		}
 	}
 
+	if (!processConvertionResult(applyRules(fusedConverters), saveVersion, converterApplied)) {
+		return false;
+	}
+
 	// Stage IV: Notifying user
 	if (converterApplied) {
 		mConverted = true;
@@ -120,6 +130,127 @@ bool VersionsConverterManager::convertProject(const Version &enviromentVersion
 	return true;
 }
 
+bool VersionsConverterManager::processConvertionResult(ProjectConverter::ConvertionResult result
+		, const Version &saveVersion, bool &converterApplied)
+{
+	switch (result) {
+	case ProjectConverter::Success:
+		converterApplied = true;
+		return true;
+	case ProjectConverter::NoModificationsMade:
+		return true;
+	case ProjectConverter::SaveInvalid:
+		displayCannotConvertError();
+		return false;
+	case ProjectConverter::VersionTooOld:
+		displayTooOldSaveError(saveVersion);
+		return false;
+	}
+
+	return false;
+}
+
+ProjectConverter::ConvertionResult VersionsConverterManager::applyRules(const QList<ProjectConverter> &converters)
+{
+	QList<ProjectConverter::ElementRewriter> elementRewriters;
+	QMap<QString, QList<ProjectConverter::XmlRewriter>> metaInformationRewriters;
+	for (const ProjectConverter &converter : converters) {
+		elementRewriters << converter.elementRewriters();
+		const QMap<QString, ProjectConverter::XmlRewriter> rewriters = converter.metaInformationRewriters();
+		for (auto it = rewriters.cbegin(); it != rewriters.cend(); ++it) {
+			metaInformationRewriters[it.key()] << it.value();
+		}
+	}
+
+	GraphicalModelAssistInterface &graphicalApi = mModels.graphicalModelAssistApi();
+	LogicalModelAssistInterface &logicalApi = mModels.logicalModelAssistApi();
+	bool modificationsMade = false;
+
+	if (!elementRewriters.isEmpty()) {
+		for (const Id &element : elementsToRewrite(converters)) {
+			for (const ProjectConverter::ElementRewriter &rewriter : elementRewriters) {
+				if (!logicalApi.logicalRepoApi().exist(element)) {
+					// Removed by one of the previous rules.
+					break;
+				}
+
+				modificationsMade |= rewriter(element, graphicalApi, logicalApi);
+			}
+		}
+	}
+
+	for (auto it = metaInformationRewriters.cbegin(); it != metaInformationRewriters.cend(); ++it) {
+		const QString xml = logicalApi.logicalRepoApi().metaInformation(it.key()).toString();
+		if (xml.isEmpty()) {
+			continue;
+		}
+
+		QDomDocument document;
+		if (!document.setContent(xml)) {
+			// Even rules that only rename values fail on such a save, they have nothing to work with.
+			return ProjectConverter::SaveInvalid;
+		}
+
+		bool documentModified = false;
+		for (const ProjectConverter::XmlRewriter &rewriter : it.value()) {
+			documentModified |= rewriter(document);
+		}
+
+		if (documentModified) {
+			logicalApi.mutableLogicalRepoApi().setMetaInformation(it.key(), document.toString(4));
+			modificationsMade = true;
+		}
+	}
+
+	return modificationsMade ? ProjectConverter::Success : ProjectConverter::NoModificationsMade;
+}
+
+IdList VersionsConverterManager::elementsToRewrite(const QList<ProjectConverter> &converters) const
+{
+	QList<ProjectConverter::EdgePredicate> edgePredicates;
+	for (const ProjectConverter &converter : converters) {
+		if (converter.edgePredicate()) {
+			edgePredicates << converter.edgePredicate();
+		}
+	}
+
+	const LogicalModelAssistInterface &logicalApi = mModels.logicalModelAssistApi();
+	const auto isEdge = [&edgePredicates, &logicalApi](const Id &element) {
+		if (edgePredicates.isEmpty()) {
+			// Elements of known types all have "from" and "to" properties, but only edges have them set.
+			const qrRepo::LogicalRepoApi &repo = logicalApi.logicalRepoApi();
+			return (repo.hasProperty(element, "from") && repo.from(element) != Id::rootId())
+					|| (repo.hasProperty(element, "to") && repo.to(element) != Id::rootId());
+		}
+
+		for (const ProjectConverter::EdgePredicate &predicate : edgePredicates) {
+			if (predicate(element)) {
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	IdList nodes;
+	IdList edges;
+	const QString editor = converters.first().editor();
+	for (const Id &element : logicalApi.children(Id::rootId())) {
+		if (element.editor() != editor) {
+			continue;
+		}
+
+		if (isEdge(element)) {
+			edges << element;
+		} else {
+			nodes << element;
+		}
+	}
+
+	// Nodes go first, so edges can be reconnected to nodes recreated by rules.
+	return nodes + edges;
+}
+
 void VersionsConverterManager::displayCannotConvertError()
 {
 	const QString errorMessage = QObject::tr("The attempt to automaticly convert this project "\
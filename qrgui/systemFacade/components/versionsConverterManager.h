@@ -40,6 +40,19 @@ private:
 			, const Version &saveVersion
 			, QList<ProjectConverter> const &converters);
 
+	/// Applies rules of the given rule-based converters in a single pass over the model and a single parse
+	/// of every rewritten meta-information entry.
+	ProjectConverter::ConvertionResult applyRules(const QList<ProjectConverter> &converters);
+
+	/// Returns logical elements of the given editor to be rewritten, nodes first and then edges.
+	/// Edges are recognized by predicates of \a converters, or by their ends if no converter has one.
+	IdList elementsToRewrite(const QList<ProjectConverter> &converters) const;
+
+	/// Shows error message if \a result is a failure, otherwise marks \a converterApplied if save was modified.
+	/// Returns false if conversion must be stopped.
+	bool processConvertionResult(ProjectConverter::ConvertionResult result
+			, const Version &saveVersion, bool &converterApplied);
+
 	void displayTooOldEnviromentError(const Version &saveVersion);
 	void displayCannotConvertError();
 	void displayTooOldSaveError(const Version &saveVersion);
@@ -18,7 +18,7 @@ TEMPLATE = lib
 
 include(../../global.pri)
 
-QT += widgets
+QT += widgets xml
 
 links(qrkernel qrutils qrgui-models qrgui-plugin-manager qrgui-text-editor qrgui-tool-plugin-interface)
 
@@ -14,86 +14,123 @@
 
 #include "textHighlighter.h"
 
+#include <algorithm>
+
 using namespace qReal;
 using namespace text;
 
-TextHighlighter::TextHighlighter(QTextDocument *document): QSyntaxHighlighter(document)
+static bool isWordCharacter(QChar c)
 {
-	HighlightingRule rule;
+	return c.isLetterOrNumber() || c == '_';
+}
 
+TextHighlighter::TextHighlighter(QTextDocument *document): QSyntaxHighlighter(document)
+{
 	mKeywordFormat.setForeground(Qt::darkBlue);
 	mKeywordFormat.setFontWeight(QFont::Bold);
-	QStringList keywordPatterns;
-	keywordPatterns << "\\bconst\\b" << "\\bdouble\\b" << "\\bint\\b" << "\\bvoid\\b"
-					<< "\\bwhile\\b" << "\\bif\\b" << "\\belse\\b"
-					<< "\\breturn\\b" << "\\bcontinue\\b" << "\\bbreak\\b"  ;
-	for (const QString &pattern : keywordPatterns) {
-		rule.pattern = QRegExp(pattern);
-		rule.format = mKeywordFormat;
-		mHighlightingRules.append(rule);
-	}
+	mKeywords << "const" << "double" << "int" << "void"
+			<< "while" << "if" << "else"
+			<< "return" << "continue" << "break";
+	std::sort(mKeywords.begin(), mKeywords.end());
 
 	mClassFormat.setFontWeight(QFont::Bold);
 	mClassFormat.setForeground(Qt::darkMagenta);
-	rule.pattern = QRegExp("\\bQ[A-Za-z]+\\b");
-	rule.format = mClassFormat;
-	mHighlightingRules.append(rule);
 
 	mQuotationFormat.setForeground(Qt::darkGreen);
-	rule.pattern = QRegExp("\".*\"");
-	rule.format = mQuotationFormat;
-	mHighlightingRules.append(rule);
 
 	mFunctionFormat.setForeground(Qt::black);
-	rule.pattern = QRegExp("\\b[A-Za-z0-9_]+(?=\\()");
-	rule.format = mFunctionFormat;
-	mHighlightingRules.append(rule);
 
-	mFunctionFormat.setForeground(Qt::blue);
-	rule.pattern = QRegExp("\\b[0-9]+");
-	rule.format = mFunctionFormat;
-	mHighlightingRules.append(rule);
+	mFigitsFormat.setForeground(Qt::blue);
 
 	mSingleLineCommentFormat.setForeground(Qt::darkGreen);
-	rule.pattern = QRegExp("//[^\n]*");
-	rule.format = mSingleLineCommentFormat;
-	mHighlightingRules.append(rule);
 
 	mMultiLineCommentFormat.setForeground(Qt::darkGreen);
-
-	mCommentStartExpression = QRegExp("/\\*");
-	mCommentEndExpression = QRegExp("\\*/");
 }
 
 void TextHighlighter::highlightBlock(const QString &text)
 {
-	for (const HighlightingRule &rule : mHighlightingRules) {
-		QRegExp expression(rule.pattern);
-		int index = expression.indexIn(text);
-		while (index >= 0) {
-			int length = expression.matchedLength();
-			setFormat(index, length, rule.format);
-			index = expression.indexIn(text, index + length);
-		}
+	setCurrentBlockState(normalState);
+
+	int position = 0;
+	if (previousBlockState() == insideCommentState) {
+		position = highlightMultiLineComment(text, 0, 0);
 	}
 
-	setCurrentBlockState(0);
+	while (position >= 0 && position < text.length()) {
+		const QChar c = text[position];
+		const QChar next = position + 1 < text.length() ? text[position + 1] : QChar();
+		if (c == '/' && next == '/') {
+			setFormat(position, text.length() - position, mSingleLineCommentFormat);
+			return;
+		} else if (c == '/' && next == '*') {
+			position = highlightMultiLineComment(text, position, position + 2);
+		} else if (c == '"' || c == '\'') {
+			position = highlightString(text, position);
+		} else if (isWordCharacter(c)) {
+			position = highlightWord(text, position);
+		} else {
+			++position;
+		}
+	}
+}
 
-	int startIndex = 0;
-	if (previousBlockState() != 1)
-		startIndex = mCommentStartExpression.indexIn(text);
+int TextHighlighter::highlightWord(const QString &text, int start)
+{
+	int end = start;
+	while (end < text.length() && isWordCharacter(text[end])) {
+		++end;
+	}
 
-	while (startIndex >= 0) {
-		int endIndex = mCommentEndExpression.indexIn(text, startIndex);
-		int commentLength;
-		if (endIndex == -1) {
-			setCurrentBlockState(1);
-			commentLength = text.length() - startIndex;
-		} else {
-			commentLength = endIndex - startIndex + mCommentEndExpression.matchedLength();
+	const QStringRef word = text.midRef(start, end - start);
+	if (word[0].isDigit()) {
+		int digitsEnd = start;
+		while (digitsEnd < end && word[digitsEnd - start].isDigit()) {
+			++digitsEnd;
 		}
-		setFormat(startIndex, commentLength, mMultiLineCommentFormat);
-		startIndex = mCommentStartExpression.indexIn(text, startIndex + commentLength);
+
+		setFormat(start, digitsEnd - start, mFigitsFormat);
+	} else if (isKeyword(word)) {
+		setFormat(start, word.length(), mKeywordFormat);
+	} else if (end < text.length() && text[end] == '(') {
+		setFormat(start, word.length(), mFunctionFormat);
+	} else if (word.length() > 1 && word[0] == 'Q'
+			&& std::all_of(word.begin() + 1, word.end(), [](QChar c) { return c.isLetter(); })) {
+		setFormat(start, word.length(), mClassFormat);
+	}
+
+	return end;
+}
+
+int TextHighlighter::highlightString(const QString &text, int start)
+{
+	const QChar quote = text[start];
+	int end = start + 1;
+	while (end < text.length() && text[end] != quote) {
+		end += text[end] == '\\' ? 2 : 1;
 	}
 
+	end = qMin(end + 1, text.length());
+	setFormat(start, end - start, mQuotationFormat);
+	return end;
+}
+
+int TextHighlighter::highlightMultiLineComment(const QString &text, int start, int bodyStart)
+{
+	const int endIndex = text.indexOf("*/", bodyStart);
+	if (endIndex == -1) {
+		setCurrentBlockState(insideCommentState);
+		setFormat(start, text.length() - start, mMultiLineCommentFormat);
+		return -1;
+	}
+
+	const int end = endIndex + 2;
+	setFormat(start, end - start, mMultiLineCommentFormat);
+	return end;
+}
+
+bool TextHighlighter::isKeyword(const QStringRef &word) const
+{
+	const auto it = std::lower_bound(mKeywords.cbegin(), mKeywords.cend(), word
+			, [](const QString &keyword, const QStringRef &word) { return QStringRef(&keyword) < word; });
+	return it != mKeywords.cend() && *it == word;
 }
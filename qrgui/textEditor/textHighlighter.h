@@ -19,6 +19,10 @@
 namespace qReal {
 namespace text {
 
+/// Syntax highlighter for C-like code. Scans each block once from left to right recognizing keywords,
+/// class names, function calls, numbers, strings and comments, without regular expressions.
+/// Whether a block ends inside a multi-line comment is kept as block state, so QSyntaxHighlighter
+/// re-highlights following blocks only when an edit actually changes that.
 class TextHighlighter : public QSyntaxHighlighter
 {
 public:
@@ -26,15 +30,26 @@ public:
 	void highlightBlock(const QString &text);
 
 private:
-	struct HighlightingRule
+	enum BlockState
 	{
-		QRegExp pattern;
-		QTextCharFormat format;
+		normalState = 0
+		, insideCommentState
 	};
-	QList<HighlightingRule> mHighlightingRules;
 
-	QRegExp mCommentStartExpression;
-	QRegExp mCommentEndExpression;
+	/// Highlights a word starting at \a start, returns the position right after it.
+	int highlightWord(const QString &text, int start);
+
+	/// Highlights a string literal opened at \a start, returns the position right after it.
+	int highlightString(const QString &text, int start);
+
+	/// Highlights a multi-line comment starting at \a start whose end is searched from \a bodyStart,
+	/// returns the position right after the comment end or -1 if the comment continues to the next block.
+	int highlightMultiLineComment(const QString &text, int start, int bodyStart);
+
+	bool isKeyword(const QStringRef &word) const;
+
+	/// Keywords sorted for binary search.
+	QStringList mKeywords;
 
 	QTextCharFormat mKeywordFormat;
 	QTextCharFormat mClassFormat;
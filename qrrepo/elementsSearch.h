@@ -0,0 +1,79 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QMap>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+#include <qrkernel/ids.h>
+
+#include "private/qrRepoGlobal.h"
+
+namespace qrRepo {
+
+/// Search of elements by name, type, property names or property values which does not touch the repository
+/// itself: elements are matched against a snapshot of their data. Taking a snapshot is cheap since property maps
+/// are implicitly shared with the repository, and the snapshot is not affected by later changes of the repository,
+/// so it can be searched in another thread.
+class QRREPO_EXPORT ElementsSearch
+{
+public:
+	/// Search criteria. Several of them can be combined.
+	enum Mode
+	{
+		byName = 0x1
+		, byType = 0x2
+		, byProperty = 0x4
+		, byPropertyContent = 0x8
+	};
+
+	Q_DECLARE_FLAGS(Modes, Mode)
+
+	/// Searchable data of one element.
+	struct Element
+	{
+		qReal::Id id;
+		bool isLogical;
+		QMap<QString, QVariant> properties;
+	};
+
+	using Snapshot = QVector<Element>;
+
+	/// Constructor.
+	/// @param key - string or regular expression to search for.
+	/// @param caseSensitive - if false, case is ignored when matching.
+	/// @param regExp - if true, \a key is a regular expression. It is compiled once and reused for all
+	///        elements and modes.
+	ElementsSearch(const QString &key, bool caseSensitive, bool regExp);
+
+	/// Returns those of \a modes that \a element satisfies, semantics of each mode is the same as of
+	/// corresponding RepoControlInterface and LogicalRepoApi methods.
+	Modes match(const Element &element, Modes modes) const;
+
+private:
+	bool contains(const QString &string) const;
+
+	const QString mKey;
+	const Qt::CaseSensitivity mCaseSensitivity;
+	const bool mUseRegExp;
+	const QRegularExpression mRegExp;
+};
+
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(qrRepo::ElementsSearch::Modes)
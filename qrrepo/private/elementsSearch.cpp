@@ -0,0 +1,68 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "elementsSearch.h"
+
+using namespace qrRepo;
+
+ElementsSearch::ElementsSearch(const QString &key, bool caseSensitive, bool regExp)
+	: mKey(key)
+	, mCaseSensitivity(caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive)
+	, mUseRegExp(regExp)
+	, mRegExp(regExp ? key : QString(), caseSensitive
+			? QRegularExpression::NoPatternOption : QRegularExpression::CaseInsensitiveOption)
+{
+	if (mUseRegExp) {
+		mRegExp.optimize();
+	}
+}
+
+ElementsSearch::Modes ElementsSearch::match(const Element &element, Modes modes) const
+{
+	Modes result;
+	if ((modes & byName) && !element.isLogical && contains(element.properties.value("name").toString())) {
+		result |= byName;
+	}
+
+	if ((modes & byType) && contains(element.id.element())) {
+		result |= byType;
+	}
+
+	if ((modes & byProperty) && !element.isLogical) {
+		for (auto it = element.properties.constBegin(); it != element.properties.constEnd(); ++it) {
+			// Property names are matched as a whole, regular expressions --- as a substring.
+			if (mUseRegExp ? contains(it.key()) : it.key().compare(mKey, mCaseSensitivity) == 0) {
+				result |= byProperty;
+				break;
+			}
+		}
+	}
+
+	if (modes & byPropertyContent) {
+		for (auto it = element.properties.constBegin(); it != element.properties.constEnd(); ++it) {
+			if (contains(it.value().toString())) {
+				result |= byPropertyContent;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool ElementsSearch::contains(const QString &string) const
+{
+	return mUseRegExp ? mRegExp.match(string).hasMatch() : string.contains(mKey, mCaseSensitivity);
+}
@@ -58,6 +58,11 @@ IdList RepoApi::findElementsByName(const QString &name, bool sensitivity, bool r
 	return mRepository->findElementsByName(name, sensitivity, regExpression);
 }
 
+ElementsSearch::Snapshot RepoApi::searchSnapshot() const
+{
+	return mRepository->searchSnapshot();
+}
+
 qReal::IdList RepoApi::elementsByPropertyContent(const QString &propertyContent, bool sensitivity
 		, bool regExpression) const
 {
@@ -542,27 +547,7 @@ IdList RepoApi::graphicalElements(const Id &type) const
 
 IdList RepoApi::elementsByType(const QString &type, bool sensitivity, bool regExpression) const
 {
-	const Qt::CaseSensitivity caseSensitivity = sensitivity ? Qt::CaseSensitive : Qt::CaseInsensitive;
-
-	QRegExp regExp(type,caseSensitivity);
-
-	IdList result;
-
-	if (regExpression) {
-		for (const Id &id : mRepository->elements()) {
-			if (id.element().contains(regExp)) {
-				result.append(id);
-			}
-		}
-	} else {
-		for (const Id &id : mRepository->elements()) {
-			if (id.element().contains(type, caseSensitivity)) {
-				result.append(id);
-			}
-		}
-	}
-
-	return result;
+	return mRepository->findElements(ElementsSearch(type, sensitivity, regExpression), ElementsSearch::byType);
 }
 
 qReal::IdList RepoApi::elementsByProperty(const QString &property, bool sensitivity, bool regExpression) const
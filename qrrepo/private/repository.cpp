@@ -49,75 +49,46 @@ Serializer &Repository::serializer()
 
 IdList Repository::findElementsByName(const QString &name, bool sensitivity, bool regExpression) const
 {
-	const Qt::CaseSensitivity caseSensitivity = sensitivity ? Qt::CaseSensitive : Qt::CaseInsensitive;
-
-	const QRegExp regExp(name, caseSensitivity);
-	IdList result;
-
-	if (regExpression){
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(regExp)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
-			}
-		}
-	} else {
-		for (Object * const element : mObjects.values()) {
-			if (element->property("name").toString().contains(name, caseSensitivity)
-					&& !isLogicalId(mObjects.key(element))) {
-				result.append(mObjects.key(element));
-			}
-		}
-	}
-
-	return result;
+	return findElements(ElementsSearch(name, sensitivity, regExpression), ElementsSearch::byName);
 }
 
 qReal::IdList Repository::elementsByProperty(const QString &property, bool sensitivity
 		, bool regExpression) const
 {
-	IdList result;
-
-	for (Object *element : mObjects.values()) {
-		if ((element->hasProperty(property, sensitivity, regExpression))
-				&& (!isLogicalId(mObjects.key(element)))) {
-			result.append(mObjects.key(element));
-		}
-	}
-
-	return result;
+	return findElements(ElementsSearch(property, sensitivity, regExpression), ElementsSearch::byProperty);
 }
 
 qReal::IdList Repository::elementsByPropertyContent(const QString &propertyValue, bool sensitivity
 		, bool regExpression) const
 {
-	const Qt::CaseSensitivity caseSensitivity = sensitivity ? Qt::CaseSensitive : Qt::CaseInsensitive;
+	return findElements(ElementsSearch(propertyValue, sensitivity, regExpression)
+			, ElementsSearch::byPropertyContent);
+}
 
-	const QRegExp regExp(propertyValue, caseSensitivity);
+qReal::IdList Repository::findElements(const ElementsSearch &search, ElementsSearch::Modes modes) const
+{
 	IdList result;
-
-	for (Object * const element : mObjects.values()) {
-		QMapIterator<QString, QVariant> iterator = element->propertiesIterator();
-		if (regExpression) {
-			while (iterator.hasNext()) {
-				if (iterator.next().value().toString().contains(regExp)) {
-					result.append(mObjects.key(element));
-					break;
-				}
-			}
-		} else {
-			while (iterator.hasNext()) {
-				if (iterator.next().value().toString().contains(propertyValue, caseSensitivity)) {
-					result.append(mObjects.key(element));
-					break;
-				}
-			}
+	for (auto it = mObjects.constBegin(); it != mObjects.constEnd(); ++it) {
+		const ElementsSearch::Element element{it.key(), it.value()->isLogicalObject(), it.value()->properties()};
+		if (search.match(element, modes)) {
+			result.append(it.key());
 		}
 	}
 
 	return result;
 }
 
+ElementsSearch::Snapshot Repository::searchSnapshot() const
+{
+	ElementsSearch::Snapshot result;
+	result.reserve(mObjects.size());
+	for (auto it = mObjects.constBegin(); it != mObjects.constEnd(); ++it) {
+		result.append({it.key(), it.value()->isLogicalObject(), it.value()->properties()});
+	}
+
+	return result;
+}
+
 void Repository::replaceProperties(const qReal::IdList &toReplace, const QString &value, const QString &newValue)
 {
 	for (const qReal::Id &currentId : toReplace) {
@@ -19,6 +19,7 @@
 #include <qrkernel/definitions.h>
 #include <qrkernel/ids.h>
 
+#include "elementsSearch.h"
 #include "classes/graphicalObject.h"
 #include "classes/logicalObject.h"
 #include "serializer.h"
@@ -54,6 +55,12 @@ public:
 	/// @param name - string that should be contained by names of elements that have input property content
 	qReal::IdList elementsByPropertyContent(const QString &property, bool sensitivity, bool regExpression) const;
 
+	/// Returns ids of elements that satisfy at least one of given search modes.
+	qReal::IdList findElements(const ElementsSearch &search, ElementsSearch::Modes modes) const;
+
+	/// Returns searchable data of all elements, see ElementsSearch.
+	ElementsSearch::Snapshot searchSnapshot() const;
+
 	qReal::IdList children(const qReal::Id &id) const;
 	qReal::Id parent(const qReal::Id &id) const;
 
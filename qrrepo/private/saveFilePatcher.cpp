@@ -0,0 +1,228 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "saveFilePatcher.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QSet>
+#include <QtXml/QDomDocument>
+
+#include <qrkernel/logging.h>
+
+#include "private/serializer.h"
+#include "private/valuesSerializer.h"
+
+#ifdef TS_USE_SYSTEM_QUAZIP
+#include "quazip5/quazip.h"
+#include "quazip5/quazipfile.h"
+#else
+#include "quazip/quazip.h"
+#include "quazip/quazipfile.h"
+#endif
+
+using namespace qrRepo;
+using namespace qrRepo::details;
+
+static const QString metaInfoEntry = "metaInfo.xml";
+
+SaveFilePatcher::SaveFilePatcher(const QString &saveFile)
+	: mSaveFile(saveFile)
+{
+	QuaZip zip(mSaveFile);
+	mIsValid = QFile::exists(mSaveFile) && zip.open(QuaZip::mdUnzip);
+}
+
+bool SaveFilePatcher::isValid() const
+{
+	return mIsValid;
+}
+
+QVariant SaveFilePatcher::metaInformation(const QString &key) const
+{
+	if (mPatched.contains(key)) {
+		return mPatched[key];
+	}
+
+	if (Serializer::metaInfoFileKeys().contains(key)) {
+		return QString::fromUtf8(readEntry(key + ".xml"));
+	}
+
+	QDomDocument document;
+	document.setContent(readEntry(metaInfoEntry));
+	for (QDomElement child = document.documentElement().firstChildElement("info")
+			; !child.isNull()
+			; child = child.nextSiblingElement("info"))
+	{
+		if (child.attribute("key") == key) {
+			return ValuesSerializer::deserializeQVariant(child.attribute("type"), child.attribute("value"));
+		}
+	}
+
+	return QVariant();
+}
+
+void SaveFilePatcher::setMetaInformation(const QString &key, const QVariant &value)
+{
+	mPatched[key] = value;
+}
+
+bool SaveFilePatcher::save()
+{
+	if (!mIsValid) {
+		return false;
+	}
+
+	QuaZip source(mSaveFile);
+	if (!source.open(QuaZip::mdUnzip)) {
+		return false;
+	}
+
+	const QString tempFile = mSaveFile + ".patching";
+	QuaZip target(tempFile);
+	if (!target.open(QuaZip::mdCreate)) {
+		return false;
+	}
+
+	const auto writeEntry = [&target](const QString &name, const QByteArray &data) {
+		QuaZipFile out(&target);
+		const bool ok = out.open(QIODevice::WriteOnly, QuaZipNewInfo(name)) && out.write(data) == data.size();
+		out.close();
+		return ok && out.getZipError() == ZIP_OK;
+	};
+
+	QSet<QString> written;
+	bool ok = true;
+	for (bool more = source.goToFirstFile(); more && ok; more = source.goToNextFile()) {
+		const QString name = source.getCurrentFileName();
+		const QString key = name.endsWith(".xml") ? name.left(name.size() - 4) : QString();
+		if (Serializer::metaInfoFileKeys().contains(key) && mPatched.contains(key)) {
+			ok = writeEntry(name, ValuesSerializer::serializeQVariant(mPatched[key]).toUtf8());
+			written << key;
+			continue;
+		}
+
+		if (name == metaInfoEntry && hasInfoPatches()) {
+			ok = writeEntry(name, patchedMetaInfo());
+			written << name;
+			continue;
+		}
+
+		// Copying compressed data as is, without inflating and deflating it again.
+		QuaZipFileInfo64 info;
+		source.getCurrentFileInfo(&info);
+		QuaZipFile in(&source);
+		int method = 0;
+		int level = 0;
+		if (!in.open(QIODevice::ReadOnly, &method, &level, true)) {
+			ok = false;
+			break;
+		}
+
+		QuaZipNewInfo newInfo(info);
+		newInfo.uncompressedSize = info.uncompressedSize;
+		QuaZipFile out(&target);
+		ok = out.open(QIODevice::WriteOnly, newInfo, nullptr, info.crc, method, level, true);
+		const qint64 bufferSize = 64 * 1024;
+		while (ok && !in.atEnd()) {
+			const QByteArray chunk = in.read(bufferSize);
+			ok = out.write(chunk) == chunk.size();
+		}
+
+		out.close();
+		in.close();
+		ok = ok && out.getZipError() == ZIP_OK;
+	}
+
+	for (auto it = mPatched.constBegin(); ok && it != mPatched.constEnd(); ++it) {
+		if (Serializer::metaInfoFileKeys().contains(it.key()) && !written.contains(it.key())) {
+			ok = writeEntry(it.key() + ".xml", ValuesSerializer::serializeQVariant(it.value()).toUtf8());
+		}
+	}
+
+	if (ok && hasInfoPatches() && !written.contains(metaInfoEntry)) {
+		ok = writeEntry(metaInfoEntry, patchedMetaInfo());
+	}
+
+	target.close();
+	source.close();
+	ok = ok && target.getZipError() == ZIP_OK;
+
+	if (!ok) {
+		QLOG_ERROR() << "Failed to patch" << mSaveFile;
+		QFile::remove(tempFile);
+		return false;
+	}
+
+	return QFile::remove(mSaveFile) && QFile::rename(tempFile, mSaveFile);
+}
+
+QByteArray SaveFilePatcher::readEntry(const QString &entryName) const
+{
+	QuaZip zip(mSaveFile);
+	if (!zip.open(QuaZip::mdUnzip) || !zip.setCurrentFile(entryName)) {
+		return QByteArray();
+	}
+
+	QuaZipFile file(&zip);
+	if (!file.open(QIODevice::ReadOnly)) {
+		return QByteArray();
+	}
+
+	return file.readAll();
+}
+
+bool SaveFilePatcher::hasInfoPatches() const
+{
+	for (const QString &key : mPatched.keys()) {
+		if (!Serializer::metaInfoFileKeys().contains(key)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+QByteArray SaveFilePatcher::patchedMetaInfo() const
+{
+	QDomDocument document;
+	document.setContent(readEntry(metaInfoEntry));
+	QDomElement root = document.documentElement();
+	if (root.isNull()) {
+		root = document.createElement("metaInformation");
+		document.appendChild(root);
+	}
+
+	QHash<QString, QDomElement> existing;
+	for (QDomElement child = root.firstChildElement("info"); !child.isNull(); child = child.nextSiblingElement("info")) {
+		existing[child.attribute("key")] = child;
+	}
+
+	for (auto it = mPatched.constBegin(); it != mPatched.constEnd(); ++it) {
+		if (Serializer::metaInfoFileKeys().contains(it.key())) {
+			continue;
+		}
+
+		QDomElement element = existing.value(it.key());
+		if (element.isNull()) {
+			element = document.createElement("info");
+			element.setAttribute("key", it.key());
+			root.appendChild(element);
+		}
+
+		element.setAttribute("type", it.value().typeName());
+		element.setAttribute("value", ValuesSerializer::serializeQVariant(it.value()));
+	}
+
+	return document.toString(4).toUtf8();
+}
@@ -176,7 +176,7 @@ void Serializer::saveMetaInfo(QHash<QString, QVariant> const &metaInfo) const
 	QDomElement root = document.createElement("metaInformation");
 	document.appendChild(root);
 	for (const QString &key : metaInfo.keys()) {
-		if (mFileNames.contains(key)) {
+		if (metaInfoFileKeys().contains(key)) {
 			const QString filePath = mWorkingDir + "/" + key + ".xml";
 			OutFile out(filePath);
 			out() << ValuesSerializer::serializeQVariant(metaInfo[key]);
@@ -211,7 +211,7 @@ void Serializer::loadMetaInfo(QHash<QString, QVariant> &metaInfo) const
 				child.attribute("type"), child.attribute("value"));
 	}
 
-	for (const auto & file : mFileNames) {
+	for (const auto & file : metaInfoFileKeys()) {
 		const QString path = mWorkingDir + "/" + file + ".xml";
 		if (!QFile::exists(path)) {
 			continue;
@@ -220,6 +220,12 @@ void Serializer::loadMetaInfo(QHash<QString, QVariant> &metaInfo) const
 	}
 }
 
+const QStringList &Serializer::metaInfoFileKeys()
+{
+	static const QStringList keys = {"worldModel", "blobs"};
+	return keys;
+}
+
 QString Serializer::pathToElement(const Id &id) const
 {
 	QString dirName = mWorkingDir;
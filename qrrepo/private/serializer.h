@@ -49,6 +49,9 @@ public:
 	/// Decompresses given file into working directory.
 	void decompressFile(const QString &fileName);
 
+	/// Returns keys of meta-information that is stored in separate "<key>.xml" files instead of metaInfo.xml.
+	static const QStringList &metaInfoFileKeys();
+
 private:
 	void loadFromDisk(const QString &currentPath, QHash<qReal::Id, Object *> &objectsHash);
 	void loadModel(const QDir &dir, QHash<qReal::Id, Object *> &objectsHash);
@@ -59,7 +62,6 @@ private:
 	QString pathToElement(const qReal::Id &id) const;
 	QString createDirectory(const qReal::Id &id, bool logical) const;
 
-	const QStringList mFileNames {"worldModel", "blobs"};
 	QString mWorkingDir;
 	QString mWorkingFile;
 };
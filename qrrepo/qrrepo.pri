@@ -51,6 +51,8 @@ SOURCES += \
 	$$PWD/private/serializer.cpp \
 	$$PWD/private/singleXmlSerializer.cpp \
 	$$PWD/private/valuesSerializer.cpp \
+	$$PWD/private/saveFilePatcher.cpp \
+	$$PWD/private/elementsSearch.cpp \
 	$$PWD/private/classes/object.cpp \
 	$$PWD/private/classes/logicalObject.cpp \
 	$$PWD/private/classes/graphicalObject.cpp \
@@ -59,6 +61,8 @@ SOURCES += \
 # repo API
 HEADERS += \
 	$$PWD/repoApi.h \
+	$$PWD/saveFilePatcher.h \
+	$$PWD/elementsSearch.h \
 	$$PWD/graphicalRepoApi.h \
 	$$PWD/logicalRepoApi.h \
 	$$PWD/repoControlInterface.h \
@@ -56,6 +56,8 @@ public:
 	qReal::IdList elementsByPropertyContent(const QString &propertyContent
 			, bool sensitivity, bool regExpression) const override;
 
+	ElementsSearch::Snapshot searchSnapshot() const override;
+
 	qReal::IdList children(const qReal::Id &id) const override;
 	void addChild(const qReal::Id &id, const qReal::Id &child) override;
 	void addChild(const qReal::Id &id, const qReal::Id &child, const qReal::Id &logicalId) override;
@@ -16,6 +16,8 @@
 
 #include <qrkernel/roles.h>
 
+#include "elementsSearch.h"
+
 namespace qrRepo {
 
 /// Provides repository control methods, like save or open saved contents.
@@ -41,6 +43,10 @@ public:
 	virtual qReal::IdList elementsByPropertyContent(const QString &propertyContent, bool sensitivity
 			, bool regExp) const = 0;
 
+	/// Returns searchable data of all elements which is not affected by later changes of the repository
+	/// and thus can be searched in another thread, see ElementsSearch.
+	virtual ElementsSearch::Snapshot searchSnapshot() const = 0;
+
 	/// virtual, for import *.qrs file into current project
 	/// @param importedFile - file to be imported
 	virtual void importFromDisk(const QString &importedFile) = 0;
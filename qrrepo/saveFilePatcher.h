@@ -0,0 +1,56 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QVariant>
+
+#include "private/qrRepoGlobal.h"
+
+namespace qrRepo {
+
+/// Modifies meta-information of a save file without loading the repository from it.
+/// Only the archive entries that hold requested or modified keys are decompressed; on saving all other
+/// entries (including the whole model tree) are copied into the new archive as raw compressed data.
+/// So the cost of patching depends on the size of patched values, not on the size of the project.
+/// Works only with zip-based save files, for old-format ones isValid() returns false and RepoApi should be used.
+class QRREPO_EXPORT SaveFilePatcher
+{
+public:
+	explicit SaveFilePatcher(const QString &saveFile);
+
+	/// Returns false if the save file does not exist or is not a zip archive.
+	bool isValid() const;
+
+	/// Returns the value of meta-information with the given key, either patched or stored in the save file.
+	QVariant metaInformation(const QString &key) const;
+
+	/// Replaces the value of meta-information with the given key. Nothing is written until save() is called.
+	void setMetaInformation(const QString &key, const QVariant &value);
+
+	/// Writes patched save file over the original one. Returns true if succeeded.
+	bool save();
+
+private:
+	QByteArray readEntry(const QString &entryName) const;
+	bool hasInfoPatches() const;
+	QByteArray patchedMetaInfo() const;
+
+	const QString mSaveFile;
+	bool mIsValid {};
+	QHash<QString, QVariant> mPatched;
+};
+
+}
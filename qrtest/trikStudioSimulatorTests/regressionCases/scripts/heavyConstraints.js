@@ -0,0 +1,16 @@
+// Crosses the grid of watched regions back and forth, bouncing off the outer walls.
+var turnDirection = 1;
+
+while (true) {
+	if (brick.sensor("A1").read() < 30) {
+		brick.motor("M4").setPower(60 * turnDirection);
+		brick.motor("M3").setPower(-60 * turnDirection);
+		script.wait(700);
+		turnDirection = -turnDirection;
+	} else {
+		brick.motor("M4").setPower(90);
+		brick.motor("M3").setPower(90);
+	}
+
+	script.wait(20);
+}
@@ -0,0 +1,19 @@
+// Wanders through the labyrinth, turning when infrared sensor or bumper reports a wall.
+var turnDirection = 1;
+
+while (true) {
+	if (brick.sensor("A1").read() < 25 || brick.sensor("D1").read() > 0) {
+		brick.motor("M4").setPower(-50);
+		brick.motor("M3").setPower(-50);
+		script.wait(200);
+		brick.motor("M4").setPower(60 * turnDirection);
+		brick.motor("M3").setPower(-60 * turnDirection);
+		script.wait(400);
+		turnDirection = -turnDirection;
+	} else {
+		brick.motor("M4").setPower(80);
+		brick.motor("M3").setPower(80);
+	}
+
+	script.wait(20);
+}
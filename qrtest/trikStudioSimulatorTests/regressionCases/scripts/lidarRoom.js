@@ -0,0 +1,22 @@
+// Drives through the room turning away from the closest obstacle seen by lidar.
+while (true) {
+	var distances = brick.lidar().read();
+	var closest = 0;
+	for (var angle = 0; angle < distances.length; ++angle) {
+		if (distances[angle] > 0 && (distances[closest] == 0 || distances[angle] < distances[closest])) {
+			closest = angle;
+		}
+	}
+
+	var obstacleAhead = distances[closest] > 0 && distances[closest] < 40 && (closest < 45 || closest > 315);
+	if (obstacleAhead) {
+		var turn = closest < 45 ? -70 : 70;
+		brick.motor("M4").setPower(turn);
+		brick.motor("M3").setPower(-turn);
+	} else {
+		brick.motor("M4").setPower(70);
+		brick.motor("M3").setPower(70);
+	}
+
+	script.wait(50);
+}
@@ -0,0 +1,14 @@
+// Proportional line follower on two reflected light sensors.
+var basePower = 60;
+var gain = 1.5;
+
+function clamp(power) {
+	return Math.max(-100, Math.min(100, power));
+}
+
+while (true) {
+	var error = brick.sensor("A1").read() - brick.sensor("A2").read();
+	brick.motor("M4").setPower(clamp(basePower + gain * error));
+	brick.motor("M3").setPower(clamp(basePower - gain * error));
+	script.wait(10);
+}
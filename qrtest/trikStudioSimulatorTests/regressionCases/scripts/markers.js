@@ -0,0 +1,15 @@
+// Draws a spiral of alternating colors with the robot marker.
+var colors = ["red", "green", "blue", "black"];
+var segment = 0;
+
+while (true) {
+	brick.marker().down(colors[segment % colors.length]);
+	brick.motor("M4").setPower(80);
+	brick.motor("M3").setPower(80);
+	script.wait(200 + 20 * (segment % 50));
+	brick.marker().up();
+	brick.motor("M4").setPower(50);
+	brick.motor("M3").setPower(-50);
+	script.wait(300);
+	++segment;
+}
@@ -0,0 +1,163 @@
+#!/bin/bash
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+function show_help {
+	echo "Usage: run-regression-cases.sh [--record-budgets [margin-percent]]"
+	echo "Runs every case listed in 'regressionCases/cases.txt' in 2D model, checks its outcome and compares"
+	echo "simulated ticks with the budget of the case. Wall time and peak memory usage are only reported, they"
+	echo "depend on the load of the machine; the wall time budget just bounds a hanging run."
+	echo "Results are printed as a table and written to 'regression-results.txt'."
+	echo "With --record-budgets budgets in 'regressionCases/cases.txt' are replaced by measured values plus"
+	echo "the given margin (50% by default), outcomes are still checked."
+	exit 0
+}
+
+cd "$(dirname "$0")"
+
+recordBudgets=0
+margin=50
+
+if [ "$1" == "--help" ] || [ "$1" == "-h" ]; then
+	show_help
+fi
+
+if [ "$1" == "--record-budgets" ]; then
+	recordBudgets=1
+	margin=${2:-$margin}
+fi
+
+binFolder=$(pwd)
+casesFolder=$binFolder/regressionCases
+casesFile=$casesFolder/cases.txt
+resultsFile=$binFolder/regression-results.txt
+
+if ! [ -f "$casesFile" ]; then
+	echo "No '$casesFile' found, no regression cases to run. Check your build configuration."
+	exit 1
+fi
+
+if [ -f "$binFolder/2D-model" ]; then
+	twoDModel=$binFolder/2D-model
+	patcher=$binFolder/patcher
+else
+	twoDModel=$binFolder/2D-model-d
+	patcher=$binFolder/patcher-d
+fi
+
+export LD_LIBRARY_PATH=$binFolder:$LD_LIBRARY_PATH
+
+workFolder=$(mktemp -d)
+trap 'rm -rf "$workFolder"' EXIT
+
+# Extracts integer value of the given key from the flat JSON written by 2D-model --stats.
+function statistic {
+	grep -o "\"$2\": *[0-9]*" "$1" | grep -o "[0-9]*$"
+}
+
+function withMargin {
+	echo $(( $1 + $1 * margin / 100 + 1 ))
+}
+
+status=0
+recordedCases=$workFolder/cases.txt
+printf "%-18s %-8s %-8s %10s %10s %10s  %s\n" "case" "expected" "actual" "ticks" "wall, ms" "memory, MB" "verdict" \
+		| tee "$resultsFile"
+
+while IFS= read -r line; do
+	if [[ -z "${line// }" ]] || [[ $line == \#* ]]; then
+		echo "$line" >> "$recordedCases"
+		continue
+	fi
+
+	read -r name save field script input mode expect ticksBudget wallTimeBudget memoryBudget <<< "$line"
+
+	# Hard limit for the whole run, so a hanging case can not block the suite.
+	timeLimit=$(( wallTimeBudget * 4 / 1000 + 30 ))
+
+	caseSave=$workFolder/$name.qrs
+	caseStatistics=$workFolder/$name.json
+	cp -f "$casesFolder/$save" "$caseSave"
+
+	patcherArguments=()
+	[ "$field" != "-" ] && patcherArguments+=(-f "$casesFolder/$field")
+	[ "$script" != "-" ] && patcherArguments+=(-s "$casesFolder/$script")
+	inputArguments=()
+	[ "$input" != "-" ] && inputArguments+=(--input "$casesFolder/$input")
+
+	verdict="ok"
+	if [ ${#patcherArguments[@]} -ne 0 ] && ! "$patcher" "$caseSave" "${patcherArguments[@]}" < /dev/null > /dev/null; then
+		verdict="patching failed"
+		exitCode=-1
+	else
+		timeout --preserve-status --foreground -s KILL $timeLimit \
+				"$twoDModel" --platform minimal -b "$caseSave" \
+				--report "$workFolder/$name.report" \
+				--trajectory "$workFolder/$name.trajectory" \
+				--stats "$caseStatistics" \
+				--mode "$mode" \
+				"${inputArguments[@]}" < /dev/null > /dev/null 2>&1
+		exitCode=$?
+	fi
+
+	case $exitCode in
+		0) actual="success" ;;
+		1) actual="fail" ;;
+		137) actual="timeout" ;;
+		*) actual="error($exitCode)" ;;
+	esac
+
+	ticks=-
+	wallTime=-
+	memory=-
+	if [ "$verdict" == "ok" ] && [ -f "$caseStatistics" ]; then
+		ticks=$(statistic "$caseStatistics" ticks)
+		wallTime=$(statistic "$caseStatistics" wallTime)
+		memory=$(( $(statistic "$caseStatistics" peakMemory) / 1024 / 1024 ))
+	elif [ "$verdict" == "ok" ]; then
+		verdict="no statistics"
+	fi
+
+	if [ "$verdict" == "ok" ]; then
+		if [ "$actual" != "success" ] && [ "$actual" != "fail" ]; then
+			verdict="crashed"
+		elif [ "$expect" != "any" ] && [ "$expect" != "$actual" ]; then
+			verdict="unexpected outcome"
+		elif [ $recordBudgets -eq 0 ] && [ "$ticks" -gt "$ticksBudget" ]; then
+			verdict="ticks over budget ($ticksBudget)"
+		fi
+	fi
+
+	if [ "$verdict" != "ok" ]; then
+		status=1
+		[ -f "$workFolder/$name.report" ] && cp -f "$workFolder/$name.report" "$binFolder/regression-$name.report"
+	fi
+
+	if [ $recordBudgets -eq 1 ] && [ "$verdict" == "ok" ]; then
+		echo "$name $save $field $script $input $mode $expect $(withMargin $ticks) $(withMargin $wallTime)"\
+				"$(withMargin $memory)" >> "$recordedCases"
+	else
+		echo "$line" >> "$recordedCases"
+	fi
+
+	printf "%-18s %-8s %-8s %10s %10s %10s  %s\n" "$name" "$expect" "$actual" "$ticks" "$wallTime" "$memory" "$verdict" \
+			| tee -a "$resultsFile"
+done < "$casesFile"
+
+if [ $recordBudgets -eq 1 ]; then
+	cp -f "$recordedCases" "$casesFile"
+	echo "Budgets are recorded to $casesFile"
+fi
+
+exit $status
@@ -43,6 +43,15 @@ for i in $( ls solutions ); do
 	fi
 done
 
+if [ -f ./run-regression-cases.sh ]; then
+	echo "Running regression cases..."
+	./run-regression-cases.sh
+	if [ $? -ne 0 ]; then
+		echo "Regression cases failed, see regression-results.txt" >> failed-tests
+		status=1
+	fi
+fi
+
 if [ $status -ne 0 ]; then
 	cat failed-tests
 fi
@@ -21,8 +21,11 @@ include(../../global.pri)
 
 copyToDestdir(tasks, now)
 copyToDestdir(solutions, now)
+copyToDestdir(regressionCases, now)
 
 OTHER_FILES += \
 	$$PWD/run-simulator-tests.sh \
+	$$PWD/run-regression-cases.sh \
 
 copyToDestdir(run-simulator-tests.sh, now)
+copyToDestdir(run-regression-cases.sh, now)
@@ -0,0 +1,79 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtGui/QPolygon>
+
+#include <qrgui/plugins/toolPluginInterface/usedInterfaces/graphicalModelAssistInterface.h>
+#include <qrgui/plugins/pluginManager/editorManagerInterface.h>
+#include <qrgui/models/elementInfo.h>
+
+#include <gmock/gmock.h>
+
+namespace qrTest {
+
+class GraphicalModelAssistInterfaceMock : public qReal::GraphicalModelAssistInterface
+{
+public:
+	typedef QMap<QString, QVariant> Properties;
+
+	MOCK_CONST_METHOD0(graphicalRepoApi, const qrRepo::GraphicalRepoApi &());
+	MOCK_CONST_METHOD0(mutableGraphicalRepoApi, qrRepo::GraphicalRepoApi &());
+	MOCK_METHOD2(createElement, qReal::Id(const qReal::Id &parent, const qReal::Id &type));
+	MOCK_METHOD6(createElement, qReal::Id(const qReal::Id &parent, const qReal::Id &id, bool isFromLogicalModel
+			, const QString &name, const QPointF &position, const qReal::Id &preferedLogicalId));
+	MOCK_METHOD1(createElements, void(QList<qReal::ElementInfo> &elements));
+	MOCK_METHOD1(copyElement, qReal::Id(const qReal::Id &source));
+	MOCK_CONST_METHOD1(parent, qReal::Id(const qReal::Id &element));
+	MOCK_CONST_METHOD1(children, qReal::IdList(const qReal::Id &element));
+	MOCK_METHOD3(changeParent, void(const qReal::Id &element, const qReal::Id &parent, const QPointF &position));
+	MOCK_METHOD2(copyProperties, void(const qReal::Id &dest, const qReal::Id &src));
+	MOCK_METHOD1(properties, Properties(const qReal::Id &id));
+	MOCK_CONST_METHOD1(temporaryRemovedLinksFrom, qReal::IdList(const qReal::Id &elem));
+	MOCK_CONST_METHOD1(temporaryRemovedLinksTo, qReal::IdList(const qReal::Id &elem));
+	MOCK_CONST_METHOD1(temporaryRemovedLinksNone, qReal::IdList(const qReal::Id &elem));
+	MOCK_METHOD1(removeTemporaryRemovedLinks, void(const qReal::Id &elem));
+	MOCK_METHOD2(setConfiguration, void(const qReal::Id &elem, const QPolygon &newValue));
+	MOCK_CONST_METHOD1(configuration, QPolygon(const qReal::Id &elem));
+	MOCK_METHOD2(setPosition, void(const qReal::Id &elem, const QPointF &newValue));
+	MOCK_CONST_METHOD1(position, QPointF(const qReal::Id &elem));
+	MOCK_METHOD2(setToPort, void(const qReal::Id &elem, const qreal &newValue));
+	MOCK_CONST_METHOD1(toPort, qreal(const qReal::Id &elem));
+	MOCK_METHOD2(setFromPort, void(const qReal::Id &elem, const qreal &newValue));
+	MOCK_CONST_METHOD1(fromPort, qreal(const qReal::Id &elem));
+	MOCK_METHOD2(setToolTip, void(const qReal::Id &elem, const QString &newValue));
+	MOCK_CONST_METHOD1(toolTip, QString(const qReal::Id &elem));
+	MOCK_CONST_METHOD1(logicalId, qReal::Id(const qReal::Id &elem));
+	MOCK_CONST_METHOD1(graphicalIdsByLogicalId, qReal::IdList(const qReal::Id &logicalId));
+	MOCK_CONST_METHOD1(isGraphicalId, bool(const qReal::Id &id));
+
+	MOCK_METHOD2(setName, void(const qReal::Id &elem, const QString &newValue));
+	MOCK_CONST_METHOD1(name, QString(const qReal::Id &elem));
+	MOCK_METHOD2(setTo, void(const qReal::Id &elem, const qReal::Id &newValue));
+	MOCK_CONST_METHOD1(to, qReal::Id(const qReal::Id &elem));
+	MOCK_METHOD2(setFrom, void(const qReal::Id &elem, const qReal::Id &newValue));
+	MOCK_CONST_METHOD1(from, qReal::Id(const qReal::Id &elem));
+	MOCK_CONST_METHOD1(indexById, QModelIndex(const qReal::Id &id));
+	MOCK_CONST_METHOD1(idByIndex, qReal::Id(const QModelIndex &index));
+	MOCK_CONST_METHOD0(rootIndex, QPersistentModelIndex());
+	MOCK_CONST_METHOD0(rootId, qReal::Id());
+	MOCK_CONST_METHOD0(hasRootDiagrams, bool());
+	MOCK_CONST_METHOD0(childrenOfRootDiagram, int());
+	MOCK_CONST_METHOD1(childrenOfDiagram, int(const qReal::Id &parent));
+	MOCK_METHOD1(removeElement, void(const qReal::Id &id));
+	MOCK_CONST_METHOD0(editorManagerInterface, const qReal::EditorManagerInterface &());
+};
+
+}
@@ -15,5 +15,7 @@
 TEMPLATE = subdirs
 
 SUBDIRS = \
+	ev3KitTests \
 	kitBaseTests \
+	nxtKitTests \
 	twoDModelTests \
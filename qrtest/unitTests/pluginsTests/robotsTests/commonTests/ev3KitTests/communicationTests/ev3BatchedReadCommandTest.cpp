@@ -0,0 +1,114 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "ev3BatchedReadCommandTest.h"
+
+#include <cstring>
+
+#include <QtCore/QtEndian>
+
+#include <ev3Kit/communication/ev3BatchedReadCommand.h>
+
+using namespace qrTest::robotsTests::ev3KitTests;
+using namespace ev3::communication;
+
+void Ev3BatchedReadCommandTest::SetUp()
+{
+	mBrick.connect();
+	mBrick.setSensorValue(0, 1);
+	mBrick.setSensorValue(1, 42);
+	mBrick.setSensorValue(2, 255);
+	mBrick.setSensorValue(3, -1000);
+}
+
+QByteArray Ev3BatchedReadCommandTest::roundTrip(const QByteArray &command, int responseSize)
+{
+	QByteArray reply;
+	static_cast<utils::robotCommunication::RobotCommunicationThreadInterface &>(mBrick).send(
+			command, responseSize, reply);
+	return reply;
+}
+
+TEST_F(Ev3BatchedReadCommandTest, singleReadingHasLegacyLayout)
+{
+	Ev3BatchedReadCommand command;
+	ASSERT_EQ(0, command.add(1, Ev3BatchedReadCommand::Format::percent, 0));
+
+	// Single reading must be byte-to-byte the same as commands sent by sensors before batching.
+	const QByteArray bytes = command.command();
+	ASSERT_EQ(21, bytes.size());
+	ASSERT_EQ(9, command.responseSize());
+	ASSERT_EQ(4, bytes[5]);
+	ASSERT_EQ(0, bytes[6]);
+
+	const QByteArray reply = roundTrip(bytes, command.responseSize());
+	ASSERT_EQ(9, reply.size());
+	ASSERT_EQ(42, Ev3BatchedReadCommand::reading(reply, 0)[0]);
+}
+
+TEST_F(Ev3BatchedReadCommandTest, severalReadingsTakeOneRoundTrip)
+{
+	Ev3BatchedReadCommand command;
+	command.add(0, Ev3BatchedReadCommand::Format::si, 0);
+	command.add(1, Ev3BatchedReadCommand::Format::percent, 1);
+	command.add(2, Ev3BatchedReadCommand::Format::raw, 2);
+	command.add(3, Ev3BatchedReadCommand::Format::raw, 0);
+
+	const QByteArray reply = roundTrip(command.command(), command.responseSize());
+	ASSERT_EQ(1, mBrick.messagesCount());
+	ASSERT_EQ(4, mBrick.readingsCount());
+
+	const QByteArray si = Ev3BatchedReadCommand::reading(reply, 0);
+	float siValue = 0;
+	std::memcpy(&siValue, si.constData(), sizeof(siValue));
+	ASSERT_FLOAT_EQ(1.0f, siValue);
+
+	ASSERT_EQ(42, Ev3BatchedReadCommand::reading(reply, 1)[0]);
+	ASSERT_EQ(static_cast<char>(255), Ev3BatchedReadCommand::reading(reply, 2)[0]);
+
+	const QByteArray raw = Ev3BatchedReadCommand::reading(reply, 3);
+	ASSERT_EQ(-1000, qFromLittleEndian<qint32>(reinterpret_cast<const uchar *>(raw.constData())));
+}
+
+TEST_F(Ev3BatchedReadCommandTest, fullCommandRejectsReadings)
+{
+	const int maxReadings = Ev3BatchedReadCommand::maxReadings;
+	Ev3BatchedReadCommand command;
+	for (int i = 0; i < maxReadings; ++i) {
+		ASSERT_EQ(i, command.add(i % 4, Ev3BatchedReadCommand::Format::percent, 0));
+	}
+
+	ASSERT_TRUE(command.isFull());
+	ASSERT_EQ(-1, command.add(0, Ev3BatchedReadCommand::Format::percent, 0));
+
+	const QByteArray reply = roundTrip(command.command(), command.responseSize());
+	ASSERT_EQ(maxReadings, mBrick.readingsCount());
+	ASSERT_EQ(static_cast<char>(255), Ev3BatchedReadCommand::reading(reply, maxReadings - 2)[0]);
+}
+
+TEST_F(Ev3BatchedReadCommandTest, brokenReplyGivesNoReading)
+{
+	Ev3BatchedReadCommand command;
+	command.add(0, Ev3BatchedReadCommand::Format::si, 0);
+	command.add(1, Ev3BatchedReadCommand::Format::si, 0);
+
+	const QByteArray reply = roundTrip(command.command(), command.responseSize());
+	ASSERT_FALSE(Ev3BatchedReadCommand::reading(reply, 1).isEmpty());
+	ASSERT_TRUE(Ev3BatchedReadCommand::reading(reply.left(reply.size() - 1), 1).isEmpty());
+	ASSERT_TRUE(Ev3BatchedReadCommand::reading(reply, 2).isEmpty());
+
+	mBrick.disconnect();
+	ASSERT_TRUE(Ev3BatchedReadCommand::reading(roundTrip(command.command(), command.responseSize()), 0).isEmpty());
+}
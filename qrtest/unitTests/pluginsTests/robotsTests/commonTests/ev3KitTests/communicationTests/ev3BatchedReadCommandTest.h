@@ -0,0 +1,39 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <ev3Kit/communication/ev3LoopbackCommunicationThread.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace ev3KitTests {
+
+class Ev3BatchedReadCommandTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Sends the command to loopback brick and returns the reply.
+	QByteArray roundTrip(const QByteArray &command, int responseSize);
+
+	ev3::communication::Ev3LoopbackCommunicationThread mBrick;
+};
+
+}
+}
+}
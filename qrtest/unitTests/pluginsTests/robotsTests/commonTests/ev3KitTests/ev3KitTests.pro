@@ -0,0 +1,30 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = robots_ev3Kit_unittests
+
+include(../../../../common.pri)
+
+include(../../../../../../plugins/robots/common/ev3Kit/ev3Kit.pri)
+
+INCLUDEPATH += \
+	../../../../../../plugins/robots/common/ev3Kit \
+	../../../../../../plugins/robots/common/ev3Kit/include \
+
+# Tests
+HEADERS += \
+	communicationTests/ev3BatchedReadCommandTest.h \
+
+SOURCES += \
+	communicationTests/ev3BatchedReadCommandTest.cpp \
@@ -0,0 +1,129 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "i2cCommunicatorTest.h"
+
+#include <QtCore/QElapsedTimer>
+
+#include <testUtils/wait.h>
+#include <nxtKit/communication/nxtCommandConstants.h>
+
+using namespace qrTest::robotsTests::nxtKitTests;
+using namespace nxt::communication;
+using namespace kitBase::robotModel;
+
+/// Time the emulated sensor needs to prepare its answer.
+static const int sensorDelay = 100;
+
+void I2CCommunicatorTest::SetUp()
+{
+	mBrick.reset(new NxtLoopbackCommunicationThread());
+	mBrick->setI2CResponse(0, QByteArray("\x01\x2a", 2), sensorDelay);
+	mBrick->setI2CResponse(1, QByteArray("\x02", 1), sensorDelay);
+
+	mCommunicator.reset(new utils::robotCommunication::RobotCommunicator());
+	mCommunicator->setRobotCommunicationThreadObject(mBrick);
+	QObject::connect(mCommunicator.data(), &utils::robotCommunication::RobotCommunicator::response
+			, [this](QObject *addressee, const QByteArray &reading) {
+				mResponses << qMakePair(addressee, reading);
+			});
+
+	mI2C.reset(new I2CCommunicator(*mCommunicator));
+}
+
+void I2CCommunicatorTest::waitForResponses(int count, int timeout)
+{
+	QElapsedTimer timer;
+	timer.start();
+	while (mResponses.size() < count && !timer.hasExpired(timeout)) {
+		qrTest::Wait::wait(1);
+	}
+}
+
+TEST_F(I2CCommunicatorTest, responseArrivesWhenBytesAreReady)
+{
+	mI2C->sendI2C(&mFirstSensor, QByteArray("\x02\x42", 2), 2, PortInfo("1", input));
+	ASSERT_TRUE(mResponses.isEmpty());
+	ASSERT_EQ(1, mI2C->pendingTransactions());
+
+	waitForResponses(1, 10 * sensorDelay);
+	ASSERT_EQ(1, mResponses.size());
+	ASSERT_EQ(&mFirstSensor, mResponses[0].first);
+	ASSERT_EQ(2, mResponses[0].second[0]);
+	ASSERT_EQ(0x2a, mResponses[0].second[2]);
+	ASSERT_EQ(0, mI2C->pendingTransactions());
+
+	// One write, status polls until the sensor has its bytes ready, then a single read.
+	const QList<int> commands = mBrick->receivedCommands();
+	const int statusPolls = commands.count(enums::commandCode::LSGETSTATUS);
+	ASSERT_GE(statusPolls, 1);
+	ASSERT_EQ(2 + statusPolls, commands.size());
+	ASSERT_EQ(static_cast<int>(enums::commandCode::LSWRITE), commands.first());
+	ASSERT_EQ(static_cast<int>(enums::commandCode::LSREAD), commands.last());
+}
+
+TEST_F(I2CCommunicatorTest, transactionsOnDifferentPortsOverlap)
+{
+	mI2C->sendI2C(&mFirstSensor, QByteArray("\x02\x42", 2), 2, PortInfo("1", input));
+	mI2C->sendI2C(&mSecondSensor, QByteArray("\x02\x42", 2), 1, PortInfo("2", input));
+
+	waitForResponses(2, 10 * sensorDelay);
+	ASSERT_EQ(2, mResponses.size());
+	ASSERT_EQ(0x02, mResponses[0].first == &mSecondSensor
+			? mResponses[0].second[1]
+			: mResponses[1].second[1]);
+
+	// The second sensor is asked before the first one is read, so their delays overlap.
+	const QList<int> commands = mBrick->receivedCommands();
+	ASSERT_EQ(2, commands.count(enums::commandCode::LSWRITE));
+	ASSERT_EQ(2, commands.count(enums::commandCode::LSREAD));
+	ASSERT_LT(commands.lastIndexOf(enums::commandCode::LSWRITE), commands.indexOf(enums::commandCode::LSREAD));
+}
+
+TEST_F(I2CCommunicatorTest, transactionsOnOnePortAreQueued)
+{
+	mI2C->sendI2C(&mFirstSensor, QByteArray("\x02\x41", 2), 0, PortInfo("1", input));
+	mI2C->sendI2C(&mSecondSensor, QByteArray("\x02\x42", 2), 2, PortInfo("1", input));
+	ASSERT_EQ(2, mI2C->pendingTransactions());
+
+	waitForResponses(2, 10 * sensorDelay);
+	ASSERT_EQ(2, mResponses.size());
+	ASSERT_EQ(&mFirstSensor, mResponses[0].first);
+	ASSERT_EQ(QByteArray(1, 0), mResponses[0].second);
+	ASSERT_EQ(&mSecondSensor, mResponses[1].first);
+
+	const QList<int> commands = mBrick->receivedCommands();
+	ASSERT_EQ(2, commands.count(enums::commandCode::LSWRITE));
+	ASSERT_EQ(1, commands.count(enums::commandCode::LSREAD));
+}
+
+TEST_F(I2CCommunicatorTest, directCommandsAreNotBlockedByPendingTransaction)
+{
+	mI2C->sendI2C(&mFirstSensor, QByteArray("\x02\x42", 2), 2, PortInfo("1", input));
+
+	QByteArray command(4, 0);
+	command[0] = 0x02;
+	command[2] = enums::telegramType::directCommandResponseRequired;
+	command[3] = enums::commandCode::KEEPALIVE;
+	QByteArray reply;
+	mCommunicator->send(command, 7, reply);
+	ASSERT_FALSE(reply.isEmpty());
+	ASSERT_TRUE(mResponses.isEmpty());
+
+	waitForResponses(1, 10 * sensorDelay);
+	const QList<int> commands = mBrick->receivedCommands();
+	ASSERT_EQ(1, mResponses.size());
+	ASSERT_LT(commands.indexOf(enums::commandCode::KEEPALIVE), commands.indexOf(enums::commandCode::LSREAD));
+}
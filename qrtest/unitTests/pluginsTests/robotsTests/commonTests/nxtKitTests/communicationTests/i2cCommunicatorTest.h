@@ -0,0 +1,50 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+#include <nxtKit/communication/i2cCommunicator.h>
+#include <nxtKit/communication/nxtLoopbackCommunicationThread.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace nxtKitTests {
+
+class I2CCommunicatorTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	/// Processes events until the given number of responses is received or the timeout passes.
+	void waitForResponses(int count, int timeout);
+
+	QSharedPointer<nxt::communication::NxtLoopbackCommunicationThread> mBrick;
+	QScopedPointer<utils::robotCommunication::RobotCommunicator> mCommunicator;
+	QScopedPointer<nxt::communication::I2CCommunicator> mI2C;
+
+	/// Responses received so far, in order of arrival.
+	QList<QPair<QObject *, QByteArray>> mResponses;
+
+	QObject mFirstSensor;
+	QObject mSecondSensor;
+};
+
+}
+}
+}
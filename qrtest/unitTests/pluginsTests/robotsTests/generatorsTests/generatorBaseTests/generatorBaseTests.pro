@@ -0,0 +1,53 @@
+# Copyright 2026 CyberTech Labs Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+TARGET = robots_generator_base_unittests
+
+include(../../../../common.pri)
+
+links(robots-generator-base)
+
+includes(plugins/robots/generators/generatorBase)
+
+# Structurizator is not exported from the library, so it is built right into tests
+STRUCTURIZATOR_DIR = $$PWD/../../../../../../plugins/robots/generators/generatorBase/src
+
+HEADERS += \
+	$$STRUCTURIZATOR_DIR/structurizator.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/intermediateStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/simpleStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/breakStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/ifStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/structurizatorNodeWithBreaks.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/switchStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/blockStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/whileStructurizatorNode.h \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/selfLoopStructurizatorNode.h \
+
+SOURCES += \
+	$$STRUCTURIZATOR_DIR/structurizator.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/intermediateStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/simpleStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/breakStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/ifStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/structurizatorNodeWithBreaks.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/switchStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/blockStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/whileStructurizatorNode.cpp \
+	$$STRUCTURIZATOR_DIR/structurizatorNodes/selfLoopStructurizatorNode.cpp \
+
+# Tests
+SOURCES += \
+	$$PWD/outputBuilderTest.cpp \
+	$$PWD/structurizatorTest.cpp \
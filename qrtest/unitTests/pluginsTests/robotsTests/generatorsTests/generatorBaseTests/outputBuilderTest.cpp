@@ -0,0 +1,52 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <generatorBase/outputBuilder.h>
+
+#include "gtest/gtest.h"
+
+using namespace generatorBase;
+
+TEST(OutputBuilderTest, placeholdersTakeIndentationOfTheirLines)
+{
+	OutputBuilder builder;
+	builder.setPlaceholder("@@MAIN_CODE@@", "a();\n\nb();");
+	builder.setPlaceholder("@@VARIABLES@@", "int x;\n\nint y;");
+	builder.setPlaceholder("@@UNUSED@@", "c();");
+
+	const QString code = builder.expand("@@VARIABLES@@\nvoid main()\n{\n\t@@MAIN_CODE@@\n}\nx = @@MAIN_CODE@@;");
+
+	EXPECT_EQ("int x;\n\nint y;\nvoid main()\n{\n\ta();\n\tb();\n}\nx = @@MAIN_CODE@@;", code);
+}
+
+TEST(OutputBuilderTest, insertedTextsAreNotExpandedAgain)
+{
+	OutputBuilder builder;
+	builder.setPlaceholder("@@MAIN_CODE@@", "@@VARIABLES@@");
+	builder.setPlaceholder("@@VARIABLES@@", "int x;");
+
+	EXPECT_EQ("@@VARIABLES@@\nint x;", builder.expand("@@MAIN_CODE@@\n@@VARIABLES@@"));
+}
+
+TEST(OutputBuilderTest, finishCollapsesEmptyLinesAndCollectsLinkingInfo)
+{
+	const QString open = "@~qrm:/RobotsMetamodel/RobotsDiagram/Block/{1-2}~@";
+	const QString close = "@#qrm:/RobotsMetamodel/RobotsDiagram/Block/{1-2}#@";
+	const QString code = "a();\n\n\n\n" + open + "b();\n\nc();" + close + "\n\n\n";
+
+	QString linkingInfo;
+	EXPECT_EQ("a();\n\nb();\n\nc();\n\n", OutputBuilder::finish(code, linkingInfo));
+	EXPECT_EQ("qrm:/RobotsMetamodel/RobotsDiagram/Block/{1-2}@3@5\n", linkingInfo);
+}
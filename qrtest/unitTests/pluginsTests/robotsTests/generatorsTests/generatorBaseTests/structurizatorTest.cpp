@@ -0,0 +1,184 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include <src/structurizator.h>
+#include <src/structurizatorNodes/blockStructurizatorNode.h>
+#include <src/structurizatorNodes/ifStructurizatorNode.h>
+#include <src/structurizatorNodes/selfLoopStructurizatorNode.h>
+#include <src/structurizatorNodes/simpleStructurizatorNode.h>
+#include <src/structurizatorNodes/structurizatorNodeWithBreaks.h>
+#include <src/structurizatorNodes/switchStructurizatorNode.h>
+#include <src/structurizatorNodes/whileStructurizatorNode.h>
+
+#include "gtest/gtest.h"
+
+using namespace generatorBase;
+
+namespace {
+
+qReal::Id idOf(int vertex)
+{
+	return qReal::Id("RobotsMetamodel", "RobotsDiagram", "Block", QString::number(vertex));
+}
+
+/// Structurizes graph with vertices 1..verticesNumber starting from vertex 1, nodes are owned by \a structurizator.
+IntermediateStructurizatorNode *structurize(Structurizator &structurizator, int verticesNumber
+		, const QMap<int, QSet<int>> &followers)
+{
+	QSet<qReal::Id> ids;
+	QMap<qReal::Id, int> vertexNumber;
+	for (int v = 1; v <= verticesNumber; ++v) {
+		ids.insert(idOf(v));
+		vertexNumber[idOf(v)] = v;
+	}
+
+	return structurizator.performStructurization(ids, 1, followers, vertexNumber, verticesNumber);
+}
+
+/// Returns id of a simple node and null id for any other node.
+qReal::Id simpleId(IntermediateStructurizatorNode *node)
+{
+	return node && node->type() == IntermediateStructurizatorNode::simple
+			? static_cast<SimpleStructurizatorNode *>(node)->id()
+			: qReal::Id();
+}
+
+}
+
+TEST(StructurizatorTest, sequenceBecomesNestedBlocks)
+{
+	Structurizator structurizator;
+	IntermediateStructurizatorNode * const tree = structurize(structurizator, 3, {{1, {2}}, {2, {3}}});
+
+	ASSERT_NE(nullptr, tree);
+	ASSERT_EQ(IntermediateStructurizatorNode::block, tree->type());
+	const auto outer = static_cast<BlockStructurizatorNode *>(tree);
+	EXPECT_EQ(idOf(1), simpleId(outer->firstNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::block, outer->secondNode()->type());
+	const auto inner = static_cast<BlockStructurizatorNode *>(outer->secondNode());
+	EXPECT_EQ(idOf(2), simpleId(inner->firstNode()));
+	EXPECT_EQ(idOf(3), simpleId(inner->secondNode()));
+}
+
+TEST(StructurizatorTest, ifThenElseIsFollowedByItsExit)
+{
+	Structurizator structurizator;
+	IntermediateStructurizatorNode * const tree = structurize(structurizator, 4
+			, {{1, {2, 3}}, {2, {4}}, {3, {4}}});
+
+	ASSERT_NE(nullptr, tree);
+	ASSERT_EQ(IntermediateStructurizatorNode::block, tree->type());
+	const auto block = static_cast<BlockStructurizatorNode *>(tree);
+	EXPECT_EQ(idOf(4), simpleId(block->secondNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::ifThenElseCondition, block->firstNode()->type());
+	const auto ifNode = static_cast<IfStructurizatorNode *>(block->firstNode());
+	EXPECT_EQ(idOf(1), simpleId(ifNode->condition()));
+	EXPECT_EQ(idOf(4), simpleId(ifNode->exit()));
+	ASSERT_NE(nullptr, ifNode->elseBranch());
+	const QSet<qReal::Id> branches = {simpleId(ifNode->thenBranch()), simpleId(ifNode->elseBranch())};
+	EXPECT_EQ(QSet<qReal::Id>({idOf(2), idOf(3)}), branches);
+}
+
+TEST(StructurizatorTest, switchCollectsAllBranches)
+{
+	Structurizator structurizator;
+	IntermediateStructurizatorNode * const tree = structurize(structurizator, 5
+			, {{1, {2, 3, 4}}, {2, {5}}, {3, {5}}, {4, {5}}});
+
+	ASSERT_NE(nullptr, tree);
+	ASSERT_EQ(IntermediateStructurizatorNode::block, tree->type());
+	const auto block = static_cast<BlockStructurizatorNode *>(tree);
+	EXPECT_EQ(idOf(5), simpleId(block->secondNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::switchCondition, block->firstNode()->type());
+	const auto switchNode = static_cast<SwitchStructurizatorNode *>(block->firstNode());
+	EXPECT_EQ(idOf(1), simpleId(switchNode->condition()));
+	EXPECT_EQ(idOf(5), simpleId(switchNode->exit()));
+	QSet<qReal::Id> branches;
+	for (IntermediateStructurizatorNode * const branch : switchNode->branches()) {
+		branches.insert(simpleId(branch));
+	}
+
+	EXPECT_EQ(QSet<qReal::Id>({idOf(2), idOf(3), idOf(4)}), branches);
+}
+
+TEST(StructurizatorTest, whileLoopKeepsHeadBodyAndExit)
+{
+	Structurizator structurizator;
+	IntermediateStructurizatorNode * const tree = structurize(structurizator, 4
+			, {{1, {2}}, {2, {3, 4}}, {3, {2}}});
+
+	ASSERT_NE(nullptr, tree);
+	ASSERT_EQ(IntermediateStructurizatorNode::block, tree->type());
+	const auto outer = static_cast<BlockStructurizatorNode *>(tree);
+	EXPECT_EQ(idOf(1), simpleId(outer->firstNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::block, outer->secondNode()->type());
+	const auto inner = static_cast<BlockStructurizatorNode *>(outer->secondNode());
+	EXPECT_EQ(idOf(4), simpleId(inner->secondNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::whileloop, inner->firstNode()->type());
+	const auto whileNode = static_cast<WhileStructurizatorNode *>(inner->firstNode());
+	EXPECT_EQ(idOf(2), simpleId(whileNode->headNode()));
+	EXPECT_EQ(idOf(3), simpleId(whileNode->bodyNode()));
+	EXPECT_EQ(idOf(4), simpleId(whileNode->exitNode()));
+}
+
+TEST(StructurizatorTest, nestedLoopsWithBreaks)
+{
+	// 2 heads the outer loop, 3 heads the inner one, 4 either repeats the inner loop or breaks it,
+	// 5 either repeats the outer loop or breaks it, going to 6.
+	Structurizator structurizator;
+	IntermediateStructurizatorNode * const tree = structurize(structurizator, 6
+			, {{1, {2}}, {2, {3}}, {3, {4}}, {4, {3, 5}}, {5, {2, 6}}});
+
+	ASSERT_NE(nullptr, tree);
+	ASSERT_EQ(IntermediateStructurizatorNode::block, tree->type());
+	const auto program = static_cast<BlockStructurizatorNode *>(tree);
+	EXPECT_EQ(idOf(1), simpleId(program->firstNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::infiniteloop, program->secondNode()->type());
+	IntermediateStructurizatorNode * const outerBody
+			= static_cast<SelfLoopStructurizatorNode *>(program->secondNode())->bodyNode();
+	ASSERT_EQ(IntermediateStructurizatorNode::block, outerBody->type());
+	const auto outerBlock = static_cast<BlockStructurizatorNode *>(outerBody);
+
+	// Outer loop body: 2, then the inner loop, then condition 5 breaking the outer loop.
+	ASSERT_EQ(IntermediateStructurizatorNode::block, outerBlock->firstNode()->type());
+	const auto beforeBreak = static_cast<BlockStructurizatorNode *>(outerBlock->firstNode());
+	EXPECT_EQ(idOf(2), simpleId(beforeBreak->firstNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::whileloop, beforeBreak->secondNode()->type());
+	const auto innerLoop = static_cast<WhileStructurizatorNode *>(beforeBreak->secondNode());
+	EXPECT_EQ(idOf(3), simpleId(innerLoop->headNode()));
+	EXPECT_EQ(idOf(5), simpleId(innerLoop->exitNode()));
+
+	ASSERT_EQ(IntermediateStructurizatorNode::nodeWithBreaks, innerLoop->bodyNode()->type());
+	const auto innerBreak = static_cast<StructurizatorNodeWithBreaks *>(innerLoop->bodyNode());
+	EXPECT_EQ(idOf(4), simpleId(innerBreak->condition()));
+	ASSERT_EQ(1, innerBreak->exitBranches().size());
+	EXPECT_EQ(IntermediateStructurizatorNode::breakNode, innerBreak->exitBranches().first()->type());
+	EXPECT_EQ(idOf(5), innerBreak->exitBranches().first()->firstId());
+
+	ASSERT_EQ(IntermediateStructurizatorNode::nodeWithBreaks, outerBlock->secondNode()->type());
+	const auto outerBreak = static_cast<StructurizatorNodeWithBreaks *>(outerBlock->secondNode());
+	EXPECT_EQ(idOf(5), simpleId(outerBreak->condition()));
+	ASSERT_EQ(1, outerBreak->exitBranches().size());
+	ASSERT_EQ(IntermediateStructurizatorNode::block, outerBreak->exitBranches().first()->type());
+	const auto afterLoops = static_cast<BlockStructurizatorNode *>(outerBreak->exitBranches().first());
+	EXPECT_EQ(idOf(6), simpleId(afterLoops->firstNode()));
+	EXPECT_EQ(IntermediateStructurizatorNode::breakNode, afterLoops->secondNode()->type());
+}
@@ -0,0 +1,91 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "sensorVariablesUpdaterTest.h"
+
+#include "interpreterCore/interpreter/details/sensorVariablesUpdater.h"
+
+using namespace qrTest::robotsTests::interpreterCoreTests::detailsTests;
+
+using namespace interpreterCore::interpreter::details;
+using namespace kitBase::robotModel;
+using namespace testing;
+
+void SensorVariablesUpdaterTest::SetUp()
+{
+	const DeviceInfo touchSensor = DeviceInfo::create<robotParts::TouchSensor>();
+	mReferencedSensor.reset(new robotParts::TouchSensor(touchSensor, mReferencedPort));
+	mUnreferencedSensor.reset(new robotParts::TouchSensor(touchSensor, mUnreferencedPort));
+
+	ON_CALL(mConfiguration, devices()).WillByDefault(Return(QList<robotParts::Device *>()
+			<< mReferencedSensor.data() << mUnreferencedSensor.data()));
+
+	ON_CALL(mModel, configuration()).WillByDefault(ReturnRef(mConfiguration));
+	ON_CALL(mModel, timeline()).WillByDefault(ReturnRef(mTimeline));
+	ON_CALL(mModel, updateIntervalForInterpretation()).WillByDefault(Return(10));
+	ON_CALL(mModelManager, model()).WillByDefault(ReturnRef(mModel));
+
+	// The program mentions only the first sensor.
+	mRepoApi.reset(new qrRepo::RepoApi("sensorVariablesUpdaterTest.qrs", true));
+	const qReal::Id block("RobotsMetamodel", "RobotsDiagram", "Function", "block");
+	mRepoApi->addChild(qReal::Id::rootId(), block);
+	mRepoApi->setProperty(block, "Body", "x = sensor1 + 1");
+
+	ON_CALL(mLogicalModelApi, logicalRepoApi()).WillByDefault(ReturnRef(*mRepoApi));
+}
+
+void SensorVariablesUpdaterTest::TearDown()
+{
+	mRepoApi.reset();
+}
+
+QList<QList<PortInfo>> SensorVariablesUpdaterTest::poll(const qReal::LogicalModelAssistInterface *program
+		, int ticks)
+{
+	QList<QList<PortInfo>> polls;
+	ON_CALL(mModel, updateSensorsValuesOn(_)).WillByDefault(Invoke([&polls](const QList<PortInfo> &ports) {
+		polls << ports;
+	}));
+
+	SensorVariablesUpdater updater(mModelManager, mParser, program);
+	updater.run();
+	for (int i = 0; i < ticks; ++i) {
+		mTimeline.tick();
+	}
+
+	updater.suspend();
+	return polls;
+}
+
+TEST_F(SensorVariablesUpdaterTest, referencedSensorsArePolledEveryTick)
+{
+	const QList<QList<PortInfo>> polls = poll(&mLogicalModelApi, 20);
+
+	ASSERT_EQ(21, polls.size());
+	for (int i = 0; i < polls.size(); ++i) {
+		EXPECT_TRUE(polls[i].contains(mReferencedPort)) << "poll " << i;
+		EXPECT_EQ(i % 10 == 0, polls[i].contains(mUnreferencedPort)) << "poll " << i;
+	}
+}
+
+TEST_F(SensorVariablesUpdaterTest, allSensorsArePolledEveryTickWithoutProgram)
+{
+	const QList<QList<PortInfo>> polls = poll(nullptr, 20);
+
+	ASSERT_EQ(21, polls.size());
+	for (int i = 0; i < polls.size(); ++i) {
+		EXPECT_TRUE(polls[i].contains(mReferencedPort)) << "poll " << i;
+		EXPECT_TRUE(polls[i].contains(mUnreferencedPort)) << "poll " << i;
+	}
+}
@@ -0,0 +1,65 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+#include <qrrepo/repoApi.h>
+#include <qrtext/lua/luaToolbox.h>
+#include <kitBase/robotModel/robotModelInterfaceMock.h>
+#include <kitBase/robotModel/robotModelManagerInterfaceMock.h>
+#include <kitBase/robotModel/configurationInterfaceMock.h>
+#include <kitBase/robotModel/robotParts/touchSensor.h>
+
+#include "mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterfaceMock.h"
+#include "support/manualTimeline.h"
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+namespace detailsTests {
+
+class SensorVariablesUpdaterTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+	void TearDown() override;
+
+	/// Runs updater over given program for given number of updating intervals.
+	/// @returns ports passed to the robot model on each poll, starting from the one made on start.
+	QList<QList<kitBase::robotModel::PortInfo>> poll(const qReal::LogicalModelAssistInterface *program, int ticks);
+
+	const kitBase::robotModel::PortInfo mReferencedPort = kitBase::robotModel::PortInfo(
+			"1", kitBase::robotModel::input, {}, "sensor1");
+	const kitBase::robotModel::PortInfo mUnreferencedPort = kitBase::robotModel::PortInfo(
+			"2", kitBase::robotModel::input, {}, "sensor2");
+
+	ManualTimeline mTimeline;
+	RobotModelInterfaceMock mModel;
+	RobotModelManagerInterfaceMock mModelManager;
+	ConfigurationInterfaceMock mConfiguration;
+	LogicalModelAssistInterfaceMock mLogicalModelApi;
+	qrtext::lua::LuaToolbox mParser;
+	QScopedPointer<qrRepo::RepoApi> mRepoApi;
+	QScopedPointer<kitBase::robotModel::robotParts::TouchSensor> mReferencedSensor;
+	QScopedPointer<kitBase::robotModel::robotParts::TouchSensor> mUnreferencedSensor;
+};
+
+}
+}
+}
+}
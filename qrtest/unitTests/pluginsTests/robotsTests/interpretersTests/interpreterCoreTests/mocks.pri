@@ -15,6 +15,7 @@
 HEADERS += \
 	$$PWD/../../../../mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterfaceMock.h \
 	$$PWD/../../../../mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowDockInterfaceMock.h \
+	$$PWD/../../../../mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterfaceMock.h \
 	$$PWD/../../../../mocks/qrgui/mainWindow/projectManager/projectManagementInterfaceMock.h \
 	$$PWD/../../../../mocks/qrgui/view/sceneCustomizationInterfaceMock.h \
 
@@ -0,0 +1,80 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "manualTimeline.h"
+
+using namespace qrTest::robotsTests::interpreterCoreTests;
+
+bool ManualTimer::isActive() const
+{
+	return mActive;
+}
+
+int ManualTimer::interval() const
+{
+	return mInterval;
+}
+
+void ManualTimer::setInterval(int ms)
+{
+	mInterval = ms;
+}
+
+void ManualTimer::setSingleShot(bool isSingleShot)
+{
+	mSingleShot = isSingleShot;
+}
+
+bool ManualTimer::isSingleShot()
+{
+	return mSingleShot;
+}
+
+void ManualTimer::start()
+{
+	mActive = true;
+}
+
+void ManualTimer::start(int ms)
+{
+	mInterval = ms;
+	start();
+}
+
+void ManualTimer::stop()
+{
+	mActive = false;
+}
+
+quint64 ManualTimeline::timestamp() const
+{
+	return 0;
+}
+
+utils::AbstractTimer *ManualTimeline::produceTimer()
+{
+	mTimer = new ManualTimer;
+	return mTimer;
+}
+
+void ManualTimeline::tick()
+{
+	if (mTimer && mTimer->isActive()) {
+		if (mTimer->isSingleShot()) {
+			mTimer->stop();
+		}
+
+		emit mTimer->timeout();
+	}
+}
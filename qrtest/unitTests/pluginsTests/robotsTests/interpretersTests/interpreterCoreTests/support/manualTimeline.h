@@ -0,0 +1,62 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <utils/abstractTimer.h>
+#include <utils/timelineInterface.h>
+
+namespace qrTest {
+namespace robotsTests {
+namespace interpreterCoreTests {
+
+/// Timer that never fires by itself, timeouts are emitted by ManualTimeline::tick().
+class ManualTimer : public utils::AbstractTimer
+{
+public:
+	bool isActive() const override;
+	int interval() const override;
+	void setInterval(int ms) override;
+	void setSingleShot(bool isSingleShot) override;
+	bool isSingleShot() override;
+
+	void start() override;
+	void start(int ms) override;
+	void stop() override;
+
+private:
+	bool mActive = false;
+	int mInterval = 0;
+	bool mSingleShot = false;
+};
+
+/// Timeline with time frozen at zero, lets a test step timers produced by it explicitly.
+class ManualTimeline : public utils::TimelineInterface
+{
+public:
+	quint64 timestamp() const override;
+
+	/// Produces new timer and remembers it as the one to be stepped by tick().
+	utils::AbstractTimer *produceTimer() override;
+
+	/// Emits timeout of the last produced timer if it is running.
+	void tick();
+
+private:
+	ManualTimer *mTimer = nullptr;  // Does not have ownership.
+};
+
+}
+}
+}
@@ -22,3 +22,4 @@ SUBDIRS = \
 	utilsTests \
 
 generatorsTests.depends = tcpRobotSimulator
+utilsTests.depends = tcpRobotSimulator
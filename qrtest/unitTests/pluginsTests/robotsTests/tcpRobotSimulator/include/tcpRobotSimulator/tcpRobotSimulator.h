@@ -26,7 +26,8 @@ namespace tcpRobotSimulator {
 
 class Connection;
 
-/// TCP server that simulates TRIK robot behavior (at least, as required by run program protocol).
+/// TCP server that simulates TRIK robot behavior (at least, as required by run program protocol and telemetry).
+/// Listens on a loopback interface, so it can be used as a stand-in robot in tests and benchmarks.
 class TCP_ROBOT_SIMULATOR_EXPORT TcpRobotSimulator : public QTcpServer
 {
 	Q_OBJECT
@@ -50,6 +51,9 @@ public:
 	/// Check that server received "version" command.
 	bool versionRequestReceived() const;
 
+	/// Returns how many telemetry requests ("data" or "sensor:<port>") were received by current connection.
+	int telemetryRequestsCount() const;
+
 signals:
 	/// Emitted when "run" command received.
 	void runProgramRequestReceivedSignal();
@@ -17,6 +17,7 @@
 #include <QtNetwork/QTcpSocket>
 #include <QtCore/QTimer>
 #include <QtCore/QThread>
+#include <QtCore/QStringList>
 
 #include <QtCore/QDebug>
 
@@ -25,6 +26,9 @@ static const QString trikRuntimeVersion = "3.1.3";
 static const int keepaliveTime = 3000;
 static const int heartbeatTime = 5000;
 
+/// Ports which values are reported in answer to "data" telemetry request.
+static const QStringList telemetryPorts = { "A1", "A2", "A3", "A4", "A5", "A6", "D1", "D2" };
+
 using namespace tcpRobotSimulator;
 
 Connection::Connection(Protocol connectionProtocol, Heartbeat useHeartbeat, const QString &configVersion)
@@ -265,7 +269,26 @@ void Connection::processData(const QByteArray &data)
 	} else if (command == "configVersion") {
 		mConfigVersionRequestReceived = true;
 		send(("configVersion: " + mConfigVersion).toUtf8());
+	} else if (command == "data" || command.startsWith("sensor:")) {
+		processTelemetryRequest(command);
+	}
+}
+
+void Connection::processTelemetryRequest(const QString &command)
+{
+	const QString value = QString::number(++mTelemetryRequestsCount);
+	if (command.startsWith("sensor:")) {
+		send(QString("%1:%2").arg(command, value).toUtf8());
+		return;
 	}
+
+	QStringList values;
+	for (const QString &port : telemetryPorts) {
+		values << port + ":" + value;
+	}
+
+	values << QString("AccelerometerPort:(0,0,%1)").arg(value);
+	send(("allData:" + values.join(';')).toUtf8());
 }
 
 bool Connection::runProgramRequestReceived() const
@@ -282,3 +305,8 @@ bool Connection::versionRequestReceived() const
 {
 	return mVersionRequestReceived;
 }
+
+int Connection::telemetryRequestsCount() const
+{
+	return mTelemetryRequestsCount.load();
+}
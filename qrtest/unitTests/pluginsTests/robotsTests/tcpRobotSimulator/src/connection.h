@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QPointer>
+#include <QtCore/QAtomicInt>
 #include <QtCore/QObject>
 #include <QtNetwork/QAbstractSocket>
 
@@ -79,6 +80,9 @@ public:
 	/// Check that server received "version" command.
 	bool versionRequestReceived() const;
 
+	/// Returns how many telemetry requests ("data" or "sensor:<port>") were received by this connection.
+	int telemetryRequestsCount() const;
+
 signals:
 	/// Emitted after connection becomes closed.
 	void disconnected();
@@ -116,6 +120,10 @@ private:
 	/// Processes received data.
 	virtual void processData(const QByteArray &data);
 
+	/// Answers telemetry request in the same way as TRIK Runtime telemetry server does. Values of sensors are
+	/// synthetic and equal to the number of telemetry requests received so far.
+	void processTelemetryRequest(const QString &command);
+
 	/// Handles incoming data: sending version or processing received data.
 	void handleIncomingData(const QByteArray &data);
 
@@ -164,6 +172,9 @@ private:
 	/// Boolean flag that becomes true when we receive "version" command.
 	bool mVersionRequestReceived = false;
 
+	/// Number of received telemetry requests.
+	QAtomicInt mTelemetryRequestsCount;
+
 	/// Simulated config version.
 	const QString mConfigVersion;
 };
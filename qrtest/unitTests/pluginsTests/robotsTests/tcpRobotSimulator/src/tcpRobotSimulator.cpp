@@ -65,6 +65,11 @@ bool TcpRobotSimulator::versionRequestReceived() const
 	return mConnection && mConnection->versionRequestReceived();
 }
 
+int TcpRobotSimulator::telemetryRequestsCount() const
+{
+	return mConnection ? mConnection->telemetryRequestsCount() : 0;
+}
+
 void TcpRobotSimulator::setConfigVersion(const QString &configVersion)
 {
 	mConfigVersion = configVersion;
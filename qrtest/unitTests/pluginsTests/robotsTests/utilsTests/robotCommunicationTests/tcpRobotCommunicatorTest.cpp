@@ -0,0 +1,123 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "tcpRobotCommunicatorTest.h"
+
+#include <QtCore/QElapsedTimer>
+
+#include <utils/robotCommunication/tcpRobotCommunicator.h>
+
+#include <testUtils/testRegistry.h>
+#include <testUtils/wait.h>
+#include <tcpRobotSimulator/tcpRobotSimulator.h>
+
+using namespace utils::robotCommunication;
+using namespace qrTest;
+using namespace qrTest::robotsTests::utilsTests;
+
+void TcpRobotCommunicatorTest::SetUp()
+{
+	mControlConnectionSimulator.reset(new tcpRobotSimulator::TcpRobotSimulator(8888));
+	mTelemetryConnectionSimulator.reset(new tcpRobotSimulator::TcpRobotSimulator(9000));
+
+	mTestRegistry.reset(new TestRegistry);
+	mTestRegistry->set("TrikTcpServer", "127.0.0.1");
+
+	mCommunicator.reset(new TcpRobotCommunicator("TrikTcpServer"));
+
+	Wait waiter(3000);
+	waiter.stopAt(mCommunicator.data(), &TcpRobotCommunicator::connected);
+	mCommunicator->connect();
+	waiter.wait();
+}
+
+void TcpRobotCommunicatorTest::TearDown()
+{
+	mCommunicator.reset();
+	mTelemetryConnectionSimulator.reset();
+	mControlConnectionSimulator.reset();
+	mTestRegistry.reset();
+}
+
+TEST_F(TcpRobotCommunicatorTest, sensorRequestIsAnswered)
+{
+	QHash<QString, int> scalarValues;
+	QObject::connect(mCommunicator.data(), &TcpRobotCommunicator::newScalarSensorData
+			, [&scalarValues](const QString &port, int data) { scalarValues[port] = data; });
+
+	Wait waiter(3000);
+	waiter.stopAt(mCommunicator.data(), &TcpRobotCommunicator::newScalarSensorData);
+	mCommunicator->requestData("A1");
+	waiter.wait();
+
+	ASSERT_TRUE(scalarValues.contains("A1"));
+	EXPECT_EQ(1, scalarValues["A1"]);
+	EXPECT_EQ(1, mTelemetryConnectionSimulator->telemetryRequestsCount());
+}
+
+TEST_F(TcpRobotCommunicatorTest, allDataRequestIsAnswered)
+{
+	QHash<QString, int> scalarValues;
+	QVector<int> vectorValue;
+	QObject::connect(mCommunicator.data(), &TcpRobotCommunicator::newScalarSensorData
+			, [&scalarValues](const QString &port, int data) { scalarValues[port] = data; });
+	QObject::connect(mCommunicator.data(), &TcpRobotCommunicator::newVectorSensorData
+			, [&vectorValue](const QString &port, const QVector<int> &data) {
+				Q_UNUSED(port)
+				vectorValue = data;
+			});
+
+	// Vector value is the last one in "allData:" answer.
+	Wait waiter(3000);
+	waiter.stopAt(mCommunicator.data(), &TcpRobotCommunicator::newVectorSensorData);
+	mCommunicator->requestData();
+	waiter.wait();
+
+	EXPECT_TRUE(scalarValues.contains("A1"));
+	EXPECT_TRUE(scalarValues.contains("D1"));
+	EXPECT_EQ(3, vectorValue.size());
+}
+
+TEST_F(TcpRobotCommunicatorTest, pendingTelemetryRequestsAreCoalesced)
+{
+	const int requests = 100;
+	int answers = 0;
+	QObject::connect(mCommunicator.data(), &TcpRobotCommunicator::newScalarSensorData
+			, [&answers](const QString &port, int data) {
+				Q_UNUSED(data)
+				if (port == "A1") {
+					++answers;
+				}
+			});
+
+	for (int i = 0; i < requests; ++i) {
+		mCommunicator->requestData();
+	}
+
+	// Waiting until every request that reached the robot is answered, but not longer than the timeout.
+	QElapsedTimer timer;
+	timer.start();
+	while ((answers == 0 || answers != mTelemetryConnectionSimulator->telemetryRequestsCount())
+			&& !timer.hasExpired(3000))
+	{
+		Wait waiter(50);
+		waiter.stopAt(mCommunicator.data(), &TcpRobotCommunicator::newScalarSensorData);
+		waiter.wait();
+	}
+
+	EXPECT_GT(answers, 0);
+	EXPECT_EQ(answers, mTelemetryConnectionSimulator->telemetryRequestsCount());
+	EXPECT_LT(mTelemetryConnectionSimulator->telemetryRequestsCount(), requests);
+}
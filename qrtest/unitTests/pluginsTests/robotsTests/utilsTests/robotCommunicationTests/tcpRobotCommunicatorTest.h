@@ -0,0 +1,54 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QScopedPointer>
+
+#include <gtest/gtest.h>
+
+namespace tcpRobotSimulator {
+class TcpRobotSimulator;
+}
+
+namespace utils {
+namespace robotCommunication {
+class TcpRobotCommunicator;
+}
+}
+
+namespace qrTest {
+
+class TestRegistry;
+
+namespace robotsTests {
+namespace utilsTests {
+
+/// Tests for telemetry exchange of TcpRobotCommunicator with a loopback robot simulator.
+class TcpRobotCommunicatorTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+	void TearDown() override;
+
+	QScopedPointer<TestRegistry> mTestRegistry;
+	QScopedPointer<tcpRobotSimulator::TcpRobotSimulator> mControlConnectionSimulator;
+	QScopedPointer<tcpRobotSimulator::TcpRobotSimulator> mTelemetryConnectionSimulator;
+	QScopedPointer<utils::robotCommunication::TcpRobotCommunicator> mCommunicator;
+};
+
+}
+}
+}
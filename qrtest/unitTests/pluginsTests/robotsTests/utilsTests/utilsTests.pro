@@ -18,15 +18,20 @@ include(../../../common.pri)
 
 include(../../../../../plugins/robots/utils/utils.pri)
 
-links(test-utils)
+links(test-utils tcp-robot-simulator)
 
 includes(plugins/robots/utils)
 
+INCLUDEPATH += \
+	$$PWD/../tcpRobotSimulator/include \
+
 # Tests
 HEADERS += \
 	$$PWD/circularQueueTest.h \
 	$$PWD/robotCommunicationTests/runProgramProtocolTest.h \
+	$$PWD/robotCommunicationTests/tcpRobotCommunicatorTest.h \
 
 SOURCES += \
 	$$PWD/circularQueueTest.cpp \
 	$$PWD/robotCommunicationTests/runProgramProtocolTest.cpp \
+	$$PWD/robotCommunicationTests/tcpRobotCommunicatorTest.cpp \
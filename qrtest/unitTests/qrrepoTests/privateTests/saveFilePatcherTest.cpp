@@ -0,0 +1,116 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "saveFilePatcherTest.h"
+
+#include <QtCore/QFile>
+
+#include <qrrepo/saveFilePatcher.h>
+#include <qrrepo/private/classes/logicalObject.h>
+
+using namespace qrRepo;
+using namespace details;
+using namespace qReal;
+using namespace qrTest;
+
+void SaveFilePatcherTest::SetUp()
+{
+	mSerializer = new Serializer("saveFile");
+
+	QHash<QString, QVariant> metaInfo;
+	metaInfo["worldModel"] = "<world/>";
+	metaInfo["key1"] = "info1";
+	metaInfo["key2"] = 2;
+
+	LogicalObject object(Id("editor1", "diagram1", "element1", "id1"));
+	object.setProperty("property1", "value1");
+	QList<Object *> objects;
+	objects.push_back(&object);
+	ASSERT_TRUE(mSerializer->saveToDisk(objects, metaInfo));
+}
+
+void SaveFilePatcherTest::TearDown()
+{
+	mSerializer->clearWorkingDir();
+	delete mSerializer;
+
+	QFile::remove("saveFile.qrs");
+}
+
+QHash<QString, QVariant> SaveFilePatcherTest::loadMetaInfo()
+{
+	QHash<Id, Object *> objects;
+	QHash<QString, QVariant> metaInfo;
+	mSerializer->setWorkingFile("saveFile.qrs");
+	mSerializer->loadFromDisk(objects, metaInfo);
+	qDeleteAll(objects);
+	return metaInfo;
+}
+
+TEST_F(SaveFilePatcherTest, readTest)
+{
+	ASSERT_TRUE(Serializer::metaInfoFileKeys().contains("worldModel"));
+	ASSERT_FALSE(Serializer::metaInfoFileKeys().contains("key1"));
+
+	SaveFilePatcher patcher("saveFile.qrs");
+	ASSERT_TRUE(patcher.isValid());
+	EXPECT_EQ(patcher.metaInformation("worldModel").toString(), "<world/>");
+	EXPECT_EQ(patcher.metaInformation("key1").toString(), "info1");
+	EXPECT_EQ(patcher.metaInformation("key2").toInt(), 2);
+	EXPECT_FALSE(patcher.metaInformation("missingKey").isValid());
+}
+
+TEST_F(SaveFilePatcherTest, patchFileKeyTest)
+{
+	SaveFilePatcher patcher("saveFile.qrs");
+	patcher.setMetaInformation("worldModel", "<world><robot/></world>");
+	ASSERT_TRUE(patcher.save());
+
+	const QHash<QString, QVariant> metaInfo = loadMetaInfo();
+	EXPECT_EQ(metaInfo["worldModel"].toString(), "<world><robot/></world>");
+	EXPECT_EQ(metaInfo["key1"].toString(), "info1");
+	EXPECT_EQ(metaInfo["key2"].toInt(), 2);
+}
+
+TEST_F(SaveFilePatcherTest, patchInlineKeyTest)
+{
+	SaveFilePatcher patcher("saveFile.qrs");
+	patcher.setMetaInformation("key1", "patched");
+	patcher.setMetaInformation("key3", 3);
+	ASSERT_TRUE(patcher.save());
+
+	const QHash<QString, QVariant> metaInfo = loadMetaInfo();
+	EXPECT_EQ(metaInfo["key1"].toString(), "patched");
+	EXPECT_EQ(metaInfo["key2"].toInt(), 2);
+	EXPECT_EQ(metaInfo["key3"].toInt(), 3);
+	EXPECT_EQ(metaInfo["worldModel"].toString(), "<world/>");
+}
+
+TEST_F(SaveFilePatcherTest, modelIsPreservedTest)
+{
+	SaveFilePatcher patcher("saveFile.qrs");
+	patcher.setMetaInformation("worldModel", "<world><robot/></world>");
+	patcher.setMetaInformation("key1", "patched");
+	ASSERT_TRUE(patcher.save());
+
+	QHash<Id, Object *> objects;
+	QHash<QString, QVariant> metaInfo;
+	mSerializer->setWorkingFile("saveFile.qrs");
+	mSerializer->loadFromDisk(objects, metaInfo);
+
+	const Id id("editor1", "diagram1", "element1", "id1");
+	ASSERT_TRUE(objects.contains(id));
+	EXPECT_EQ(objects[id]->property("property1").toString(), "value1");
+	qDeleteAll(objects);
+}
@@ -25,6 +25,7 @@ SOURCES += \
 	repoApiTest.cpp \
 	privateTests/folderCompressorTest.cpp \
 	privateTests/serializerTest.cpp \
+	privateTests/saveFilePatcherTest.cpp \
 	privateTests/repositoryTest.cpp \
 	privateTests/classesTests/objectTest.cpp \
 	privateTests/classesTests/graphicalObjectTest.cpp \
@@ -33,4 +34,5 @@ HEADERS += \
 	repoApiTest.h \
 	privateTests/folderCompressorTest.h \
 	privateTests/serializerTest.h \
+	privateTests/saveFilePatcherTest.h \
 	privateTests/repositoryTest.h \
@@ -144,3 +144,103 @@ TEST_F(ExpressionsParserTest, parseErrorTest3) {
 
 	mParser->parseExpression(stream, pos);
 }
+
+TEST_F(ExpressionsParserTest, compiledExpressionTest) {
+	mParser->mutableVariables()["x"] = QSharedPointer<Number>::create(3, Number::intType);
+	QString const stream = "(x + 2) * x - abs(-x) / 2.0";
+	int pos = 0;
+
+	CompiledExpression const expression = mParser->compileExpression(stream, pos);
+	ASSERT_FALSE(mParser->hasErrors());
+	ASSERT_EQ(expression.variables(), QStringList{"x"});
+
+	CompiledExpression::Value x(3);
+	EXPECT_EQ(expression.evaluate(&x).toDouble(), 13.5);
+
+	x = CompiledExpression::Value(4);
+	EXPECT_EQ(expression.evaluate(&x).toDouble(), 22.0);
+
+	mParser->mutableVariables()["x"]->setValue(5);
+	EXPECT_EQ(mParser->evaluate(expression)->value().toDouble(), 32.5);
+}
+
+TEST_F(ExpressionsParserTest, compiledExpressionDivisionByZeroTest) {
+	EXPECT_CALL(*mErrorReporter, addCritical(_, _)).Times(Exactly(1));
+
+	QString const stream = "7 / (2 - 2)";
+	int pos = 0;
+
+	CompiledExpression const expression = mParser->compileExpression(stream, pos);
+	EXPECT_FALSE(mParser->hasErrors());
+	EXPECT_EQ(mParser->evaluate(expression)->value().toInt(), 7);
+}
+
+TEST_F(ExpressionsParserTest, reparsedExpressionUsesCurrentVariablesTest) {
+	QString const program = "x = x + 1;";
+	mParser->mutableVariables()["x"] = QSharedPointer<Number>::create(0, Number::intType);
+
+	for (int i = 0; i < 3; ++i) {
+		int pos = 0;
+		mParser->parseProcess(program, pos, qReal::Id::rootId());
+		ASSERT_FALSE(mParser->hasErrors());
+		EXPECT_EQ(pos, program.length());
+	}
+
+	EXPECT_EQ(mParser->variables()["x"]->value().toInt(), 3);
+
+	QString const stream = "x * 2";
+	int pos = 0;
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 6);
+	mParser->mutableVariables()["x"]->setValue(10);
+	pos = 0;
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 20);
+	EXPECT_EQ(pos, stream.length());
+}
+
+TEST_F(ExpressionsParserTest, removedVariableIsReportedAfterReparseTest) {
+	EXPECT_CALL(*mErrorReporter, addCritical(_, _)).Times(Exactly(1));
+
+	QString const stream = "y + 1";
+	mParser->mutableVariables()["y"] = QSharedPointer<Number>::create(1, Number::intType);
+	int pos = 0;
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 2);
+
+	mParser->mutableVariables().remove("y");
+	pos = 0;
+	mParser->parseExpression(stream, pos);
+	EXPECT_TRUE(mParser->hasErrors());
+}
+
+TEST_F(ExpressionsParserTest, divisionByZeroStopsParsingTest) {
+	EXPECT_CALL(*mErrorReporter, addCritical(_, _)).Times(Exactly(1));
+
+	QString const stream = "7/(2-2) + 5";
+	int pos = 0;
+
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 7);
+	EXPECT_TRUE(mParser->hasErrors());
+}
+
+TEST_F(ExpressionsParserTest, divisionByZeroHidesFollowingErrorsTest) {
+	EXPECT_CALL(*mErrorReporter, addCritical(_, _)).Times(Exactly(1));
+
+	QString const stream = "7/0 + z";
+	int pos = 0;
+
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 7);
+}
+
+TEST_F(ExpressionsParserTest, divisionByZeroInReparsedExpressionTest) {
+	EXPECT_CALL(*mErrorReporter, addCritical(_, _)).Times(Exactly(1));
+
+	QString const stream = "10 / x + 5";
+	mParser->mutableVariables()["x"] = QSharedPointer<Number>::create(2, Number::intType);
+	int pos = 0;
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 10);
+
+	// Changing the value without mutableVariables(), which would drop compiled expressions.
+	mParser->variables().value("x")->setValue(0);
+	pos = 0;
+	EXPECT_EQ(mParser->parseExpression(stream, pos)->value().toInt(), 10);
+	EXPECT_TRUE(mParser->hasErrors());
+}
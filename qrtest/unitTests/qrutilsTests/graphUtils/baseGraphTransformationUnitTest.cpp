@@ -0,0 +1,154 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#include "baseGraphTransformationUnitTest.h"
+
+using namespace qrTest;
+using namespace qReal;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+/// Rule editor differs from the model one the same way as in visual interpreter.
+const QString ruleEditor = "TestDiagramSemanticsMetamodel";
+const QString modelEditor = "TestEditor";
+const QString diagram = "TestDiagram";
+
+MatchingUnit::MatchingUnit(LogicalModelAssistInterface &logicalModelApi
+		, GraphicalModelAssistInterface &graphicalModelApi
+		, gui::MainWindowInterpretersInterface &interpretersInterface
+		, const Id &startElement
+		, const IdList &modelElements)
+	: BaseGraphTransformationUnit(logicalModelApi, graphicalModelApi, interpretersInterface)
+	, mStartElement(startElement)
+	, mModelElements(modelElements)
+{
+}
+
+bool MatchingUnit::findMatch()
+{
+	return checkRuleMatching(mModelElements);
+}
+
+Id MatchingUnit::startElement() const
+{
+	return mStartElement;
+}
+
+void BaseGraphTransformationUnitTest::SetUp()
+{
+	mRepoApi = new qrRepo::RepoApi("graphTransformationTest.qrs", true);
+
+	ON_CALL(mLogicalModelApi, logicalRepoApi()).WillByDefault(ReturnRef(*mRepoApi));
+	ON_CALL(mLogicalModelApi, mutableLogicalRepoApi()).WillByDefault(ReturnRef(*mRepoApi));
+	ON_CALL(mLogicalModelApi, isLogicalId(_)).WillByDefault(Invoke(
+			[this](const Id &id) { return mRepoApi->exist(id); }));
+
+	ON_CALL(mGraphicalModelApi, graphicalRepoApi()).WillByDefault(ReturnRef(*mRepoApi));
+	ON_CALL(mGraphicalModelApi, mutableGraphicalRepoApi()).WillByDefault(ReturnRef(*mRepoApi));
+	ON_CALL(mGraphicalModelApi, isGraphicalId(_)).WillByDefault(Invoke(
+			[this](const Id &id) { return mRepoApi->exist(id); }));
+	ON_CALL(mGraphicalModelApi, logicalId(_)).WillByDefault(Invoke([](const Id &id) { return id; }));
+	ON_CALL(mGraphicalModelApi, graphicalIdsByLogicalId(_)).WillByDefault(Invoke(
+			[this](const Id &id) { return mRepoApi->exist(id) ? IdList{id} : IdList(); }));
+
+	ON_CALL(mInterpretersInterface, errorReporter()).WillByDefault(Return(&mErrorReporter));
+}
+
+void BaseGraphTransformationUnitTest::TearDown()
+{
+	delete mRepoApi;
+}
+
+Id BaseGraphTransformationUnitTest::addNode(const Id &id)
+{
+	mRepoApi->addChild(Id::rootId(), id);
+	return id;
+}
+
+Id BaseGraphTransformationUnitTest::addLink(const Id &id, const Id &from, const Id &to)
+{
+	mRepoApi->addChild(Id::rootId(), id);
+	mRepoApi->setFrom(id, from);
+	mRepoApi->setTo(id, to);
+	return id;
+}
+
+TEST_F(BaseGraphTransformationUnitTest, matchSetTest)
+{
+	// Rule: a -flow-> b -exit-> c.
+	const Id ruleA = addNode(Id(ruleEditor, diagram, "Block", "ruleA"));
+	const Id ruleB = addNode(Id(ruleEditor, diagram, "Block", "ruleB"));
+	const Id ruleC = addNode(Id(ruleEditor, diagram, "Final", "ruleC"));
+	const Id ruleFlow = addLink(Id(ruleEditor, diagram, "Flow", "ruleFlow"), ruleA, ruleB);
+	const Id ruleExit = addLink(Id(ruleEditor, diagram, "Exit", "ruleExit"), ruleB, ruleC);
+
+	// Model: the rule itself and one more block after the first one.
+	const Id a = addNode(Id(modelEditor, diagram, "Block", "a"));
+	const Id b = addNode(Id(modelEditor, diagram, "Block", "b"));
+	const Id c = addNode(Id(modelEditor, diagram, "Final", "c"));
+	const Id d = addNode(Id(modelEditor, diagram, "Block", "d"));
+	const Id flowToB = addLink(Id(modelEditor, diagram, "Flow", "flowToB"), a, b);
+	const Id exit = addLink(Id(modelEditor, diagram, "Exit", "exit"), b, c);
+	const Id flowToD = addLink(Id(modelEditor, diagram, "Flow", "flowToD"), a, d);
+
+	MatchingUnit unit(mLogicalModelApi, mGraphicalModelApi, mInterpretersInterface, ruleA
+			, {a, b, c, d, flowToB, exit, flowToD});
+
+	ASSERT_TRUE(unit.findMatch());
+	ASSERT_EQ(1, unit.matches().size());
+
+	QHash<Id, Id> expectedMatch;
+	expectedMatch.insert(ruleA, a);
+	expectedMatch.insert(ruleB, b);
+	expectedMatch.insert(ruleC, c);
+	expectedMatch.insert(ruleFlow, flowToB);
+	expectedMatch.insert(ruleExit, exit);
+	EXPECT_EQ(expectedMatch, unit.matches().first());
+}
+
+TEST_F(BaseGraphTransformationUnitTest, lookAheadPruningTest)
+{
+	// Rule: a -flow-> b -exit-> c, so matched b must have an exit link.
+	const Id ruleA = addNode(Id(ruleEditor, diagram, "Block", "ruleA"));
+	const Id ruleB = addNode(Id(ruleEditor, diagram, "Block", "ruleB"));
+	const Id ruleC = addNode(Id(ruleEditor, diagram, "Final", "ruleC"));
+	addLink(Id(ruleEditor, diagram, "Flow", "ruleFlow"), ruleA, ruleB);
+	addLink(Id(ruleEditor, diagram, "Exit", "ruleExit"), ruleB, ruleC);
+
+	// Model: both blocks after a are candidates for b, but only the second one has an exit link.
+	const Id a = addNode(Id(modelEditor, diagram, "Block", "a"));
+	const Id deadEnd = addNode(Id(modelEditor, diagram, "Block", "deadEnd"));
+	const Id b = addNode(Id(modelEditor, diagram, "Block", "b"));
+	const Id c = addNode(Id(modelEditor, diagram, "Final", "c"));
+	const Id flowToDeadEnd = addLink(Id(modelEditor, diagram, "Flow", "flowToDeadEnd"), a, deadEnd);
+	const Id flowToB = addLink(Id(modelEditor, diagram, "Flow", "flowToB"), a, b);
+	const Id exit = addLink(Id(modelEditor, diagram, "Exit", "exit"), b, c);
+
+	MatchingUnit unit(mLogicalModelApi, mGraphicalModelApi, mInterpretersInterface, ruleA
+			, {a, deadEnd, b, c, flowToDeadEnd, flowToB, exit});
+
+	EXPECT_FALSE(unit.hasLinksToCover(deadEnd, ruleB));
+	EXPECT_TRUE(unit.hasLinksToCover(b, ruleB));
+
+	ASSERT_TRUE(unit.findMatch());
+	ASSERT_EQ(1, unit.matches().size());
+	EXPECT_EQ(b, unit.matches().first().value(ruleB));
+	EXPECT_EQ(c, unit.matches().first().value(ruleC));
+	for (const QHash<Id, Id> &match : unit.matches()) {
+		EXPECT_FALSE(match.values().contains(deadEnd));
+	}
+}
@@ -0,0 +1,70 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <qrrepo/repoApi.h>
+#include <qrutils/graphUtils/baseGraphTransformationUnit.h>
+
+#include <mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterfaceMock.h>
+#include <mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/graphicalModelAssistInterfaceMock.h>
+#include <mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterfaceMock.h>
+#include <mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterMock.h>
+
+namespace qrTest {
+
+/// Transformation unit which looks for the rule starting from the given element among the given model elements.
+class MatchingUnit : public qReal::BaseGraphTransformationUnit
+{
+public:
+	MatchingUnit(qReal::LogicalModelAssistInterface &logicalModelApi
+			, qReal::GraphicalModelAssistInterface &graphicalModelApi
+			, qReal::gui::MainWindowInterpretersInterface &interpretersInterface
+			, const qReal::Id &startElement
+			, const qReal::IdList &modelElements);
+
+	bool findMatch() override;
+
+	using qReal::BaseGraphTransformationUnit::hasLinksToCover;
+
+protected:
+	qReal::Id startElement() const override;
+
+private:
+	const qReal::Id mStartElement;
+	const qReal::IdList mModelElements;
+};
+
+/// Tests for matching algorithm of BaseGraphTransformationUnit. Rule and model are kept in one repository,
+/// every element there serves as its own logical and graphical counterpart.
+class BaseGraphTransformationUnitTest : public testing::Test
+{
+protected:
+	void SetUp() override;
+
+	void TearDown() override;
+
+	qReal::Id addNode(const qReal::Id &id);
+	qReal::Id addLink(const qReal::Id &id, const qReal::Id &from, const qReal::Id &to);
+
+	qrRepo::RepoApi *mRepoApi {};
+	testing::NiceMock<LogicalModelAssistInterfaceMock> mLogicalModelApi;
+	testing::NiceMock<GraphicalModelAssistInterfaceMock> mGraphicalModelApi;
+	testing::NiceMock<MainWindowInterpretersInterfaceMock> mInterpretersInterface;
+	testing::NiceMock<ErrorReporterMock> mErrorReporter;
+};
+
+}
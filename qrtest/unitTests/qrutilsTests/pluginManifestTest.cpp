@@ -0,0 +1,89 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+#include <qrutils/pluginManagers/details/pluginManifest.h>
+
+#include "gtest/gtest.h"
+
+using namespace qReal::details;
+
+static const char toolInterface[] = "ru.spbsu.QReal.ToolPluginInterface/0.2";
+static const char kitInterface[] = "ru.spbsu.math.QReal.KitPluginInterface/1";
+
+static void writeFile(const QDir &dir, const QString &fileName, const QByteArray &contents)
+{
+	QFile file(dir.absoluteFilePath(fileName));
+	file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+	file.write(contents);
+}
+
+TEST(PluginManifestTest, rememberedInterfacesSurviveRestart)
+{
+	QTemporaryDir pluginsDir;
+	const QDir dir(pluginsDir.path());
+	const QString manifestPath = dir.absoluteFilePath("cache/manifest.json");
+	writeFile(dir, "tool.so", "tool");
+	writeFile(dir, "kit.so", "kit");
+
+	{
+		PluginManifest manifest(dir, manifestPath);
+		ASSERT_FALSE(manifest.isKnownToLack("tool.so", kitInterface));
+		manifest.markPlugin("tool.so", "tools.Tool");
+		manifest.markInterface("tool.so", toolInterface, true);
+		manifest.markInterface("tool.so", kitInterface, false);
+		manifest.markInterface("kit.so", kitInterface, true);
+		manifest.save();
+	}
+
+	PluginManifest manifest(dir, manifestPath);
+	EXPECT_TRUE(manifest.isKnownToLack("tool.so", kitInterface));
+	EXPECT_FALSE(manifest.isKnownToLack("tool.so", toolInterface));
+	EXPECT_FALSE(manifest.isKnownToLack("kit.so", kitInterface));
+	EXPECT_FALSE(manifest.isKnownToLack("kit.so", toolInterface));
+}
+
+TEST(PluginManifestTest, changedFileIsLoadedAgain)
+{
+	QTemporaryDir pluginsDir;
+	const QDir dir(pluginsDir.path());
+	writeFile(dir, "library.so", "not a plugin");
+
+	PluginManifest manifest(dir, dir.absoluteFilePath("manifest.json"));
+	manifest.markNotPlugin("library.so");
+	EXPECT_TRUE(manifest.isKnownToLack("library.so", toolInterface));
+	EXPECT_TRUE(manifest.isKnownToLack("library.so", kitInterface));
+
+	writeFile(dir, "library.so", "now it is a plugin");
+	EXPECT_FALSE(manifest.isKnownToLack("library.so", toolInterface));
+}
+
+TEST(PluginManifestTest, removedFilesAreForgotten)
+{
+	QTemporaryDir pluginsDir;
+	const QDir dir(pluginsDir.path());
+	const QString manifestPath = dir.absoluteFilePath("manifest.json");
+	writeFile(dir, "library.so", "not a plugin");
+
+	PluginManifest manifest(dir, manifestPath);
+	manifest.markNotPlugin("library.so");
+	manifest.retain({});
+	EXPECT_FALSE(manifest.isKnownToLack("library.so", toolInterface));
+
+	manifest.save();
+	EXPECT_FALSE(PluginManifest(dir, manifestPath).isKnownToLack("library.so", toolInterface));
+}
@@ -18,18 +18,23 @@ include(../common.pri)
 
 include(../../../qrutils/qrutils.pri)
 
-links(test-utils)
+links(test-utils qrrepo)
 
 INCLUDEPATH += ../../../qrutils
 
 HEADERS += \
 	expressionsParser/expressionsParserTest.h \
+	graphUtils/baseGraphTransformationUnitTest.h \
 	metamodelGeneratorSupportTest.h \
+	$$PWD/../mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/logicalModelAssistInterfaceMock.h \
+	$$PWD/../mocks/qrgui/plugins/toolPluginInterface/usedInterfaces/graphicalModelAssistInterfaceMock.h \
 
 SOURCES += \
 	expressionsParser/expressionsParserTest.cpp \
 	expressionsParser/numberTest.cpp \
+	graphUtils/baseGraphTransformationUnitTest.cpp \
 	metamodelGeneratorSupportTest.cpp \
 	inFileTest.cpp \
 	outFileTest.cpp \
+	pluginManifestTest.cpp \
 	xmlUtilsTest.cpp \
@@ -0,0 +1,262 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "compiledExpression.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <QtCore/QHash>
+#include <QtCore/QVarLengthArray>
+
+using namespace utils;
+
+CompiledExpression::Value::Value(int value)
+	: type(Number::intType)
+	, intValue(value)
+{
+}
+
+CompiledExpression::Value::Value(qreal value)
+	: type(Number::doubleType)
+	, doubleValue(value)
+{
+}
+
+qreal CompiledExpression::Value::toDouble() const
+{
+	return type == Number::intType ? intValue : doubleValue;
+}
+
+CompiledExpression::CompiledExpression()
+	: mStackSize(0)
+{
+}
+
+const QStringList &CompiledExpression::variables() const
+{
+	return mVariables;
+}
+
+bool CompiledExpression::isEmpty() const
+{
+	return mInstructions.isEmpty();
+}
+
+CompiledExpression::Value CompiledExpression::evaluate(const Value *slotValues, bool *divisionByZero) const
+{
+	return evaluate(slotValues, 0, mStackSize, divisionByZero);
+}
+
+CompiledExpression::Value CompiledExpression::evaluate(const Value *slotValues, int first, int stackSize
+		, bool *divisionByZero) const
+{
+	if (divisionByZero) {
+		*divisionByZero = false;
+	}
+
+	if (first >= mInstructions.size()) {
+		return Value();
+	}
+
+	QVarLengthArray<Value, 32> stack(stackSize);
+	int top = -1;
+	for (int i = first; i < mInstructions.size(); ++i) {
+		const Instruction &instruction = mInstructions[i];
+		switch (instruction.operation) {
+		case pushConstant:
+			stack[++top] = mConstants[instruction.argument];
+			break;
+		case pushVariable:
+			stack[++top] = slotValues[instruction.argument];
+			break;
+		case negate: {
+			Value &value = stack[top];
+			if (value.type == Number::intType) {
+				value.intValue = -value.intValue;
+			} else {
+				value.doubleValue = -value.doubleValue;
+			}
+
+			break;
+		}
+		case add:
+		case subtract:
+		case multiply:
+		case divide: {
+			const Value right = stack[top--];
+			Value &left = stack[top];
+			if (instruction.operation == divide && right.type == Number::intType && right.intValue == 0) {
+				if (divisionByZero) {
+					*divisionByZero = true;
+				}
+
+				return left;
+			}
+
+			if (left.type == Number::intType && right.type == Number::intType) {
+				switch (instruction.operation) {
+				case add:
+					left.intValue += right.intValue;
+					break;
+				case subtract:
+					left.intValue -= right.intValue;
+					break;
+				case multiply:
+					left.intValue *= right.intValue;
+					break;
+				default:
+					left.intValue /= right.intValue;
+					break;
+				}
+			} else {
+				const qreal leftValue = left.toDouble();
+				const qreal rightValue = right.toDouble();
+				switch (instruction.operation) {
+				case add:
+					left = Value(leftValue + rightValue);
+					break;
+				case subtract:
+					left = Value(leftValue - rightValue);
+					break;
+				case multiply:
+					left = Value(leftValue * rightValue);
+					break;
+				default:
+					left = Value(leftValue / rightValue);
+					break;
+				}
+			}
+
+			break;
+		}
+		default:
+			stack[top] = applyFunction(instruction.operation, stack[top]);
+			break;
+		}
+	}
+
+	return stack[top];
+}
+
+bool CompiledExpression::findFunction(const QString &name, Operation &function)
+{
+	static const QHash<QString, Operation> functions = {
+		{ "cos", cosFunction }
+		, { "sin", sinFunction }
+		, { "ln", lnFunction }
+		, { "exp", expFunction }
+		, { "asin", asinFunction }
+		, { "acos", acosFunction }
+		, { "atan", atanFunction }
+		, { "sgn", sgnFunction }
+		, { "sqrt", sqrtFunction }
+		, { "abs", absFunction }
+		, { "random", randomFunction }
+	};
+
+	const auto it = functions.constFind(name);
+	if (it == functions.constEnd()) {
+		return false;
+	}
+
+	function = it.value();
+	return true;
+}
+
+CompiledExpression::Value CompiledExpression::applyFunction(Operation function, const Value &argument)
+{
+	const qreal value = argument.toDouble();
+	switch (function) {
+	case cosFunction:
+		return Value(cos(value));
+	case sinFunction:
+		return Value(sin(value));
+	case lnFunction:
+		return Value(log(value));
+	case expFunction:
+		return Value(exp(value));
+	case asinFunction:
+		return Value(asin(value));
+	case acosFunction:
+		return Value(acos(value));
+	case atanFunction:
+		return Value(atan(value));
+	case sgnFunction:
+		return Value(value >= 0 ? 1 : -1);
+	case sqrtFunction:
+		return Value(sqrt(value));
+	case absFunction:
+		return Value(fabs(value));
+	case randomFunction:
+		return Value(static_cast<int>(rand() % static_cast<int>(value)));
+	default:
+		return argument;
+	}
+}
+
+int CompiledExpression::size() const
+{
+	return mInstructions.size();
+}
+
+void CompiledExpression::truncate(int size)
+{
+	mInstructions.resize(size);
+}
+
+void CompiledExpression::appendConstant(const Value &value)
+{
+	mInstructions.append({pushConstant, mConstants.size()});
+	mConstants.append(value);
+}
+
+void CompiledExpression::appendVariable(const QString &name)
+{
+	int slot = mVariables.indexOf(name);
+	if (slot == -1) {
+		slot = mVariables.size();
+		mVariables.append(name);
+	}
+
+	mInstructions.append({pushVariable, slot});
+}
+
+void CompiledExpression::append(Operation operation)
+{
+	mInstructions.append({operation, 0});
+}
+
+void CompiledExpression::finalize()
+{
+	int depth = 0;
+	mStackSize = 0;
+	for (const Instruction &instruction : mInstructions) {
+		switch (instruction.operation) {
+		case pushConstant:
+		case pushVariable:
+			mStackSize = qMax(mStackSize, ++depth);
+			break;
+		case add:
+		case subtract:
+		case multiply:
+		case divide:
+			--depth;
+			break;
+		default:
+			break;
+		}
+	}
+}
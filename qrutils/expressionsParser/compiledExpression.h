@@ -0,0 +1,115 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "number.h"
+#include "qrutils/utilsDeclSpec.h"
+
+namespace utils {
+
+class ExpressionsParser;
+
+/// Arithmetical expression parsed once by ExpressionsParser::compileExpression(). Can be evaluated any number
+/// of times without touching its source text: variables are referred by slots and all intermediate values
+/// are kept by value on the stack.
+class QRUTILS_EXPORT CompiledExpression
+{
+public:
+	/// Value of an expression or of its subexpression, has the same int/double semantics as Number.
+	struct Value
+	{
+		Value() = default;
+		explicit Value(int value);
+		explicit Value(qreal value);
+
+		qreal toDouble() const;
+
+		Number::Type type = Number::intType;
+		int intValue = 0;
+		qreal doubleValue = 0.0;
+	};
+
+	CompiledExpression();
+
+	/// Returns names of variables used in expression. Index of a name in this list is its slot number.
+	const QStringList &variables() const;
+
+	/// Returns true if expression contains no instructions (for example, nothing was parsed yet).
+	bool isEmpty() const;
+
+	/// Evaluates expression.
+	/// @param slotValues - values of variables, in the order of variables() list.
+	/// @param divisionByZero - if not null, set to true when evaluation stops at an integer division by zero.
+	///        In that case the dividend of that division is returned.
+	Value evaluate(const Value *slotValues, bool *divisionByZero = nullptr) const;
+
+private:
+	friend class ExpressionsParser;
+
+	enum Operation {
+		pushConstant
+		, pushVariable
+		, negate
+		, add
+		, subtract
+		, multiply
+		, divide
+		, cosFunction
+		, sinFunction
+		, lnFunction
+		, expFunction
+		, asinFunction
+		, acosFunction
+		, atanFunction
+		, sgnFunction
+		, sqrtFunction
+		, absFunction
+		, randomFunction
+	};
+
+	struct Instruction
+	{
+		Operation operation;
+		int argument;  // Index in mConstants or in mVariables, depending on operation.
+	};
+
+	/// Finds built-in function by its name, returns false if there is no such function.
+	static bool findFunction(const QString &name, Operation &function);
+	static Value applyFunction(Operation function, const Value &argument);
+
+	/// Evaluates instructions starting from @a first, they must form a complete subexpression.
+	Value evaluate(const Value *slotValues, int first, int stackSize, bool *divisionByZero) const;
+
+	int size() const;
+	void truncate(int size);
+
+	void appendConstant(const Value &value);
+	void appendVariable(const QString &name);
+	void append(Operation operation);
+
+	/// Computes the stack size needed for evaluation, called by parser when expression is complete.
+	void finalize();
+
+	QVector<Instruction> mInstructions;
+	QVector<Value> mConstants;
+	QStringList mVariables;
+	int mStackSize;
+};
+
+}
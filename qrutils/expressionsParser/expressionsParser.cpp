@@ -14,13 +14,38 @@
 
 #include "expressionsParser.h"
 
-#include <math.h>
 #include <stdlib.h>
 #include <time.h>
 
+#include <QtCore/QVarLengthArray>
+
 using namespace utils;
 using namespace qReal;
 
+typedef QVarLengthArray<CompiledExpression::Value, 16> SlotValues;
+
+static void fillSlotValues(const CompiledExpression &expression
+		, const QMap<QString, QSharedPointer<Number>> &variables, SlotValues &slotValues)
+{
+	for (const QString &variable : expression.variables()) {
+		const QSharedPointer<Number> number = variables.value(variable);
+		if (!number) {
+			slotValues.append(CompiledExpression::Value());
+		} else if (number->type() == Number::intType) {
+			slotValues.append(CompiledExpression::Value(number->value().toInt()));
+		} else {
+			slotValues.append(CompiledExpression::Value(number->value().toDouble()));
+		}
+	}
+}
+
+static QSharedPointer<Number> toNumber(const CompiledExpression::Value &value)
+{
+	return value.type == Number::intType
+			? QSharedPointer<Number>::create(value.intValue, Number::intType)
+			: QSharedPointer<Number>::create(value.doubleValue, Number::doubleType);
+}
+
 ExpressionsParser::ExpressionsParser(ErrorReporterInterface *errorReporter)
 	: mHasParseErrors(false), mErrorReporter(errorReporter), mCurrentId (Id::rootId())
 {
@@ -36,6 +61,7 @@ QMap<QString, QSharedPointer<Number>> const &ExpressionsParser::variables() cons
 
 QMap<QString, QSharedPointer<Number>> &ExpressionsParser::mutableVariables()
 {
+	mCompiledExpressions.clear();
 	return mVariables;
 }
 
@@ -113,7 +139,7 @@ bool ExpressionsParser::isAssignment(const QChar &c) const
 	return c.toLatin1() == '=';
 }
 
-QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int &pos)
+void ExpressionsParser::compileNumber(const QString &stream, int &pos, CompiledExpression &expression)
 {
 	int beginPos = pos;
 	bool isDouble = false;
@@ -122,7 +148,8 @@ QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int
 	}
 
 	if (!checkForDigit(stream, pos)) {
-		return QSharedPointer<Number>::create();
+		expression.appendConstant(CompiledExpression::Value());
+		return;
 	}
 
 	while (pos < stream.length() && isDigit(stream.at(pos))) {
@@ -133,7 +160,8 @@ QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int
 		pos++;
 
 		if (!checkForDigit(stream, pos)) {
-			return QSharedPointer<Number>::create();
+			expression.appendConstant(CompiledExpression::Value());
+			return;
 		}
 
 		while (pos < stream.length() && isDigit(stream.at(pos))) {
@@ -145,7 +173,8 @@ QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int
 		pos++;
 
 		if (isEndOfStream(stream, pos)) {
-			return QSharedPointer<Number>::create();
+			expression.appendConstant(CompiledExpression::Value());
+			return;
 		}
 
 		if (pos < stream.length() && isSign(stream.at(pos))) {
@@ -153,7 +182,8 @@ QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int
 		}
 
 		if (!checkForDigit(stream, pos)) {
-			return QSharedPointer<Number>::create();
+			expression.appendConstant(CompiledExpression::Value());
+			return;
 		}
 
 		while (pos < stream.length() && isDigit(stream.at(pos))) {
@@ -161,9 +191,9 @@ QSharedPointer<Number> ExpressionsParser::parseNumber(const QString &stream, int
 		}
 	}
 	if (isDouble) {
-		return QSharedPointer<Number>::create(stream.mid(beginPos, pos - beginPos).toDouble(), Number::doubleType);
+		expression.appendConstant(CompiledExpression::Value(stream.midRef(beginPos, pos - beginPos).toDouble()));
 	} else {
-		return QSharedPointer<Number>::create(stream.mid(beginPos, pos - beginPos).toInt(), Number::intType);
+		expression.appendConstant(CompiledExpression::Value(stream.midRef(beginPos, pos - beginPos).toInt()));
 	}
 }
 
@@ -208,55 +238,59 @@ bool ExpressionsParser::isHtmlBrTag(const QString &stream, int &pos) const
 	}
 }
 
-QSharedPointer<Number> ExpressionsParser::parseTerm(const QString &stream, int &pos)
+void ExpressionsParser::compileTerm(const QString &stream, int &pos, CompiledExpression &expression)
 {
-	QSharedPointer<Number> res;
+	const int start = expression.size();
 	skip(stream, pos);
 
 	if (hasErrors() || isEndOfStream(stream, pos)) {
-		return QSharedPointer<Number>::create();
+		expression.appendConstant(CompiledExpression::Value());
+		return;
 	}
 
 	switch (stream.at(pos).toLatin1()) {
 	case '+':
 		pos++;
 		skip(stream, pos);
-		res = parseTerm(stream, pos);
+		compileTerm(stream, pos, expression);
 		break;
 	case '-':
 		pos++;
 		skip(stream, pos);
-		res = parseTerm(stream, pos);
-		res->neg();
+		compileTerm(stream, pos, expression);
+		expression.append(CompiledExpression::negate);
 		break;
 	case '(':
 		pos++;
 		skip(stream, pos);
-		res = parseExpression(stream, pos);
+		compileSum(stream, pos, expression);
 		skip(stream, pos);
 		if (!checkForClosingBracket(stream, pos)) {
-			return res;
+			return;
 		}
 		pos++;
 		break;
 	default:
 		if (isDigit(stream.at(pos))) {
-			res = parseNumber(stream, pos);
+			compileNumber(stream, pos, expression);
 		} else if (isLetter(stream.at(pos))) {
 			int unknownIdentifierIndex = pos;
 			QString variable = parseIdentifier(stream, pos);
-			if (isFunction(variable)) {
+			CompiledExpression::Operation function;
+			if (CompiledExpression::findFunction(variable, function)) {
 				skip(stream, pos);
 				if (checkForOpeningBracket(stream, pos)) {
 					pos++;
-					auto value = parseExpression(stream, pos);
+					compileSum(stream, pos, expression);
 					if (checkForClosingBracket(stream, pos)) {
 						pos++;
-						res = applyFunction(variable, value);
+						expression.append(function);
+					} else {
+						expression.truncate(start);
 					}
 				}
 			} else if (mVariables.contains(variable)) {
-				res.reset(new Number(mVariables[variable]->value(), mVariables[variable]->type()));
+				expression.appendVariable(variable);
 			} else {
 				error(unknownIdentifier, QString::number(unknownIdentifierIndex + 1), "", variable);
 			}
@@ -267,55 +301,107 @@ QSharedPointer<Number> ExpressionsParser::parseTerm(const QString &stream, int &
 		break;
 	}
 	skip(stream, pos);
-	if (!res) {
-		res.reset(new Number());
+	if (expression.size() == start) {
+		expression.appendConstant(CompiledExpression::Value());
 	}
-
-	return res;
 }
 
-QSharedPointer<Number> ExpressionsParser::parseMult(const QString &stream, int &pos)
+void ExpressionsParser::compileMult(const QString &stream, int &pos, CompiledExpression &expression)
 {
-	QSharedPointer<Number> res(parseTerm(stream, pos));
+	compileTerm(stream, pos, expression);
 	while (pos < stream.length() && isMultiplicationOrDivision(stream.at(pos))) {
+		const bool isMultiplication = stream.at(pos).toLatin1() == '*';
 		pos++;
-		switch (stream.at(pos - 1).toLatin1()) {
-		case '*':
-			*res *= *parseTerm(stream, pos);
-			break;
-		case '/':
-			{
-				auto divisor = parseTerm(stream, pos);
-				if (divisor->type() == Number::intType && divisor->value().toInt() == 0) {
-					error(divisionByZero);
-				} else {
-					*res /= *divisor;
-				}
-
-				break;
-			}
+		const int divisorStart = expression.size();
+		compileTerm(stream, pos, expression);
+		if (isMultiplication) {
+			expression.append(CompiledExpression::multiply);
+		} else if (mCheckDivisions && isZeroDivisor(expression, divisorStart)) {
+			// The error stops parsing of the following terms, the dividend is kept as is.
+			error(divisionByZero);
+			expression.truncate(divisorStart);
+		} else {
+			expression.append(CompiledExpression::divide);
 		}
 	}
+}
 
-	return res;
+bool ExpressionsParser::isZeroDivisor(const CompiledExpression &expression, int first) const
+{
+	SlotValues slotValues;
+	fillSlotValues(expression, mVariables, slotValues);
+	const CompiledExpression::Value divisor
+			= expression.evaluate(slotValues.constData(), first, expression.size() - first, nullptr);
+	return divisor.type == Number::intType && divisor.intValue == 0;
 }
 
-QSharedPointer<Number> ExpressionsParser::parseExpression(const QString &stream, int &pos)
+void ExpressionsParser::compileSum(const QString &stream, int &pos, CompiledExpression &expression)
 {
-	auto res = parseMult(stream, pos);
+	compileMult(stream, pos, expression);
 	while (pos < stream.length() && isArithmeticalMinusOrPlus(stream.at(pos))) {
+		const bool isAddition = stream.at(pos).toLatin1() == '+';
 		pos++;
-		switch (stream.at(pos - 1).toLatin1()) {
-		case '+':
-			*res += *parseMult(stream, pos);
-			break;
-		case '-':
-			*res -= *parseMult(stream, pos);
-			break;
+		compileMult(stream, pos, expression);
+		expression.append(isAddition ? CompiledExpression::add : CompiledExpression::subtract);
+	}
+}
+
+CompiledExpression ExpressionsParser::compileExpression(const QString &stream, int &pos)
+{
+	CompiledExpression expression;
+	compileSum(stream, pos, expression);
+	expression.finalize();
+	return expression;
+}
+
+QSharedPointer<Number> ExpressionsParser::evaluate(const CompiledExpression &expression)
+{
+	SlotValues slotValues;
+	fillSlotValues(expression, mVariables, slotValues);
+	bool zeroDivisor = false;
+	const CompiledExpression::Value result = expression.evaluate(slotValues.constData(), &zeroDivisor);
+	if (zeroDivisor) {
+		error(divisionByZero);
+	}
+
+	return toNumber(result);
+}
+
+QSharedPointer<Number> ExpressionsParser::parseExpression(const QString &stream, int &pos)
+{
+	// Elements of programs and rules are few, but many edited elements should not make the cache grow forever.
+	const int maxCompiledExpressions = 1024;
+
+	const QPair<Id, int> key(mCurrentId, pos);
+	if (!hasErrors()) {
+		const auto cached = mCompiledExpressions.constFind(key);
+		if (cached != mCompiledExpressions.constEnd() && cached->text == stream) {
+			SlotValues slotValues;
+			fillSlotValues(cached->expression, mVariables, slotValues);
+			bool zeroDivisor = false;
+			const CompiledExpression::Value result
+					= cached->expression.evaluate(slotValues.constData(), &zeroDivisor);
+			if (!zeroDivisor) {
+				pos = cached->end;
+				return toNumber(result);
+			}
+
+			// Parsing the text again, so the error is reported and stops parsing exactly where it always did.
 		}
 	}
 
-	return res;
+	mCheckDivisions = true;
+	const CompiledExpression expression = compileExpression(stream, pos);
+	mCheckDivisions = false;
+	if (!hasErrors()) {
+		if (mCompiledExpressions.size() >= maxCompiledExpressions) {
+			mCompiledExpressions.clear();
+		}
+
+		mCompiledExpressions.insert(key, { stream, expression, pos });
+	}
+
+	return evaluate(expression);
 }
 
 void ExpressionsParser::parseVarPart(const QString &stream, int &pos)
@@ -702,6 +788,7 @@ void ExpressionsParser::clear()
 	mHasParseErrors = false;
 	mErrorReporter = nullptr;
 	mVariables.clear();
+	mCompiledExpressions.clear();
 	mCurrentId = Id::rootId();
 }
 
@@ -719,47 +806,6 @@ void ExpressionsParser::checkForVariable(const QString &nameOfVariable, int &ind
 
 bool ExpressionsParser::isFunction(const QString &variable)
 {
-	return variable == "cos"
-			|| variable == "sin"
-			|| variable == "ln"
-			|| variable == "exp"
-			|| variable == "asin"
-			|| variable == "acos"
-			|| variable == "atan"
-			|| variable == "sgn"
-			|| variable == "sqrt"
-			|| variable == "abs"
-			|| variable == "random"
-			;
-}
-
-QSharedPointer<Number> ExpressionsParser::applyFunction(const QString &variable, const QSharedPointer<Number> &value)
-{
-	Number *result {};
-	qreal argument = value->value().toDouble();
-	if (variable == "cos") {
-		result= new Number(cos(argument), Number::doubleType);
-	} else if (variable == "sin") {
-		result= new Number(sin(argument), Number::doubleType);
-	} else if (variable == "ln") {
-		result = new Number(log(argument), Number::doubleType);
-	} else if (variable == "exp") {
-		result = new Number(exp(argument), Number::doubleType);
-	} else if (variable == "sgn") {
-		result = new Number((argument >= 0 ? 1 : -1), Number::intType);
-	} else if (variable == "acos") {
-		result = new Number(acos(argument), Number::doubleType);
-	} else if (variable == "asin") {
-		result = new Number(asin(argument), Number::doubleType);
-	} else if (variable == "atan") {
-		result = new Number(atan(argument), Number::doubleType);
-	} else if (variable == "sqrt") {
-		result = new Number(sqrt(argument), Number::doubleType);
-	} else if (variable == "abs") {
-		result = new Number(fabs(argument), Number::doubleType);
-	} else if (variable == "random") {
-		result = new Number(static_cast<int>(rand() % static_cast<int>(argument)), Number::intType);
-	}
-
-	return QSharedPointer<Number>(result);
+	CompiledExpression::Operation function;
+	return CompiledExpression::findFunction(variable, function);
 }
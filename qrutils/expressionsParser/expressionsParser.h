@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtCore/QMap>
 
 #include "number.h"
+#include "compiledExpression.h"
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/errorReporterInterface.h>
 #include "qrutils/utilsDeclSpec.h"
 
@@ -30,7 +32,19 @@ public:
 	explicit ExpressionsParser(qReal::ErrorReporterInterface *errorReporter);
 	virtual ~ExpressionsParser();
 
+	/// Parses and evaluates arithmetical expression starting at @a pos. Expression is compiled only the first time
+	/// it is met at that position of that text of current element, later calls just evaluate it with current values
+	/// of variables. Parsing stops at the first integer division by zero, the same way as it always did.
 	QSharedPointer<Number> parseExpression(const QString &stream, int &pos);
+
+	/// Parses arithmetical expression starting at @a pos into a form that can be evaluated many times without
+	/// reparsing. Reports the same parse errors as parseExpression(), variables must be known at this moment.
+	CompiledExpression compileExpression(const QString &stream, int &pos);
+
+	/// Evaluates compiled expression with current values of parser variables. Reports integer division by zero,
+	/// evaluation stops at it.
+	QSharedPointer<Number> evaluate(const CompiledExpression &expression);
+
 	void parseProcess(const QString &stream, int& pos, const qReal::Id &curId);
 	bool parseConditionHelper(const QString &stream, int &pos);
 	bool parseCondition(const QString &stream, int& pos, const qReal::Id &curId);
@@ -40,6 +54,8 @@ public:
 	void clear();
 
 	QMap<QString, QSharedPointer<Number>> const &variables() const;
+
+	/// Gives write access to variables. Drops compiled expressions since they may use variables that get removed.
 	QMap<QString, QSharedPointer<Number>> &mutableVariables();
 
 protected:
@@ -78,11 +94,12 @@ protected:
 	bool isHtmlBrTag(const QString &stream, int &pos) const;
 
 	QString parseIdentifier(const QString &stream, int &pos);
-	QSharedPointer<Number> parseNumber(const QString &stream, int &pos);
+	void compileNumber(const QString &stream, int &pos, CompiledExpression &expression);
 	void skip(const QString &stream, int &pos) const;
 
-	QSharedPointer<Number> parseTerm(const QString &stream, int &pos);
-	QSharedPointer<Number> parseMult(const QString &stream, int&pos);
+	void compileTerm(const QString &stream, int &pos, CompiledExpression &expression);
+	void compileMult(const QString &stream, int &pos, CompiledExpression &expression);
+	void compileSum(const QString &stream, int &pos, CompiledExpression &expression);
 
 	virtual void parseVarPart(const QString &stream, int &pos);
 	void parseCommand(const QString &stream, int &pos);
@@ -107,12 +124,30 @@ protected:
 	virtual void checkForVariable(const QString &nameOfVariable, int &index);
 
 	bool isFunction(const QString &variable);
-	QSharedPointer<Number> applyFunction(const QString &variable, const QSharedPointer<Number> &value);
 
 	QMap<QString, QSharedPointer<Number>> mVariables;
 	bool mHasParseErrors;
 	qReal::ErrorReporterInterface *mErrorReporter;  // Does not take ownership
 	qReal::Id mCurrentId;
 
+private:
+	struct CachedExpression
+	{
+		QString text;
+		CompiledExpression expression;
+		int end;  // Position in source text right after the expression.
+	};
+
+	/// Returns true if the last term of @a expression, starting at @a first instruction, is integer zero
+	/// with current values of variables.
+	bool isZeroDivisor(const CompiledExpression &expression, int first) const;
+
+	/// When set, compileMult() checks divisors with current values of variables and stops parsing at integer
+	/// division by zero. Set by parseExpression() only, compileExpression() alone does not depend on values.
+	bool mCheckDivisions = false;
+
+	/// Expressions compiled by parseExpression() without errors, keyed by current element and start position.
+	/// Source text is kept to detect edits, comparing it is cheaper than hashing it.
+	QHash<QPair<qReal::Id, int>, CachedExpression> mCompiledExpressions;
 };
 }
@@ -16,8 +16,10 @@ HEADERS += \
 	$$PWD/expressionsParser.h \
 	$$PWD/number.h \
 	$$PWD/computableNumber.h \
+	$$PWD/compiledExpression.h \
 
 SOURCES += \
 	$$PWD/expressionsParser.cpp \
 	$$PWD/number.cpp \
 	$$PWD/computableNumber.cpp \
+	$$PWD/compiledExpression.cpp \
@@ -81,12 +81,16 @@ bool BaseGraphTransformationUnit::checkRuleMatching(const IdList &elements)
 
 	mNodesHavingOutsideLinks.append(startElem);
 
+	buildLookupTables(elements);
+
 	for (const Id &element : elements) {
 		if (compareElements(element, startElem)) {
 			mCurrentMatchedGraphInRule.clear();
 			mCurrentMatchedGraphInModel.clear();
 			mNodesHavingOutsideLinks.clear();
 			mMatch.clear();
+			mMatchUndoLog.clear();
+			mMatchUndoMarks.clear();
 			mPos = 0;
 
 			mCurrentMatchedGraphInRule.append(startElem);
@@ -101,100 +105,109 @@ bool BaseGraphTransformationUnit::checkRuleMatching(const IdList &elements)
 		}
 	}
 
+	clearLookupTables();
+
 	return isMatched;
 }
 
 bool BaseGraphTransformationUnit::checkRuleMatchingRecursively()
 {
 	if (mNodesHavingOutsideLinks.length() == mPos) {
-		QHash<Id, Id> currentMatch = mMatch;
-		mMatches.append(currentMatch);
+		mMatches.append(mMatch);
 		return true;
 	}
 
-	bool isMatched = false;
-
 	const Id nodeInRule = mNodesHavingOutsideLinks.at(mPos);
 	const Id linkInRule = outsideLink(nodeInRule);
 
-	if (linkInRule != Id::rootId()) {
-		const Id linkEndInRuleElement = linkEndInRule(linkInRule, nodeInRule);
-		if (linkEndInRuleElement == Id::rootId()) {
-			report(tr("Rule '") + property(mRuleToFind, "ruleName").toString() + tr("' has unconnected link"), true);
-			mHasRuleSyntaxErr = true;
-			return false;
-		}
+	if (linkInRule == Id::rootId()) {
+		mPos++;
+		return checkRuleMatchingRecursively();
+	}
 
-		const Id nodeInModel = mMatch.value(nodeInRule);
-		const IdList linksInModel = properLinks(nodeInModel, linkInRule);
-
-		QHash<Id, Id> matchBackup = mMatch;
-		IdList nodesHavingOutsideLinksBackup = mNodesHavingOutsideLinks;
-		IdList currentMatchedGraphInRuleBackup = mCurrentMatchedGraphInRule;
-		IdList currentMatchedGraphInModelBackup = mCurrentMatchedGraphInModel;
-		const int posBackup = mPos;
-
-		for (const Id &linkInModel : linksInModel) {
-			const Id linkEndInModelElement = linkEndInModel(linkInModel, nodeInModel);
-			if (checkNodeForAddingToMatch(linkEndInModelElement, linkEndInRuleElement)) {
-				if (checkRuleMatchingRecursively()) {
-					isMatched = true;
-					mMatch = QHash<Id, Id>();
-					for (const Id &id : matchBackup.keys()) {
-						mMatch.insert(id, matchBackup.value(id));
-					}
+	const Id linkEndInRuleElement = linkEndInRule(linkInRule, nodeInRule);
+	if (linkEndInRuleElement == Id::rootId()) {
+		report(tr("Rule '") + property(mRuleToFind, "ruleName").toString() + tr("' has unconnected link"), true);
+		mHasRuleSyntaxErr = true;
+		return false;
+	}
 
-					mNodesHavingOutsideLinks = IdList();
-					for (const Id &id : nodesHavingOutsideLinksBackup) {
-						mNodesHavingOutsideLinks.append(id);
-					}
-					mCurrentMatchedGraphInRule = IdList();
-					for (const Id &id : currentMatchedGraphInRuleBackup) {
-						mCurrentMatchedGraphInRule.append(id);
-					}
-					mCurrentMatchedGraphInModel = IdList();
-					for (const Id &id : currentMatchedGraphInModelBackup) {
-						mCurrentMatchedGraphInModel.append(id);
-					}
+	const Id nodeInModel = mMatch.value(nodeInRule);
+	const IdList linksInModel = properLinks(nodeInModel, linkInRule);
+	const int posBackup = mPos;
+	bool isMatched = false;
 
-					mPos = posBackup;
-				} else {
-					rollback();
-				}
+	// match state is extended in place and every step is undone before trying the next candidate
+	for (const Id &linkInModel : linksInModel) {
+		const Id linkEndInModelElement = linkEndInModel(linkInModel, nodeInModel);
+		if (checkNodeForAddingToMatch(linkEndInModelElement, linkEndInRuleElement)) {
+			if (checkRuleMatchingRecursively()) {
+				isMatched = true;
 			}
+
+			rollback();
+			mPos = posBackup;
 		}
-		return isMatched;
-	} else {
-		mPos++;
-		return checkRuleMatchingRecursively();
 	}
+
+	return isMatched;
 }
 
 bool BaseGraphTransformationUnit::checkNodeForAddingToMatch(const Id &nodeInModel, const Id &nodeInRule)
 {
-	if (nodeInModel == Id::rootId()) {
+	if (nodeInModel == Id::rootId() || !hasLinksToCover(nodeInModel, nodeInRule)) {
 		return false;
 	}
 
-	QHash<Id, Id> *linksToAddToMatch = new QHash<Id, Id>();
+	QHash<Id, Id> linksToAddToMatch;
+	if (!checkExistingLinks(nodeInModel, nodeInRule, &linksToAddToMatch)) {
+		return false;
+	}
 
-	bool res = checkExistingLinks(nodeInModel, nodeInRule, linksToAddToMatch);
+	mMatchUndoMarks.append(mMatchUndoLog.size());
+	for (auto it = linksToAddToMatch.cbegin(); it != linksToAddToMatch.cend(); ++it) {
+		mMatch.insert(it.key(), it.value());
+		mMatchUndoLog.append(it.key());
+	}
 
-	if (res) {
-		mMatch.unite(*linksToAddToMatch);
-		mMatch.insert(nodeInRule, nodeInModel);
-		mCurrentMatchedGraphInRule.append(nodeInRule);
-		mCurrentMatchedGraphInModel.append(nodeInModel);
-		mNodesHavingOutsideLinks.append(nodeInRule);
+	mMatch.insert(nodeInRule, nodeInModel);
+	mMatchUndoLog.append(nodeInRule);
+	mCurrentMatchedGraphInRule.append(nodeInRule);
+	mCurrentMatchedGraphInModel.append(nodeInModel);
+	mNodesHavingOutsideLinks.append(nodeInRule);
+
+	return true;
+}
+
+bool BaseGraphTransformationUnit::hasLinksToCover(const Id &nodeInModel, const Id &nodeInRule) const
+{
+	const IdList links = linksInModel(nodeInModel);
+	for (const Id &linkInRule : ruleLinks(nodeInRule)) {
+		if (linkEndInRule(linkInRule, nodeInRule) == Id::rootId()) {
+			// unconnected links are reported as syntax errors when the algo reaches them
+			continue;
+		}
+
+		bool isCovered = false;
+		for (const Id &linkInModel : links) {
+			if (compareElementTypesAndProperties(linkInModel, linkInRule)) {
+				isCovered = true;
+				break;
+			}
+		}
+
+		if (!isCovered) {
+			return false;
+		}
 	}
 
-	return res;
+	return true;
 }
 
 bool BaseGraphTransformationUnit::checkExistingLinks(const Id &nodeInModel
 		, const Id &nodeInRule, QHash<Id, Id> *linksToAddInMatch)
 {
-	const IdList linksInRuleElement = linksInRule(nodeInRule);
+	const IdList linksInRuleElement = ruleLinks(nodeInRule);
 
 	for (const Id &linkInRule : linksInRuleElement) {
 		const Id linkEndInR = linkEndInRule(linkInRule, nodeInRule);
@@ -204,7 +217,7 @@ bool BaseGraphTransformationUnit::checkExistingLinks(const Id &nodeInModel
 				return false;
 			} else {
 				if (mLogicalModelApi.logicalRepoApi().isLogicalElement(properLinkInModel)) {
-					const IdList properGraphicalLinks = mGraphicalModelApi.graphicalIdsByLogicalId(properLinkInModel);
+					const IdList properGraphicalLinks = graphicalIds(properLinkInModel);
 					if (!properGraphicalLinks.isEmpty()) {
 						properLinkInModel = properGraphicalLinks.first();
 					}
@@ -219,26 +232,23 @@ bool BaseGraphTransformationUnit::checkExistingLinks(const Id &nodeInModel
 
 void BaseGraphTransformationUnit::rollback()
 {
-	const Id nodeToRemove = mCurrentMatchedGraphInRule.last();
+	const int undoMark = mMatchUndoMarks.takeLast();
+	while (mMatchUndoLog.size() > undoMark) {
+		mMatch.remove(mMatchUndoLog.takeLast());
+	}
 
-	mMatch.remove(nodeToRemove);
 	mCurrentMatchedGraphInRule.removeLast();
 	mCurrentMatchedGraphInModel.removeLast();
 	mNodesHavingOutsideLinks.removeLast();
 	if (mPos == mNodesHavingOutsideLinks.length()) {
 		mPos--;
 	}
-
-	const IdList links = linksToMatchedSubgraph(nodeToRemove);
-	for (const Id &link : links) {
-		mMatch.remove(link);
-	}
 }
 
 IdList BaseGraphTransformationUnit::linksToMatchedSubgraph(const Id &nodeInRule) const
 {
 	IdList result;
-	const IdList lnksInRule = linksInRule(nodeInRule);
+	const IdList lnksInRule = ruleLinks(nodeInRule);
 	for (const Id &link : lnksInRule) {
 		const Id linkEnd = linkEndInRule(link, nodeInRule);
 		if (mCurrentMatchedGraphInRule.contains(linkEnd)) {
@@ -250,15 +260,27 @@ IdList BaseGraphTransformationUnit::linksToMatchedSubgraph(const Id &nodeInRule)
 
 Id BaseGraphTransformationUnit::outsideLink(const Id &nodeInRule) const
 {
-	const IdList lnksInRule = linksInRule(nodeInRule);
+	Id result = Id::rootId();
+	int resultFrequency = 0;
+	const IdList lnksInRule = ruleLinks(nodeInRule);
 	for (const Id &linkInRule : lnksInRule) {
 		const Id linkEndInR = linkEndInRule(linkInRule, nodeInRule);
-		if (!mCurrentMatchedGraphInRule.contains(linkEndInR)) {
+		if (linkEndInR == Id::rootId()) {
 			return linkInRule;
 		}
+
+		if (!mCurrentMatchedGraphInRule.contains(linkEndInR)) {
+			// the fewer model elements of that type, the fewer candidates the algo has to try
+			const int frequency = mModelTypeFrequency.value(
+					qMakePair(linkEndInR.diagram(), linkEndInR.element()));
+			if (result == Id::rootId() || frequency < resultFrequency) {
+				result = linkInRule;
+				resultFrequency = frequency;
+			}
+		}
 	}
 
-	return Id::rootId();
+	return result;
 }
 
 Id BaseGraphTransformationUnit::linkEndInModel(const Id &linkInModel, const Id &nodeInModel) const
@@ -284,14 +306,8 @@ Id BaseGraphTransformationUnit::properLink(const Id &nodeInModel, const Id &link
 	const IdList lnksInModel = linksInModel(nodeInModel);
 	for (const Id &linkInModel : lnksInModel) {
 		if (compareLinks(linkInModel, linkInRule)) {
-			Id linkEndInM = linkEndInModel(linkInModel, nodeInModel);
-			if (!mLogicalModelApi.isLogicalId(linkEndInM)) {
-				linkEndInM = mGraphicalModelApi.logicalId(linkEndInM);
-			}
-			Id linkEndInRValue = mMatch.value(linkEndInR);
-			if (!mLogicalModelApi.isLogicalId(linkEndInRValue)) {
-				linkEndInRValue = mGraphicalModelApi.logicalId(linkEndInRValue);
-			}
+			const Id linkEndInM = logicalId(linkEndInModel(linkInModel, nodeInModel));
+			const Id linkEndInRValue = logicalId(mMatch.value(linkEndInR));
 			if (linkEndInM == linkEndInRValue) {
 				return linkInModel;
 			}
@@ -314,7 +330,7 @@ IdList BaseGraphTransformationUnit::properLinks(const Id &nodeInModel, const Id
 			if (!mLogicalModelApi.isLogicalId(linkInModel)) {
 				result.append(linkInModel);
 			} else {
-				result.append(mGraphicalModelApi.graphicalIdsByLogicalId(linkInModel));
+				result.append(graphicalIds(linkInModel));
 			}
 		}
 	}
@@ -323,35 +339,21 @@ IdList BaseGraphTransformationUnit::properLinks(const Id &nodeInModel, const Id
 
 bool BaseGraphTransformationUnit::compareLinks(const Id &first,const Id &second) const
 {
-	Id  idTo1 = toInModel(first);
+	const Id idTo1 = toInModel(first);
 	const Id idTo2 = toInRule(second);
-	Id idFrom1 = fromInModel(first);
+	const Id idFrom1 = fromInModel(first);
 	const Id idFrom2 = fromInRule(second);
 
 	bool result = compareElementTypesAndProperties(first, second)
 			&& compareElements(idTo1, idTo2)
 			&& compareElements(idFrom1, idFrom2);
 
-	if (mMatch.contains(idTo2)) {
-		Id matchTo = mMatch.value(idTo2);
-		if (!mLogicalModelApi.isLogicalId(matchTo)) {
-			matchTo = mGraphicalModelApi.logicalId(matchTo);
-		}
-		if (!mLogicalModelApi.isLogicalId(idTo1)) {
-			idTo1 = mGraphicalModelApi.logicalId(idTo1);
-		}
-		result = result && matchTo == idTo1;
+	if (result && mMatch.contains(idTo2)) {
+		result = logicalId(mMatch.value(idTo2)) == logicalId(idTo1);
 	}
 
-	if (mMatch.contains(idFrom2)) {
-		Id matchTo = mMatch.value(idFrom2);
-		if (!mLogicalModelApi.isLogicalId(matchTo)) {
-			matchTo = mGraphicalModelApi.logicalId(matchTo);
-		}
-		if (!mLogicalModelApi.isLogicalId(idFrom1)) {
-			idFrom1 = mGraphicalModelApi.logicalId(idFrom1);
-		}
-		result = result && matchTo == idFrom1;
+	if (result && mMatch.contains(idFrom2)) {
+		result = logicalId(mMatch.value(idFrom2)) == logicalId(idFrom1);
 	}
 
 	return result;
@@ -366,14 +368,8 @@ bool BaseGraphTransformationUnit::compareElementTypesAndProperties(const Id &fir
 		, const Id &second) const
 {
 	if (first.element() == second.element() && first.diagram() == second.diagram()) {
-		QHash<QString, QVariant> secondProperties = properties(second);
-		for (const QString &key : secondProperties.keys()) {
-			const QVariant value = secondProperties.value(key);
-			if (value.toString().isEmpty()) {
-				continue;
-			}
-
-			if (!hasProperty(first, key) || property(first, key) != value) {
+		for (const QPair<QString, QVariant> &ruleProperty : ruleProperties(second)) {
+			if (!hasProperty(first, ruleProperty.first) || property(first, ruleProperty.first) != ruleProperty.second) {
 				return false;
 			}
 		}
@@ -386,6 +382,10 @@ bool BaseGraphTransformationUnit::compareElementTypesAndProperties(const Id &fir
 
 bool BaseGraphTransformationUnit::hasProperty(const Id &id, const QString &propertyName) const
 {
+	if (mLookupTablesEnabled) {
+		return modelProperties(id).contains(propertyName);
+	}
+
 	if (mLogicalModelApi.isLogicalId(id)) {
 		return mLogicalModelApi.logicalRepoApi().hasProperty(id, propertyName);
 	} else {
@@ -421,6 +421,10 @@ QMapIterator<QString, QVariant> BaseGraphTransformationUnit::propertiesIterator(
 
 QVariant BaseGraphTransformationUnit::property(const Id &id, const QString &propertyName) const
 {
+	if (mLookupTablesEnabled) {
+		return modelProperties(id).value(propertyName);
+	}
+
 	if (mLogicalModelApi.isLogicalId(id)) {
 		return mLogicalModelApi.logicalRepoApi().property(id, propertyName);
 	}
@@ -448,29 +452,39 @@ bool BaseGraphTransformationUnit::isEdgeInRule(const Id &element) const
 
 Id BaseGraphTransformationUnit::toInModel(const Id &id) const
 {
-	Id result;
-	if (mLogicalModelApi.isLogicalId(id)) {
-		result = mLogicalModelApi.logicalRepoApi().to(id);
-	} else {
-		result = mLogicalModelApi.logicalRepoApi().to(mGraphicalModelApi.logicalId(id));
+	if (mLookupTablesEnabled && mModelLinkToTable.contains(id)) {
+		return mModelLinkToTable.value(id);
 	}
-	if (!mGraphicalModelApi.graphicalIdsByLogicalId(result).isEmpty()) {
-		result = mGraphicalModelApi.graphicalIdsByLogicalId(result).first();
+
+	Id result = mLogicalModelApi.logicalRepoApi().to(logicalId(id));
+	const IdList graphicalResult = graphicalIds(result);
+	if (!graphicalResult.isEmpty()) {
+		result = graphicalResult.first();
 	}
+
+	if (mLookupTablesEnabled) {
+		mModelLinkToTable.insert(id, result);
+	}
+
 	return result;
 }
 
 Id BaseGraphTransformationUnit::fromInModel(const Id &id) const
 {
-	Id result;
-	if (mLogicalModelApi.isLogicalId(id)) {
-		result = mLogicalModelApi.logicalRepoApi().from(id);
-	} else {
-		result = mLogicalModelApi.logicalRepoApi().from(mGraphicalModelApi.logicalId(id));
+	if (mLookupTablesEnabled && mModelLinkFromTable.contains(id)) {
+		return mModelLinkFromTable.value(id);
 	}
-	if (!mGraphicalModelApi.graphicalIdsByLogicalId(result).isEmpty()) {
-		result = mGraphicalModelApi.graphicalIdsByLogicalId(result).first();
+
+	Id result = mLogicalModelApi.logicalRepoApi().from(logicalId(id));
+	const IdList graphicalResult = graphicalIds(result);
+	if (!graphicalResult.isEmpty()) {
+		result = graphicalResult.first();
 	}
+
+	if (mLookupTablesEnabled) {
+		mModelLinkFromTable.insert(id, result);
+	}
+
 	return result;
 }
 
@@ -504,10 +518,16 @@ Id BaseGraphTransformationUnit::fromInRule(const Id &id) const
 
 IdList BaseGraphTransformationUnit::linksInModel(const Id &id) const
 {
-	if (mLogicalModelApi.isLogicalId(id)) {
-		return mLogicalModelApi.logicalRepoApi().links(id);
+	if (mLookupTablesEnabled && mModelLinksTable.contains(id)) {
+		return mModelLinksTable.value(id);
 	}
-	return mLogicalModelApi.logicalRepoApi().links(mGraphicalModelApi.logicalId(id));
+
+	const IdList result = mLogicalModelApi.logicalRepoApi().links(logicalId(id));
+	if (mLookupTablesEnabled) {
+		mModelLinksTable.insert(id, result);
+	}
+
+	return result;
 }
 
 IdList BaseGraphTransformationUnit::linksInRule(const Id &id) const
@@ -539,6 +559,91 @@ IdList BaseGraphTransformationUnit::children(const Id &id) const
 	return mGraphicalModelApi.graphicalRepoApi().children(id);
 }
 
+IdList BaseGraphTransformationUnit::ruleLinks(const Id &id) const
+{
+	if (mLookupTablesEnabled && mRuleLinksTable.contains(id)) {
+		return mRuleLinksTable.value(id);
+	}
+
+	const IdList result = linksInRule(id);
+	if (mLookupTablesEnabled) {
+		mRuleLinksTable.insert(id, result);
+	}
+
+	return result;
+}
+
+QList<QPair<QString, QVariant>> BaseGraphTransformationUnit::ruleProperties(const Id &id) const
+{
+	if (mLookupTablesEnabled && mRulePropertiesTable.contains(id)) {
+		return mRulePropertiesTable.value(id);
+	}
+
+	// properties with empty values in rule match anything, so they are not stored at all
+	QList<QPair<QString, QVariant>> result;
+	const QHash<QString, QVariant> allProperties = properties(id);
+	for (auto it = allProperties.cbegin(); it != allProperties.cend(); ++it) {
+		if (!it.value().toString().isEmpty()) {
+			result.append(qMakePair(it.key(), it.value()));
+		}
+	}
+
+	if (mLookupTablesEnabled) {
+		mRulePropertiesTable.insert(id, result);
+	}
+
+	return result;
+}
+
+Id BaseGraphTransformationUnit::logicalId(const Id &id) const
+{
+	if (mLookupTablesEnabled && mLogicalIdsTable.contains(id)) {
+		return mLogicalIdsTable.value(id);
+	}
+
+	const Id result = mLogicalModelApi.isLogicalId(id) ? id : mGraphicalModelApi.logicalId(id);
+	if (mLookupTablesEnabled) {
+		mLogicalIdsTable.insert(id, result);
+	}
+
+	return result;
+}
+
+IdList BaseGraphTransformationUnit::graphicalIds(const Id &logicalId) const
+{
+	if (mLookupTablesEnabled && mGraphicalIdsTable.contains(logicalId)) {
+		return mGraphicalIdsTable.value(logicalId);
+	}
+
+	const IdList result = mGraphicalModelApi.graphicalIdsByLogicalId(logicalId);
+	if (mLookupTablesEnabled) {
+		mGraphicalIdsTable.insert(logicalId, result);
+	}
+
+	return result;
+}
+
+QMap<QString, QVariant> BaseGraphTransformationUnit::modelProperties(const Id &id) const
+{
+	const Id logical = logicalId(id);
+	if (mLookupTablesEnabled && mModelPropertiesTable.contains(logical)) {
+		return mModelPropertiesTable.value(logical);
+	}
+
+	QMap<QString, QVariant> result;
+	QMapIterator<QString, QVariant> iterator = mLogicalModelApi.logicalRepoApi().propertiesIterator(logical);
+	while (iterator.hasNext()) {
+		iterator.next();
+		result.insert(iterator.key(), iterator.value());
+	}
+
+	if (mLookupTablesEnabled) {
+		mModelPropertiesTable.insert(logical, result);
+	}
+
+	return result;
+}
+
 void BaseGraphTransformationUnit::report(const QString &message, bool isError) const
 {
 	if (isError) {
@@ -569,3 +674,27 @@ void BaseGraphTransformationUnit::resetRuleSyntaxCheck()
 {
 	mHasRuleSyntaxErr = false;
 }
+
+void BaseGraphTransformationUnit::buildLookupTables(const IdList &elements)
+{
+	clearLookupTables();
+	mLookupTablesEnabled = true;
+
+	for (const Id &element : elements) {
+		++mModelTypeFrequency[qMakePair(element.diagram(), element.element())];
+	}
+}
+
+void BaseGraphTransformationUnit::clearLookupTables()
+{
+	mLookupTablesEnabled = false;
+	mModelTypeFrequency.clear();
+	mModelLinksTable.clear();
+	mModelLinkToTable.clear();
+	mModelLinkFromTable.clear();
+	mLogicalIdsTable.clear();
+	mGraphicalIdsTable.clear();
+	mModelPropertiesTable.clear();
+	mRuleLinksTable.clear();
+	mRulePropertiesTable.clear();
+}
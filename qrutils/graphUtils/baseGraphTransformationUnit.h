@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <QtCore/QVector>
+
 #include "qrutils/utilsDeclSpec.h"
 
 #include <qrgui/plugins/toolPluginInterface/usedInterfaces/mainWindowInterpretersInterface.h>
@@ -55,6 +57,10 @@ protected:
 	/// to given node in rule at curren step
 	bool checkNodeForAddingToMatch(const Id &nodeInModel, const Id &nodeInRule);
 
+	/// Look-ahead check: every link of node in rule must have a link of the same kind at node in model,
+	/// otherwise no extension of the current match through this pair can succeed
+	bool hasLinksToCover(const Id &nodeInModel, const Id &nodeInRule) const;
+
 	/// Checks if node in model has all links to the current matched subgraph
 	/// as node in rule has
 	bool checkExistingLinks(const Id &nodeInModel, const Id &nodeInRule
@@ -64,7 +70,8 @@ protected:
 	/// matched subgraph.
 	void rollback();
 
-	/// Get link from node in rule which leads outside current matched graph
+	/// Get link from node in rule which leads outside current matched graph,
+	/// links to the rarest element types in model are preferred
 	Id outsideLink(const Id &nodeInRule) const;
 
 	/// Get second link end
@@ -96,6 +103,13 @@ protected:
 	/// Resets to false rule syntax error indicator
 	void resetRuleSyntaxCheck();
 
+	/// Enables lookup tables for the model and the rule, they stay valid while matching
+	/// since neither of them is modified until the match is found
+	void buildLookupTables(const IdList &elements);
+
+	/// Disables and drops lookup tables
+	void clearLookupTables();
+
 	/// Functions for working with properties of elements on model
 	QVariant property(const Id &id, const QString &propertyName) const;
 	virtual QMapIterator<QString, QVariant> propertiesIterator(const Id &id) const;
@@ -124,6 +138,13 @@ protected:
 	IdList incomingLinks(const Id &id) const;
 	IdList children(const Id &id) const;
 
+	/// Cached while matching versions of rule and model accessors
+	IdList ruleLinks(const Id &id) const;
+	QList<QPair<QString, QVariant>> ruleProperties(const Id &id) const;
+	Id logicalId(const Id &id) const;
+	IdList graphicalIds(const Id &logicalId) const;
+	QMap<QString, QVariant> modelProperties(const Id &id) const;
+
 	/// Reports message to the main system
 	virtual void report(const QString &message, bool isError) const;
 
@@ -159,6 +180,24 @@ protected:
 
 	/// Set of properties that will not be checked in compare elements
 	QSet<QString> mDefaultProperties;
+
+private:
+	/// Keys added to mMatch, in order of addition, and log sizes before each matched node
+	IdList mMatchUndoLog;
+	QVector<int> mMatchUndoMarks;
+
+	/// Lookup tables filled on first use while mLookupTablesEnabled is set
+	bool mLookupTablesEnabled { false };
+	/// Keyed by (diagram, element), editors of rule and model may differ as in compareElementTypesAndProperties
+	QHash<QPair<QString, QString>, int> mModelTypeFrequency;
+	mutable QHash<Id, IdList> mModelLinksTable;
+	mutable QHash<Id, Id> mModelLinkToTable;
+	mutable QHash<Id, Id> mModelLinkFromTable;
+	mutable QHash<Id, Id> mLogicalIdsTable;
+	mutable QHash<Id, IdList> mGraphicalIdsTable;
+	mutable QHash<Id, QMap<QString, QVariant>> mModelPropertiesTable;
+	mutable QHash<Id, IdList> mRuleLinksTable;
+	mutable QHash<Id, QList<QPair<QString, QVariant>>> mRulePropertiesTable;
 };
 
 }
@@ -22,6 +22,7 @@ using namespace qReal::details;
 
 PluginManagerImplementation::PluginManagerImplementation(const QString &pluginsDirPath)
 	: mPluginsDir(pluginsDirPath)
+	, mManifest(mPluginsDir, PluginManifest::defaultPath(mPluginsDir))
 {
 	QLOG_INFO() << "Plugin manager for " << mPluginsDir << "with PATH=" << qgetenv("PATH");
 }
@@ -34,7 +35,7 @@ PluginManagerImplementation::~PluginManagerImplementation()
 	}
 }
 
-QList<QObject *> PluginManagerImplementation::loadAllPlugins()
+QList<QObject *> PluginManagerImplementation::loadAllPlugins(const char *interfaceId)
 {
 	if (!mPluginsDir.exists()) {
 		QLOG_INFO() << "Plugins directory" << mPluginsDir.path()
@@ -44,17 +45,27 @@ QList<QObject *> PluginManagerImplementation::loadAllPlugins()
 
 	QList<QObject *> listOfPlugins;
 
-	for (const QString &fileName : mPluginsDir.entryList(QDir::Files)) {
+	const QStringList fileNames = mPluginsDir.entryList(QDir::Files);
+	for (const QString &fileName : fileNames) {
+		if (interfaceId && mManifest.isKnownToLack(fileName, interfaceId)) {
+			continue;
+		}
+
 		const QPair<QObject *, QString> pluginAndError = loadPluginByName(fileName);
 		QObject * const pluginByName = pluginAndError.first;
 		if (pluginByName) {
 			listOfPlugins.append(pluginByName);
 			mFileNameAndPlugin.insert(fileName, pluginByName);
+			if (interfaceId) {
+				mManifest.markInterface(fileName, interfaceId, pluginByName->qt_metacast(interfaceId) != nullptr);
+			}
 		} else {
 			QLOG_ERROR() << "Plugin loading failed:" << pluginAndError.second;
 		}
 	}
 
+	mManifest.retain(fileNames);
+	mManifest.save();
 	return listOfPlugins;
 }
 
@@ -67,11 +78,18 @@ QPair<QObject *, QString> PluginManagerImplementation::loadPluginByName(const QS
 	if (plugin) {
 		mLoaders.append(qMakePair(pluginName, loader));
 		mFileNameAndPlugin.insert(loader->metaData()["IID"].toString(), plugin);
+		mManifest.markPlugin(pluginName, loader->metaData()["IID"].toString());
 		return qMakePair(plugin, QString());
 	}
 
 	const QString loaderError = loader->errorString();
 
+	// Only files without plugin metadata are remembered as non-plugins, plugins failed to load for other reasons
+	// (a missing dependency, for example) will be tried again next time.
+	if (loader->metaData().isEmpty()) {
+		mManifest.markNotPlugin(pluginName);
+	}
+
 	// Unloading of plugins is currently (Qt 5.3) broken due to a bug in metatype system: calling Q_DECLARE_METATYPE
 	// from plugin registers some data from plugin address space in Qt metatype system, which is not being updated
 	// when plugin is unloaded and loaded again. Any subsequent calls to QVariant or other template classes/methods
@@ -21,6 +21,7 @@
 #include <QtCore/QMap>
 
 #include "qrutils/utilsDeclSpec.h"
+#include "pluginManifest.h"
 
 namespace qReal {
 namespace details {
@@ -34,7 +35,9 @@ public:
 	~PluginManagerImplementation();
 
 	/// Returns list of all found plugins if succeed and empty list otherwise.
-	QList<QObject *> loadAllPlugins();
+	/// @param interfaceId - if given, files that are known from plugin manifest not to implement the interface with
+	///        this id are skipped without loading, and the manifest is updated with results for the rest.
+	QList<QObject *> loadAllPlugins(const char *interfaceId = nullptr);
 
 	/// Returns plugin found by name if succeed and nothing otherwise
 	/// and error message, if failed.
@@ -66,6 +69,9 @@ private:
 	/// Map from fileName to plugin
 	/// Has ownership.
 	QMap<QString, QObject *> mFileNameAndPlugin;
+
+	/// Cached metadata of files in plugins directory.
+	PluginManifest mManifest;
 };
 
 }
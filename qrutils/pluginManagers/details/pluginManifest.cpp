@@ -0,0 +1,176 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#include "pluginManifest.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QStandardPaths>
+
+#include <qrkernel/logging.h>
+
+using namespace qReal::details;
+
+/// Shall be increased when the format changes, manifests of other versions are ignored.
+static const int manifestVersion = 1;
+
+PluginManifest::PluginManifest(const QDir &pluginsDir, const QString &manifestPath)
+	: mPluginsDir(pluginsDir)
+	, mManifestPath(manifestPath)
+{
+	load();
+}
+
+QString PluginManifest::defaultPath(const QDir &pluginsDir)
+{
+	const QByteArray dirHash = QCryptographicHash::hash(pluginsDir.absolutePath().toUtf8()
+			, QCryptographicHash::Md5).toHex();
+	return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+			+ "/pluginManifests/" + QString::fromLatin1(dirHash) + ".json";
+}
+
+bool PluginManifest::isKnownToLack(const QString &fileName, const QString &interfaceId) const
+{
+	const auto entry = mEntries.constFind(fileName);
+	if (entry == mEntries.constEnd() || !isUpToDate(fileName, entry.value())) {
+		return false;
+	}
+
+	return !entry->isPlugin || entry->lacking.contains(interfaceId);
+}
+
+void PluginManifest::markPlugin(const QString &fileName, const QString &iid)
+{
+	Entry &fileEntry = entry(fileName);
+	if (!fileEntry.isPlugin || fileEntry.iid != iid) {
+		fileEntry.isPlugin = true;
+		fileEntry.iid = iid;
+		mChanged = true;
+	}
+}
+
+void PluginManifest::markNotPlugin(const QString &fileName)
+{
+	Entry &fileEntry = entry(fileName);
+	if (fileEntry.isPlugin) {
+		fileEntry.isPlugin = false;
+		mChanged = true;
+	}
+}
+
+void PluginManifest::markInterface(const QString &fileName, const QString &interfaceId, bool implemented)
+{
+	Entry &fileEntry = entry(fileName);
+	QStringList &list = implemented ? fileEntry.implemented : fileEntry.lacking;
+	if (!list.contains(interfaceId)) {
+		list << interfaceId;
+		mChanged = true;
+	}
+}
+
+void PluginManifest::retain(const QStringList &fileNames)
+{
+	for (const QString &fileName : mEntries.keys()) {
+		if (!fileNames.contains(fileName)) {
+			mEntries.remove(fileName);
+			mChanged = true;
+		}
+	}
+}
+
+void PluginManifest::save()
+{
+	if (!mChanged) {
+		return;
+	}
+
+	QJsonObject plugins;
+	for (auto it = mEntries.constBegin(); it != mEntries.constEnd(); ++it) {
+		plugins[it.key()] = QJsonObject{
+			{"size", it->size}
+			, {"modified", it->modified.toMSecsSinceEpoch()}
+			, {"plugin", it->isPlugin}
+			, {"iid", it->iid}
+			, {"implements", QJsonArray::fromStringList(it->implemented)}
+			, {"lacks", QJsonArray::fromStringList(it->lacking)}
+		};
+	}
+
+	const QJsonObject manifest{{"version", manifestVersion}, {"plugins", plugins}};
+
+	QDir().mkpath(QFileInfo(mManifestPath).absolutePath());
+	QFile file(mManifestPath);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		QLOG_WARN() << "Can not write plugin manifest" << mManifestPath;
+		return;
+	}
+
+	file.write(QJsonDocument(manifest).toJson(QJsonDocument::Compact));
+	mChanged = false;
+}
+
+void PluginManifest::load()
+{
+	QFile file(mManifestPath);
+	if (!file.open(QIODevice::ReadOnly)) {
+		return;
+	}
+
+	const QJsonObject manifest = QJsonDocument::fromJson(file.readAll()).object();
+	if (manifest["version"].toInt() != manifestVersion) {
+		return;
+	}
+
+	const QJsonObject plugins = manifest["plugins"].toObject();
+	for (auto it = plugins.constBegin(); it != plugins.constEnd(); ++it) {
+		const QJsonObject plugin = it.value().toObject();
+		Entry &fileEntry = mEntries[it.key()];
+		fileEntry.size = static_cast<qint64>(plugin["size"].toDouble(-1));
+		fileEntry.modified = QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(plugin["modified"].toDouble()));
+		fileEntry.isPlugin = plugin["plugin"].toBool(true);
+		fileEntry.iid = plugin["iid"].toString();
+		for (const QJsonValue &interfaceId : plugin["implements"].toArray()) {
+			fileEntry.implemented << interfaceId.toString();
+		}
+
+		for (const QJsonValue &interfaceId : plugin["lacks"].toArray()) {
+			fileEntry.lacking << interfaceId.toString();
+		}
+	}
+}
+
+bool PluginManifest::isUpToDate(const QString &fileName, const Entry &entry) const
+{
+	const QFileInfo file(mPluginsDir.absoluteFilePath(fileName));
+	return file.exists() && file.size() == entry.size && file.lastModified() == entry.modified;
+}
+
+PluginManifest::Entry &PluginManifest::entry(const QString &fileName)
+{
+	Entry &fileEntry = mEntries[fileName];
+	if (!isUpToDate(fileName, fileEntry)) {
+		const QFileInfo file(mPluginsDir.absoluteFilePath(fileName));
+		fileEntry = Entry();
+		fileEntry.size = file.size();
+		fileEntry.modified = file.lastModified();
+		mChanged = true;
+	}
+
+	return fileEntry;
+}
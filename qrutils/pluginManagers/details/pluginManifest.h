@@ -0,0 +1,86 @@
+/* Copyright 2026 CyberTech Labs Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+
+#pragma once
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QMap>
+#include <QtCore/QStringList>
+
+#include "qrutils/utilsDeclSpec.h"
+
+namespace qReal {
+namespace details {
+
+/// Persisted metadata of files in plugins directory. Remembers which files are not Qt plugins at all and which
+/// interfaces each plugin was found to implement or lack, so subsequent startups do not load libraries that would
+/// be thrown away anyway. An entry is trusted only while size and modification time of its file stay the same.
+class QRUTILS_EXPORT PluginManifest
+{
+public:
+	/// @param pluginsDir - directory with plugins described by this manifest.
+	/// @param manifestPath - file where manifest is persisted.
+	PluginManifest(const QDir &pluginsDir, const QString &manifestPath);
+
+	/// Returns default location of the manifest for a given plugins directory, in user cache directory.
+	static QString defaultPath(const QDir &pluginsDir);
+
+	/// Returns true if it is known without loading that the file shall be skipped when plugins implementing
+	/// the given interface are requested: it is not a plugin or it is a plugin that does not implement the interface.
+	bool isKnownToLack(const QString &fileName, const QString &interfaceId) const;
+
+	/// Records that the file is a plugin with given IID in its metadata.
+	void markPlugin(const QString &fileName, const QString &iid);
+
+	/// Records that the file is not a Qt plugin.
+	void markNotPlugin(const QString &fileName);
+
+	/// Records whether the plugin in the file implements the given interface.
+	void markInterface(const QString &fileName, const QString &interfaceId, bool implemented);
+
+	/// Forgets all files except the given ones.
+	void retain(const QStringList &fileNames);
+
+	/// Writes the manifest to disk if it was changed since it was loaded.
+	void save();
+
+private:
+	struct Entry
+	{
+		qint64 size = -1;
+		QDateTime modified;
+		bool isPlugin = true;
+		QString iid;
+		QStringList implemented;
+		QStringList lacking;
+	};
+
+	void load();
+
+	/// Returns true if the entry describes the current state of the file.
+	bool isUpToDate(const QString &fileName, const Entry &entry) const;
+
+	/// Returns entry for the given file, resetting it if the file was changed.
+	Entry &entry(const QString &fileName);
+
+	const QDir mPluginsDir;
+	const QString mManifestPath;
+	QMap<QString, Entry> mEntries;
+	bool mChanged = false;
+};
+
+}
+}
@@ -28,11 +28,13 @@ class QRUTILS_EXPORT PluginManager
 public:
 	explicit PluginManager(const QString &pluginsDirPath);
 
-	/// Returns list of all found plugins if succeed and empty list otherwise.
+	/// Returns list of all found plugins if succeed and empty list otherwise. Libraries that are known from
+	/// previous runs not to implement InterfaceType are not loaded at all.
 	template <class InterfaceType>
 	QList<InterfaceType *> loadAllPlugins()
 	{
-		QList<QObject *> const loadedPlugins = mPluginManagerLoader.loadAllPlugins();
+		QList<QObject *> const loadedPlugins
+				= mPluginManagerLoader.loadAllPlugins(qobject_interface_iid<InterfaceType *>());
 		return listOfInterfaces<InterfaceType>(loadedPlugins);
 	}
 
@@ -14,8 +14,10 @@
 
 HEADERS += \
 	$$PWD/details/pluginManagerImplementation.h \
+	$$PWD/details/pluginManifest.h \
 	$$PWD/pluginManager.h
 
 SOURCES += \
 	$$PWD/details/pluginManagerImplementation.cpp \
+	$$PWD/details/pluginManifest.cpp \
 	$$PWD/pluginManager.cpp
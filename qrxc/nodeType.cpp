@@ -255,8 +255,7 @@ void NodeType::generateCode(OutFile &out)
 	generateCommonData(out);
 
 	if (!mSdfDomElement.isNull()) {
-		out() << "\t\t\tloadSdf(utils::xmlUtils::loadDocument(\":/generated/shapes/"
-				+ className + "Class.sdf\").documentElement());\n";
+		out() << "\t\t\tsetSdfPath(\":/generated/shapes/" + className + "Class.sdf\");\n";
 	}
 
 	out() << "\t\t\tsetSize(QSizeF(" + QString::number(mWidth) + ", " + QString::number(mHeight) + "));\n"
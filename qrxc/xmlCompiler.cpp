@@ -285,11 +285,16 @@ void XmlCompiler::generateInitMultigraph(OutFile &out)
 {
 	out() << "void " << mPluginName << "Plugin::initMultigraph()\n{\n";
 
+	// Types are kept in local variables, so links and explosions do not need lookups by name.
+	mTypeVariables.clear();
 	for (const Diagram *diagram : mEditors[mCurrentEditor]->diagrams()) {
 		for (const Type *type : diagram->types()) {
 			if (dynamic_cast<const GraphicType *>(type)) {
 				const QString elementType = NameNormalizer::normalize(type->qualifiedName());
-				out() << "\tmMetamodel->addNode(new " << elementType << "(*mMetamodel));\n";
+				out() << "\tqReal::ElementType * const type" << elementType
+						<< " = new " << elementType << "(*mMetamodel);\n"
+						<< "\tmMetamodel->addNode(type" << elementType << ");\n";
+				mTypeVariables << elementType;
 			}
 		}
 	}
@@ -324,12 +329,24 @@ void XmlCompiler::generateLinks(OutFile &out, const Type *from, const QStringLis
 		const QString toDiagramName = NameNormalizer::normalize(toType->diagram()->name());
 		const QString fromName = NameNormalizer::normalize(from->qualifiedName());
 		const QString toName = NameNormalizer::normalize(toType->qualifiedName());
-		out() << QString("\tmMetamodel->produceEdge(mMetamodel->elementType(\"%1\", \"%2\")"
-				", mMetamodel->elementType(\"%3\", \"%4\"), qReal::ElementType::%5);\n")
-				.arg(fromDiagramName, fromName, toDiagramName, toName, linkType);
+		out() << QString("\tmMetamodel->produceEdge(%1, %2, qReal::ElementType::%3);\n").arg(
+				elementTypeReference(from, fromDiagramName, fromName)
+				, elementTypeReference(toType, toDiagramName, toName)
+				, linkType);
 	}
 }
 
+QString XmlCompiler::elementTypeReference(const Type *type, const QString &diagramName
+		, const QString &elementName) const
+{
+	const QString normalizedName = type ? NameNormalizer::normalize(type->qualifiedName()) : QString();
+	if (mTypeVariables.contains(normalizedName)) {
+		return "*type" + normalizedName;
+	}
+
+	return QString("mMetamodel->elementType(\"%1\", \"%2\")").arg(diagramName, elementName);
+}
+
 void XmlCompiler::generateNameMappings(OutFile &out)
 {
 	out() << "void " << mPluginName << "Plugin::initNameMap()\n{\n";
@@ -404,11 +421,12 @@ void XmlCompiler::generateShallPaletteBeSorted(utils::OutFile &out)
 void XmlCompiler::generateExplosionsMappings(OutFile &out, const GraphicType *graphicType)
 {
 	const QMap<QString, QPair<bool, bool>> &explosions = graphicType->explosions();
+	const QString diagramName = graphicType->diagram()->name();
 	for (const QString &target : explosions.keys()) {
-		out() << QString("\tmMetamodel->addExplosion(mMetamodel->elementType(\"%1\", \"%2\")"\
-				", mMetamodel->elementType(\"%3\", \"%4\"), %5, %6);\n").arg(
-						graphicType->diagram()->name(), graphicType->name()
-						, graphicType->diagram()->name(), target
+		const Type *targetType = mEditors[mCurrentEditor]->findType(diagramName + "::" + target);
+		out() << QString("\tmMetamodel->addExplosion(%1, %2, %3, %4);\n").arg(
+						elementTypeReference(graphicType, diagramName, graphicType->name())
+						, elementTypeReference(targetType, diagramName, target)
 						, explosions[target].first ? "true" : "false"
 						, explosions[target].second ? "true" : "false");
 	}
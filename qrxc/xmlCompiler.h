@@ -15,6 +15,7 @@
 #pragma once
 
 #include <QtCore/QMap>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QDir>
 
@@ -62,9 +63,16 @@ private:
 	void generatePaletteGroupsDescriptions(utils::OutFile &out);
 	void generateShallPaletteBeSorted(utils::OutFile &out);
 
+	/// Returns an expression referring to the element type created in initMultigraph() for the given type,
+	/// or a lookup of the element type by the given diagram and element names if it is not created there.
+	QString elementTypeReference(const Type *type, const QString &diagramName, const QString &elementName) const;
+
 	QMap<QString, Editor *> mEditors;
 	QString mPluginName;
 	QString mPluginVersion;
 	QString mResources;
 	QString mCurrentEditor;
+
+	/// Normalized names of types that have local variables in generated initMultigraph().
+	QSet<QString> mTypeVariables;
 };